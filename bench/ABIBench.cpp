@@ -0,0 +1,326 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/Builder.hpp>
+#include <llvm-abi/FunctionEncoder.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/x86/Classifier.hpp>
+#include <llvm-abi/x86/X86_32ABITarget.hpp>
+#include <llvm-abi/x86/X86_32ABITypeLayout.hpp>
+#include <llvm-abi/x86/X86_32Classifier.hpp>
+#include <llvm-abi/x86/X86_64ABITarget.hpp>
+#include <llvm-abi/x86/X86_64ABITypeLayout.hpp>
+
+#include "BenchmarkRunner.hpp"
+#include "SignatureGenerator.hpp"
+
+using namespace llvm_abi;
+
+namespace {
+
+	// Results are accumulated here so that the compiler can't
+	// discard the work being measured.
+	volatile uint64_t benchSink = 0;
+	
+	const uint32_t CORPUS_SEED = 0x11AB1;
+	const size_t CORPUS_SIZE = 256;
+	
+	class BenchBuilder: public Builder {
+	public:
+		BenchBuilder(llvm::Function& function)
+		: function_(function),
+		builder_(&(function.getEntryBlock())) { }
+		
+		IRBuilder& getEntryBuilder() {
+			if (!function_.getEntryBlock().empty()) {
+				builder_.SetInsertPoint(&(function_.getEntryBlock().front()));
+			}
+			return builder_;
+		}
+		
+		IRBuilder& getBuilder() {
+			builder_.SetInsertPoint(&(function_.getEntryBlock()));
+			return builder_;
+		}
+	
+	private:
+		llvm::Function& function_;
+		IRBuilder builder_;
+	
+	};
+	
+	/**
+	 * \brief Benchmark Signature
+	 * 
+	 * A function type along with the types of the arguments at a
+	 * call site (which include any variadic arguments).
+	 */
+	struct BenchSignature {
+		BenchSignature(const TestFunctionType& testFunctionType)
+		: functionType(testFunctionType.functionType),
+		argumentTypes(testFunctionType.functionType.argumentTypes().begin(),
+		              testFunctionType.functionType.argumentTypes().end()) {
+			argumentTypes.append(testFunctionType.varArgsTypes.begin(),
+			                     testFunctionType.varArgsTypes.end());
+		}
+		
+		FunctionType functionType;
+		llvm::SmallVector<Type, 8> argumentTypes;
+	};
+	
+	std::vector<BenchSignature> generateSignatures(const TypeBuilder& typeBuilder) {
+		SignatureGenerator generator(typeBuilder, CORPUS_SEED);
+		std::vector<BenchSignature> signatures;
+		for (size_t i = 0; i < CORPUS_SIZE; i++) {
+			signatures.push_back(BenchSignature(generator.generateFunctionType()));
+		}
+		return signatures;
+	}
+	
+	FunctionType makeCallerFunctionType(const BenchSignature& signature) {
+		const auto& functionType = signature.functionType;
+		if (!functionType.isVarArg()) {
+			return functionType;
+		}
+		
+		return FunctionType(functionType.callingConvention(),
+		                    functionType.returnType(),
+		                    signature.argumentTypes,
+		                    /*isVarArg=*/false);
+	}
+	
+	void benchTypeBuilder(BenchmarkRunner& runner) {
+		const TypeBuilder typeBuilder;
+		
+		runner.run("TypeBuilder.InternExisting", "", 64, [&]() {
+			for (size_t i = 0; i < 64; i++) {
+				const auto type = typeBuilder.getStructTy({ IntTy, DoubleTy, PointerTy });
+				benchSink += type.structMembers().size();
+			}
+		});
+		
+		runner.run("TypeBuilder.InternNew", "", 64, [&]() {
+			// Each iteration starts with an empty builder, so every
+			// type is a new entry.
+			const TypeBuilder freshTypeBuilder;
+			for (size_t i = 0; i < 64; i++) {
+				const auto type = freshTypeBuilder.getArrayTy(i + 1, IntTy);
+				benchSink += type.arrayElementCount();
+			}
+		});
+	}
+	
+	template <typename TypeLayout>
+	void benchLayout(BenchmarkRunner& runner,
+	                 const std::string& name,
+	                 const std::string& target,
+	                 const TypeLayout& typeLayout) {
+		const auto& typeBuilder = typeLayout.typeBuilder();
+		SignatureGenerator generator(typeBuilder, CORPUS_SEED);
+		const auto deepType = generator.generateNestedStructType(/*depth=*/32,
+		                                                         /*width=*/3);
+		const auto wideType = generator.generateWideStructType(/*width=*/256);
+		const auto arrayOfWideType = typeBuilder.getArrayTy(16, wideType);
+		
+		runner.run(name + ".Deep", target, 1, [&]() {
+			benchSink += typeLayout.getTypeAllocSize(deepType).asBytes();
+			benchSink += typeLayout.getTypeRequiredAlign(deepType).asBytes();
+		});
+		
+		runner.run(name + ".Wide", target, 1, [&]() {
+			benchSink += typeLayout.getTypeAllocSize(wideType).asBytes();
+			benchSink += typeLayout.getTypeRequiredAlign(wideType).asBytes();
+		});
+		
+		runner.run(name + ".ArrayOfWide", target, 1, [&]() {
+			benchSink += typeLayout.getTypeAllocSize(arrayOfWideType).asBytes();
+			benchSink += typeLayout.getTypeRequiredAlign(arrayOfWideType).asBytes();
+		});
+	}
+	
+	void benchX86_64(BenchmarkRunner& runner) {
+		const llvm::Triple triple("x86_64-none-linux-gnu");
+		const x86::X86_64ABITarget target(triple, /*cpuName=*/"");
+		
+		// The target's layout memoizes sizes and alignments in its
+		// ABICache; a standalone layout recomputes them every time.
+		benchLayout(runner, "Layout.Cached", triple.str(),
+		            target.typeLayout());
+		const x86::X86_64ABITypeLayout uncachedTypeLayout(target.cpuFeatures());
+		benchLayout(runner, "Layout.Uncached", triple.str(),
+		            uncachedTypeLayout);
+		
+		const auto signatures = generateSignatures(target.typeLayout().typeBuilder());
+		
+		runner.run("Classifier.ClassifyFunctionType", triple.str(),
+		           signatures.size(), [&]() {
+			for (const auto& signature: signatures) {
+				x86::Classifier classifier(uncachedTypeLayout);
+				const auto argInfoArray =
+					classifier.classifyFunctionType(signature.functionType,
+					                                signature.argumentTypes);
+				benchSink += argInfoArray.size();
+			}
+		});
+	}
+	
+	void benchX86_32(BenchmarkRunner& runner) {
+		const llvm::Triple triple("i386-pc-linux-gnu");
+		const x86::X86_32ABITarget target(triple);
+		const x86::X86_32ABITypeLayout uncachedTypeLayout;
+		
+		const auto signatures = generateSignatures(target.typeLayout().typeBuilder());
+		
+		const x86::X86_32Classifier classifier(uncachedTypeLayout,
+		                                       uncachedTypeLayout.typeBuilder(),
+		                                       triple);
+		
+		runner.run("X86_32Classifier.ClassifyFunctionType", triple.str(),
+		           signatures.size(), [&]() {
+			for (const auto& signature: signatures) {
+				const auto argInfoArray =
+					classifier.classifyFunctionType(signature.functionType,
+					                                signature.argumentTypes);
+				benchSink += argInfoArray.size();
+			}
+		});
+	}
+	
+	void benchABI(BenchmarkRunner& runner,
+	              const std::string& tripleString) {
+		const llvm::Triple triple(tripleString);
+		const auto target = createABITarget(triple);
+		
+		llvm::LLVMContext context;
+		llvm::Module module("", context);
+		const auto abi = target->createABI(module);
+		
+		const auto signatures = generateSignatures(target->typeLayout().typeBuilder());
+		
+		std::vector<FunctionType> callerFunctionTypes;
+		std::vector<llvm::Function*> callees;
+		for (size_t i = 0; i < signatures.size(); i++) {
+			const auto& signature = signatures[i];
+			callerFunctionTypes.push_back(makeCallerFunctionType(signature));
+			
+			const auto callee = llvm::Function::Create(abi->getFunctionType(signature.functionType),
+			                                           llvm::Function::ExternalLinkage,
+			                                           "callee" + std::to_string(i),
+			                                           &module);
+			callee->setAttributes(abi->getAttributes(signature.functionType,
+			                                         signature.functionType.argumentTypes()));
+			callee->setCallingConv(abi->getCallingConvention(signature.functionType.callingConvention()));
+			callees.push_back(callee);
+		}
+		
+		runner.run("ABI.GetFunctionType", tripleString,
+		           signatures.size(), [&]() {
+			for (const auto& signature: signatures) {
+				benchSink += abi->getFunctionType(signature.functionType)->getNumParams();
+			}
+		});
+		
+		runner.run("ABI.GetAttributes", tripleString,
+		           signatures.size(), [&]() {
+			for (const auto& signature: signatures) {
+				const auto attributes = abi->getAttributes(signature.functionType,
+				                                           signature.argumentTypes);
+				benchSink += attributes.getNumAttrSets();
+			}
+		});
+		
+		// Emits a caller for each signature which decodes its
+		// arguments, passes them on to the callee and returns its
+		// result; this is the work done per call site by a frontend.
+		runner.run("ABI.EncodeAndCall", tripleString,
+		           signatures.size(), [&]() {
+			for (size_t i = 0; i < signatures.size(); i++) {
+				const auto& signature = signatures[i];
+				const auto& callerFunctionType = callerFunctionTypes[i];
+				const auto callee = callees[i];
+				
+				const auto caller = llvm::Function::Create(abi->getFunctionType(callerFunctionType),
+				                                           llvm::Function::ExternalLinkage,
+				                                           "caller", &module);
+				caller->setAttributes(abi->getAttributes(callerFunctionType,
+				                                         callerFunctionType.argumentTypes()));
+				(void) llvm::BasicBlock::Create(context, "", caller);
+				
+				BenchBuilder builder(*caller);
+				
+				llvm::SmallVector<llvm::Value*, 8> encodedArgumentValues;
+				for (auto it = caller->arg_begin(); it != caller->arg_end(); ++it) {
+					encodedArgumentValues.push_back(&*it);
+				}
+				
+				auto functionEncoder = abi->createFunctionEncoder(builder,
+				                                                  callerFunctionType,
+				                                                  encodedArgumentValues);
+				
+				llvm::SmallVector<TypedValue, 8> arguments;
+				for (size_t j = 0; j < functionEncoder->arguments().size(); j++) {
+					arguments.push_back(TypedValue(functionEncoder->arguments()[j],
+					                               callerFunctionType.argumentTypes()[j]));
+				}
+				
+				const auto returnValue = abi->createCall(
+					builder,
+					signature.functionType,
+					[&](llvm::ArrayRef<llvm::Value*> values) -> llvm::Value* {
+						const auto callInst = builder.getBuilder().CreateCall(callee, values);
+						callInst->setAttributes(abi->getAttributes(signature.functionType,
+						                                           signature.argumentTypes));
+						callInst->setCallingConv(callee->getCallingConv());
+						return callInst;
+					},
+					arguments
+				);
+				
+				functionEncoder->returnValue(returnValue);
+				
+				benchSink += caller->getInstructionCount();
+				caller->eraseFromParent();
+			}
+		});
+	}
+
+
+
+}
+
+int main(int argc, char** argv) {
+	BenchmarkOptions options;
+	if (!options.parse(argc, argv)) {
+		BenchmarkOptions::printUsage(argv[0]);
+		return 1;
+	}
+	
+	BenchmarkRunner runner(options);
+	
+	benchTypeBuilder(runner);
+	benchX86_64(runner);
+	benchX86_32(runner);
+	benchABI(runner, "x86_64-none-linux-gnu");
+	benchABI(runner, "i386-pc-linux-gnu");
+	benchABI(runner, "aarch64-none-linux-gnu");
+	
+	if (!runner.writeResults(options)) {
+		return 1;
+	}
+	
+	return 0;
+}
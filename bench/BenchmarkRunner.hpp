@@ -0,0 +1,222 @@
+#ifndef BENCHMARKRUNNER_HPP
+#define BENCHMARKRUNNER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Benchmark Options
+ * 
+ * The command line options shared by the benchmark programs.
+ */
+struct BenchmarkOptions {
+	BenchmarkOptions()
+	: format("json"), minTimeMs(50), repetitions(5) { }
+	
+	std::string format;
+	std::string outputPath;
+	std::string filter;
+	long minTimeMs;
+	long repetitions;
+	
+	bool parse(const int argc, char** const argv) {
+		for (int i = 1; i < argc; i++) {
+			const std::string arg = argv[i];
+			if (startsWith(arg, "--format=")) {
+				format = arg.substr(strlen("--format="));
+			} else if (startsWith(arg, "--output=")) {
+				outputPath = arg.substr(strlen("--output="));
+			} else if (startsWith(arg, "--filter=")) {
+				filter = arg.substr(strlen("--filter="));
+			} else if (startsWith(arg, "--min-time=")) {
+				minTimeMs = atol(arg.c_str() + strlen("--min-time="));
+			} else if (startsWith(arg, "--repetitions=")) {
+				repetitions = atol(arg.c_str() + strlen("--repetitions="));
+			} else {
+				return false;
+			}
+		}
+		
+		return (format == "json" || format == "csv") &&
+		       minTimeMs >= 0 && repetitions > 0;
+	}
+	
+	static void printUsage(const char* const programName) {
+		std::cerr << "Usage: " << programName << " [options]" << std::endl
+		          << "  --format=json|csv   Output format (default: json)" << std::endl
+		          << "  --output=FILE       Write results to FILE (default: stdout)" << std::endl
+		          << "  --filter=STRING     Only run benchmarks whose name contains STRING" << std::endl
+		          << "  --min-time=MS       Minimum time per repetition (default: 50)" << std::endl
+		          << "  --repetitions=N     Number of repetitions (default: 5)" << std::endl;
+	}
+	
+private:
+	static bool startsWith(const std::string& string, const std::string& prefix) {
+		return string.compare(0, prefix.size(), prefix) == 0;
+	}
+	
+};
+
+/**
+ * \brief Benchmark Result
+ * 
+ * Times are per operation, where a benchmark body may perform
+ * several operations (e.g. classify every signature in a
+ * corpus) per iteration.
+ */
+struct BenchmarkResult {
+	std::string name;
+	std::string target;
+	uint64_t iterations;
+	uint64_t operationsPerIteration;
+	double minNsPerOp;
+	double medianNsPerOp;
+};
+
+/**
+ * \brief Benchmark Runner
+ * 
+ * Runs each benchmark body for (at least) a minimum time per
+ * repetition, doubling the iteration count until it's reached,
+ * and records the fastest and median time per operation over the
+ * repetitions.
+ */
+class BenchmarkRunner {
+public:
+	BenchmarkRunner(const std::chrono::nanoseconds minTime,
+	                const size_t repetitions,
+	                std::string filter)
+	: minTime_(minTime),
+	repetitions_(std::max<size_t>(repetitions, 1)),
+	filter_(std::move(filter)) { }
+	
+	BenchmarkRunner(const BenchmarkOptions& options)
+	: BenchmarkRunner(std::chrono::milliseconds(options.minTimeMs),
+	                  options.repetitions, options.filter) { }
+	
+	bool isEnabled(const std::string& name) const {
+		return filter_.empty() || name.find(filter_) != std::string::npos;
+	}
+	
+	void run(const std::string& name,
+	         const std::string& target,
+	         const uint64_t operationsPerIteration,
+	         const std::function<void()>& body) {
+		if (!isEnabled(name)) {
+			return;
+		}
+		
+		// Warm up caches (including the library's own).
+		body();
+		
+		typedef std::chrono::steady_clock Clock;
+		
+		std::vector<double> nsPerOp;
+		uint64_t iterations = 1;
+		
+		for (size_t repetition = 0; repetition < repetitions_; repetition++) {
+			while (true) {
+				const auto start = Clock::now();
+				for (uint64_t i = 0; i < iterations; i++) {
+					body();
+				}
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+				
+				if (elapsed >= minTime_) {
+					nsPerOp.push_back(double(elapsed.count()) /
+					                  double(iterations * operationsPerIteration));
+					break;
+				}
+				
+				iterations *= 2;
+			}
+		}
+		
+		std::sort(nsPerOp.begin(), nsPerOp.end());
+		
+		BenchmarkResult result;
+		result.name = name;
+		result.target = target;
+		result.iterations = iterations;
+		result.operationsPerIteration = operationsPerIteration;
+		result.minNsPerOp = nsPerOp.front();
+		result.medianNsPerOp = nsPerOp[nsPerOp.size() / 2];
+		results_.push_back(result);
+	}
+	
+	const std::vector<BenchmarkResult>& results() const {
+		return results_;
+	}
+	
+	void writeCSV(std::ostream& stream) const {
+		stream << "benchmark,target,iterations,ops_per_iteration,min_ns_per_op,median_ns_per_op\n";
+		for (const auto& result: results_) {
+			stream << result.name << ","
+			       << result.target << ","
+			       << result.iterations << ","
+			       << result.operationsPerIteration << ","
+			       << result.minNsPerOp << ","
+			       << result.medianNsPerOp << "\n";
+		}
+	}
+	
+	/**
+	 * \brief Write the results in the format (and to the file)
+	 *        given by the options.
+	 */
+	bool writeResults(const BenchmarkOptions& options) const {
+		std::ofstream outputFile;
+		if (!options.outputPath.empty()) {
+			outputFile.open(options.outputPath.c_str());
+			if (!outputFile) {
+				std::cerr << "Failed to open '" << options.outputPath << "'." << std::endl;
+				return false;
+			}
+		}
+		
+		std::ostream& stream = options.outputPath.empty() ? std::cout : outputFile;
+		if (options.format == "json") {
+			writeJSON(stream);
+		} else {
+			writeCSV(stream);
+		}
+		return true;
+	}
+	
+	void writeJSON(std::ostream& stream) const {
+		stream << "{\n";
+		stream << "  \"results\": [";
+		for (size_t i = 0; i < results_.size(); i++) {
+			const auto& result = results_[i];
+			stream << (i == 0 ? "\n" : ",\n");
+			stream << "    {"
+			       << "\"benchmark\": \"" << result.name << "\", "
+			       << "\"target\": \"" << result.target << "\", "
+			       << "\"iterations\": " << result.iterations << ", "
+			       << "\"ops_per_iteration\": " << result.operationsPerIteration << ", "
+			       << "\"min_ns_per_op\": " << result.minNsPerOp << ", "
+			       << "\"median_ns_per_op\": " << result.medianNsPerOp
+			       << "}";
+		}
+		stream << "\n  ]\n";
+		stream << "}\n";
+	}
+	
+private:
+	std::chrono::nanoseconds minTime_;
+	size_t repetitions_;
+	std::string filter_;
+	std::vector<BenchmarkResult> results_;
+	
+};
+
+#endif
@@ -0,0 +1,514 @@
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/TargetSelect.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/Builder.hpp>
+#include <llvm-abi/DynamicCaller.hpp>
+#include <llvm-abi/FunctionEncoder.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include "BenchmarkRunner.hpp"
+
+using namespace llvm_abi;
+
+// Native callees, matching the signatures below.
+
+struct IntPair {
+	int a, b;
+};
+
+struct DoublePair {
+	double a, b;
+};
+
+struct LongArray {
+	long values[8];
+};
+
+extern "C" {
+	
+	int callBenchScalar(int a, int b) {
+		return a + b;
+	}
+	
+	IntPair callBenchSmallStruct(IntPair x, IntPair y) {
+		return IntPair{ x.a + y.a, x.b + y.b };
+	}
+	
+	DoublePair callBenchSSEStruct(DoublePair x, DoublePair y) {
+		return DoublePair{ x.a + y.a, x.b + y.b };
+	}
+	
+	long callBenchByValStruct(LongArray array) {
+		return array.values[0] + array.values[7];
+	}
+	
+	double callBenchVarArgs(int count, ...) {
+		va_list args;
+		va_start(args, count);
+		double sum = 0.0;
+		for (int i = 0; i < count; i++) {
+			sum += va_arg(args, double);
+		}
+		va_end(args);
+		return sum;
+	}
+
+#if defined(__x86_64__)
+	typedef float Float8 __attribute__((vector_size(32)));
+	
+	__attribute__((target("avx")))
+	Float8 callBenchAVXVector(Float8 x, Float8 y) {
+		return x + y;
+	}
+#endif
+
+}
+
+namespace {
+	
+	const uint64_t CALLS_PER_ITERATION = 1000;
+	
+	/**
+	 * \brief Builder for the benchmark loops.
+	 *
+	 * Code is emitted at the end of the current block (the loop
+	 * body), with allocas in the entry block.
+	 */
+	class LoopBuilder: public Builder {
+	public:
+		LoopBuilder(llvm::BasicBlock& entryBlock,
+		            llvm::BasicBlock& currentBlock)
+		: entryBlock_(entryBlock),
+		currentBlock_(currentBlock),
+		builder_(&currentBlock) { }
+		
+		IRBuilder& getEntryBuilder() {
+			builder_.SetInsertPoint(&(entryBlock_.front()));
+			return builder_;
+		}
+		
+		IRBuilder& getBuilder() {
+			builder_.SetInsertPoint(&currentBlock_);
+			return builder_;
+		}
+	
+	private:
+		llvm::BasicBlock& entryBlock_;
+		llvm::BasicBlock& currentBlock_;
+		IRBuilder builder_;
+	
+	};
+	
+	class FunctionBuilder: public Builder {
+	public:
+		FunctionBuilder(llvm::Function& function)
+		: function_(function),
+		builder_(&(function.getEntryBlock())) { }
+		
+		IRBuilder& getEntryBuilder() {
+			if (!function_.getEntryBlock().empty()) {
+				builder_.SetInsertPoint(&(function_.getEntryBlock().front()));
+			}
+			return builder_;
+		}
+		
+		IRBuilder& getBuilder() {
+			builder_.SetInsertPoint(&(function_.getEntryBlock()));
+			return builder_;
+		}
+	
+	private:
+		llvm::Function& function_;
+		IRBuilder builder_;
+	
+	};
+	
+	struct CallShape {
+		CallShape(std::string pName,
+		          std::string pNativeName,
+		          FunctionType pFunctionType,
+		          llvm::SmallVector<Type, 8> pVarArgsTypes = {})
+		: name(std::move(pName)),
+		nativeName(std::move(pNativeName)),
+		functionType(std::move(pFunctionType)),
+		varArgsTypes(std::move(pVarArgsTypes)) { }
+		
+		std::string name;
+		std::string nativeName;
+		FunctionType functionType;
+		llvm::SmallVector<Type, 8> varArgsTypes;
+	};
+	
+	std::vector<CallShape> getCallShapes(const TypeBuilder& typeBuilder,
+	                                     const bool hasAVX) {
+		const auto intPairType = typeBuilder.getStructTy({ IntTy, IntTy });
+		const auto doublePairType = typeBuilder.getStructTy({ DoubleTy, DoubleTy });
+		const auto longArrayType = typeBuilder.getStructTy({ typeBuilder.getArrayTy(8, LongTy) });
+		
+		std::vector<CallShape> shapes;
+		shapes.push_back(CallShape("Scalar", "callBenchScalar",
+		                           FunctionType(CC_CDefault, IntTy,
+		                                        { IntTy, IntTy })));
+		shapes.push_back(CallShape("SmallStruct", "callBenchSmallStruct",
+		                           FunctionType(CC_CDefault, intPairType,
+		                                        { intPairType, intPairType })));
+		shapes.push_back(CallShape("SSEStruct", "callBenchSSEStruct",
+		                           FunctionType(CC_CDefault, doublePairType,
+		                                        { doublePairType, doublePairType })));
+		if (hasAVX) {
+			const auto vectorType = typeBuilder.getVectorTy(8, FloatTy);
+			shapes.push_back(CallShape("AVXVector", "callBenchAVXVector",
+			                           FunctionType(CC_CDefault, vectorType,
+			                                        { vectorType, vectorType })));
+		}
+		shapes.push_back(CallShape("ByValLargeStruct", "callBenchByValStruct",
+		                           FunctionType(CC_CDefault, LongTy,
+		                                        { longArrayType })));
+		shapes.push_back(CallShape("VarArgs", "callBenchVarArgs",
+		                           FunctionType(CC_CDefault, DoubleTy,
+		                                        { IntTy }, /*isVarArg=*/true),
+		                           { DoubleTy, DoubleTy, DoubleTy }));
+		return shapes;
+	}
+	
+	llvm::Value* getArgumentValue(llvm::Type* const type) {
+		// Integer arguments are 3, which is also the number of
+		// variadic arguments.
+		if (type->isIntegerTy()) {
+			return llvm::ConstantInt::get(type, 3);
+		}
+		return llvm::Constant::getNullValue(type);
+	}
+	
+	void setFunctionABI(const ABI& abi, llvm::Function& function,
+	                    const FunctionType& functionType,
+	                    llvm::ArrayRef<Type> argumentTypes) {
+		function.setAttributes(abi.getAttributes(functionType, argumentTypes));
+		function.setCallingConv(abi.getCallingConvention(functionType.callingConvention()));
+	}
+	
+	/**
+	 * \brief Create a callee using the library's function encoder.
+	 *
+	 * It returns its first argument if it has the return type (or
+	 * else zero).
+	 */
+	llvm::Function* createLibraryCallee(const ABI& abi,
+	                                    llvm::Module& module,
+	                                    const CallShape& shape) {
+		const auto& functionType = shape.functionType;
+		const auto function = llvm::Function::Create(abi.getFunctionType(functionType),
+		                                             llvm::Function::ExternalLinkage,
+		                                             "libraryCallee" + shape.name,
+		                                             &module);
+		setFunctionABI(abi, *function, functionType, functionType.argumentTypes());
+		function->addFnAttr(llvm::Attribute::NoInline);
+		
+		(void) llvm::BasicBlock::Create(module.getContext(), "", function);
+		FunctionBuilder builder(*function);
+		
+		llvm::SmallVector<llvm::Value*, 8> encodedArgumentValues;
+		for (auto it = function->arg_begin(); it != function->arg_end(); ++it) {
+			encodedArgumentValues.push_back(&*it);
+		}
+		
+		auto functionEncoder = abi.createFunctionEncoder(builder,
+		                                                 functionType,
+		                                                 encodedArgumentValues);
+		
+		const auto returnLLVMType = abi.typeInfo().getLLVMType(functionType.returnType());
+		if (!functionType.argumentTypes().empty() &&
+		    functionType.argumentTypes()[0] == functionType.returnType()) {
+			functionEncoder->returnValue(functionEncoder->arguments()[0]);
+		} else {
+			functionEncoder->returnValue(llvm::Constant::getNullValue(returnLLVMType));
+		}
+		
+		return function;
+	}
+	
+	/**
+	 * \brief Create a function that calls the callee 'n' times.
+	 */
+	llvm::Function* createCallLoop(const ABI& abi,
+	                               llvm::Module& module,
+	                               const std::string& name,
+	                               const CallShape& shape,
+	                               llvm::Function* const callee) {
+		auto& context = module.getContext();
+		const auto int64Type = llvm::Type::getInt64Ty(context);
+		const auto loopFunctionType = llvm::FunctionType::get(llvm::Type::getVoidTy(context),
+		                                                      { int64Type },
+		                                                      /*isVarArg=*/false);
+		const auto function = llvm::Function::Create(loopFunctionType,
+		                                             llvm::Function::ExternalLinkage,
+		                                             name, &module);
+		
+		const auto entryBlock = llvm::BasicBlock::Create(context, "entry", function);
+		const auto loopBlock = llvm::BasicBlock::Create(context, "loop", function);
+		const auto exitBlock = llvm::BasicBlock::Create(context, "exit", function);
+		
+		IRBuilder irBuilder(entryBlock);
+		irBuilder.CreateBr(loopBlock);
+		
+		irBuilder.SetInsertPoint(loopBlock);
+		const auto counter = irBuilder.CreatePHI(int64Type, 2);
+		counter->addIncoming(llvm::ConstantInt::get(int64Type, 0), entryBlock);
+		
+		// Callers pass the variadic arguments as if they were
+		// declared arguments.
+		llvm::SmallVector<Type, 8> argumentTypes;
+		for (const auto& argType: shape.functionType.argumentTypes()) {
+			argumentTypes.push_back(argType);
+		}
+		for (const auto& argType: shape.varArgsTypes) {
+			argumentTypes.push_back(argType);
+		}
+		
+		llvm::SmallVector<TypedValue, 8> arguments;
+		for (const auto& argType: argumentTypes) {
+			arguments.push_back(TypedValue(getArgumentValue(abi.typeInfo().getLLVMType(argType)),
+			                               argType));
+		}
+		
+		LoopBuilder builder(*entryBlock, *loopBlock);
+		
+		(void) abi.createCall(
+			builder,
+			shape.functionType,
+			[&](llvm::ArrayRef<llvm::Value*> values) -> llvm::Value* {
+				const auto callInst = builder.getBuilder().CreateCall(callee, values);
+				callInst->setAttributes(abi.getAttributes(shape.functionType,
+				                                          argumentTypes));
+				callInst->setCallingConv(callee->getCallingConv());
+				return callInst;
+			},
+			arguments
+		);
+		
+		irBuilder.SetInsertPoint(loopBlock);
+		const auto next = irBuilder.CreateAdd(counter, llvm::ConstantInt::get(int64Type, 1));
+		counter->addIncoming(next, loopBlock);
+		irBuilder.CreateCondBr(irBuilder.CreateICmpEQ(next, &*(function->arg_begin())),
+		                       exitBlock, loopBlock);
+		
+		irBuilder.SetInsertPoint(exitBlock);
+		irBuilder.CreateRetVoid();
+		
+		return function;
+	}
+	
+	/**
+	 * \brief Arguments for calls through the dynamic caller.
+	 *
+	 * As for the JIT-compiled loops, integer arguments are 3 and
+	 * other arguments are zero.
+	 */
+	class DynamicArguments {
+	public:
+		DynamicArguments(llvm::ArrayRef<Type> argumentTypes) {
+			for (size_t i = 0; i < argumentTypes.size(); i++) {
+				Storage storage;
+				std::fill(storage.data, storage.data + sizeof(storage.data), 0);
+				if (argumentTypes[i] == IntTy) {
+					const int value = 3;
+					std::memcpy(storage.data, &value, sizeof(value));
+				}
+				storage_.push_back(storage);
+			}
+			for (auto& storage: storage_) {
+				pointers_.push_back(storage.data);
+			}
+		}
+		
+		void* const* pointers() const {
+			return pointers_.data();
+		}
+	
+	private:
+		struct Storage {
+			alignas(32) char data[64];
+		};
+		
+		std::vector<Storage> storage_;
+		std::vector<void*> pointers_;
+	
+	};
+	
+	void* getNativeCallee(const std::string& name) {
+		if (name == "callBenchScalar") {
+			return reinterpret_cast<void*>(&callBenchScalar);
+		} else if (name == "callBenchSmallStruct") {
+			return reinterpret_cast<void*>(&callBenchSmallStruct);
+		} else if (name == "callBenchSSEStruct") {
+			return reinterpret_cast<void*>(&callBenchSSEStruct);
+		} else if (name == "callBenchByValStruct") {
+			return reinterpret_cast<void*>(&callBenchByValStruct);
+		} else if (name == "callBenchVarArgs") {
+			return reinterpret_cast<void*>(&callBenchVarArgs);
+		}
+#if defined(__x86_64__)
+		if (name == "callBenchAVXVector") {
+			return reinterpret_cast<void*>(&callBenchAVXVector);
+		}
+#endif
+		return nullptr;
+	}
+	
+	std::vector<std::string> getHostFeatures() {
+		std::vector<std::string> features;
+		llvm::StringMap<bool> hostFeatures;
+		if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+			for (const auto& feature: hostFeatures) {
+				features.push_back((feature.getValue() ? "+" : "-") +
+				                   feature.getKey().str());
+			}
+		}
+		return features;
+	}
+
+
+
+}
+
+int main(int argc, char** argv) {
+	BenchmarkOptions options;
+	if (!options.parse(argc, argv)) {
+		BenchmarkOptions::printUsage(argv[0]);
+		return 1;
+	}
+	
+	llvm::InitializeNativeTarget();
+	llvm::InitializeNativeTargetAsmPrinter();
+	
+	const llvm::Triple triple(llvm::sys::getProcessTriple());
+	const auto hostFeatures = getHostFeatures();
+	const bool hasAVX = triple.getArch() == llvm::Triple::x86_64 &&
+	                    std::find(hostFeatures.begin(), hostFeatures.end(), "+avx") != hostFeatures.end();
+	
+	llvm::LLVMContext context;
+	std::unique_ptr<llvm::Module> module(new llvm::Module("CallBench", context));
+	module->setTargetTriple(triple.str());
+	
+	// Use the host CPU so that the ABI (e.g. for AVX vectors) matches
+	// the native code.
+	const auto abi = createABI(*module, triple, "native");
+	
+	const TypeBuilder typeBuilder;
+	const auto shapes = getCallShapes(typeBuilder, hasAVX);
+	
+	for (const auto& shape: shapes) {
+		const auto nativeCallee = llvm::Function::Create(abi->getFunctionType(shape.functionType),
+		                                                 llvm::Function::ExternalLinkage,
+		                                                 shape.nativeName,
+		                                                 module.get());
+		setFunctionABI(*abi, *nativeCallee, shape.functionType,
+		               shape.functionType.argumentTypes());
+		(void) createCallLoop(*abi, *module, "callNative" + shape.name,
+		                      shape, nativeCallee);
+		
+		// The library doesn't support receiving variadic arguments.
+		if (!shape.functionType.isVarArg()) {
+			const auto libraryCallee = createLibraryCallee(*abi, *module, shape);
+			(void) createCallLoop(*abi, *module, "callLibrary" + shape.name,
+			                      shape, libraryCallee);
+		}
+	}
+	
+	std::string error;
+	llvm::EngineBuilder engineBuilder(std::move(module));
+	engineBuilder.setEngineKind(llvm::EngineKind::JIT);
+	engineBuilder.setErrorStr(&error);
+	engineBuilder.setMCPU(llvm::sys::getHostCPUName());
+	engineBuilder.setMAttrs(hostFeatures);
+	std::unique_ptr<llvm::ExecutionEngine> engine(engineBuilder.create());
+	if (engine == nullptr) {
+		std::cerr << "Failed to create JIT: " << error << std::endl;
+		return 1;
+	}
+	
+	engine->addGlobalMapping("callBenchScalar", reinterpret_cast<uint64_t>(&callBenchScalar));
+	engine->addGlobalMapping("callBenchSmallStruct", reinterpret_cast<uint64_t>(&callBenchSmallStruct));
+	engine->addGlobalMapping("callBenchSSEStruct", reinterpret_cast<uint64_t>(&callBenchSSEStruct));
+	engine->addGlobalMapping("callBenchByValStruct", reinterpret_cast<uint64_t>(&callBenchByValStruct));
+	engine->addGlobalMapping("callBenchVarArgs", reinterpret_cast<uint64_t>(&callBenchVarArgs));
+#if defined(__x86_64__)
+	engine->addGlobalMapping("callBenchAVXVector", reinterpret_cast<uint64_t>(&callBenchAVXVector));
+#endif
+	engine->finalizeObject();
+	
+	BenchmarkRunner runner(options);
+	
+	typedef void (*CallLoopFunction)(uint64_t);
+	
+	for (const auto& shape: shapes) {
+		const char* const kinds[] = { "Native", "Library" };
+		for (const auto kind: kinds) {
+			const auto address = engine->getFunctionAddress(std::string("call") + kind + shape.name);
+			if (address == 0) {
+				continue;
+			}
+			
+			const auto callLoop = reinterpret_cast<CallLoopFunction>(address);
+			runner.run(std::string("Call.") + shape.name + "." + kind, triple.str(),
+			           CALLS_PER_ITERATION, [&]() {
+				callLoop(CALLS_PER_ITERATION);
+			});
+		}
+	}
+	
+	// Calls of the native callees through dynamic caller thunks
+	// (as with libffi). The dynamic caller has its own type
+	// builder, so it needs its own copy of the shapes.
+	DynamicCaller dynamicCaller;
+	for (const auto& shape: getCallShapes(dynamicCaller.typeBuilder(), hasAVX)) {
+		llvm::SmallVector<Type, 8> argumentTypes;
+		for (const auto& argType: shape.functionType.argumentTypes()) {
+			argumentTypes.push_back(argType);
+		}
+		for (const auto& argType: shape.varArgsTypes) {
+			argumentTypes.push_back(argType);
+		}
+		
+		const auto thunk = dynamicCaller.getThunk(shape.functionType, argumentTypes);
+		const auto callee = getNativeCallee(shape.nativeName);
+		const DynamicArguments arguments(argumentTypes);
+		alignas(32) char returnValue[64];
+		runner.run(std::string("Call.") + shape.name + ".Dynamic", triple.str(),
+		           CALLS_PER_ITERATION, [&]() {
+			for (uint64_t i = 0; i < CALLS_PER_ITERATION; i++) {
+				thunk(callee, returnValue, arguments.pointers());
+			}
+		});
+	}
+	
+	if (!runner.writeResults(options)) {
+		return 1;
+	}
+	
+	return 0;
+}
@@ -11,11 +11,13 @@
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Value.h>
 
+#include <llvm-abi/ABICallCost.hpp>
 #include <llvm-abi/CallingConvention.hpp>
 #include <llvm-abi/TypedValue.hpp>
 
 namespace llvm_abi {
 	
+	class ABIProfiler;
 	class ABITypeInfo;
 	class Builder;
 	class FunctionEncoder;
@@ -88,6 +90,20 @@ namespace llvm_abi {
 		                                          llvm::ArrayRef<Type> argumentTypes,
 		                                          llvm::AttributeList existingAttributes = llvm::AttributeList()) const = 0;
 		
+		/**
+		 * \brief Get the cost of a call.
+		 * 
+		 * Estimates the registers, stack space and copies used to
+		 * pass the arguments and return value of a call of the
+		 * given type, without emitting any IR.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The argument types (including varargs).
+		 * \return The call cost.
+		 */
+		virtual ABICallCost getCallCost(const FunctionType& functionType,
+		                                llvm::ArrayRef<Type> argumentTypes) const = 0;
+		
 		/**
 		 * \brief Create a function call.
 		 * 
@@ -127,18 +143,52 @@ namespace llvm_abi {
 		                                                               const FunctionType& functionType,
 		                                                               llvm::ArrayRef<llvm::Value*> arguments) const = 0;
 		
+		/**
+		 * \brief Set the profiler.
+		 * 
+		 * While a profiler is set, calls and function entries
+		 * emitted through this ABI update per-site counters of
+		 * calls and bytes copied through memory (see ABIProfiler).
+		 * 
+		 * \param profiler The profiler (or NULL to disable profiling).
+		 */
+		void setProfiler(ABIProfiler* profiler);
+		
+		/**
+		 * \brief Get the profiler.
+		 * 
+		 * \return The profiler, or NULL if profiling is disabled.
+		 */
+		ABIProfiler* profiler() const;
+		
+	protected:
+		ABI();
+		
+	private:
+		ABIProfiler* profiler_;
+		
 	};
 	
 	/**
 	 * \brief Create an ABI for the specified target triple.
 	 * 
+	 * Note that each call creates a new target, so ABIs created
+	 * this way do NOT share type layout or classification
+	 * caches (or type builders). When generating code for
+	 * several modules of the same target (e.g. in parallel),
+	 * create them with ABIRegistry::createABI() instead.
+	 * 
 	 * \param module The LLVM module.
 	 * \param targetTriple the LLVM target triple.
+	 * \param cpu The CPU name (or empty for the default CPU).
+	 * \param abiName The ABI name, as for clang's -target-abi
+	 *                (or empty for the target's default ABI).
 	 * \return The ABI for the target.
 	 */
 	std::unique_ptr<ABI> createABI(llvm::Module& module,
 	                               const llvm::Triple& targetTriple,
-	                               const std::string& cpu = "");
+	                               const std::string& cpu = "",
+	                               const std::string& abiName = "");
 
 }
 
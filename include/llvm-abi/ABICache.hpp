@@ -0,0 +1,119 @@
+#ifndef LLVMABI_ABICACHE_HPP
+#define LLVMABI_ABICACHE_HPP
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief ABI Cache
+	 * 
+	 * This class holds the type builder for a target along with
+	 * the results of layout and classification queries, so that
+	 * they can be shared between the ABI instances created for
+	 * each module (see ABITarget).
+	 * 
+	 * None of the cached information depends on an LLVMContext
+	 * and all methods are thread-safe. Entries are spread over
+	 * independently locked shards, so that threads generating
+	 * code in parallel rarely wait for each other.
+	 * 
+	 * Only types uniqued by the cache's own type builder are
+	 * cached, since types from other builders may be destroyed
+	 * and their addresses reused.
+	 */
+	class ABICache {
+	public:
+		ABICache();
+		~ABICache();
+		
+		/**
+		 * \brief Get the type builder shared by users of the cache.
+		 * 
+		 * \return The type builder.
+		 */
+		const TypeBuilder& typeBuilder() const;
+		
+		bool lookupTypeRawSize(Type type, DataSize& size) const;
+		
+		void insertTypeRawSize(Type type, DataSize size) const;
+		
+		bool lookupTypeRequiredAlign(Type type, DataSize& align) const;
+		
+		void insertTypeRequiredAlign(Type type, DataSize align) const;
+		
+		/**
+		 * \brief Look up a previously computed function IR mapping.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The (promoted) argument types.
+		 * \param functionIRMapping Set to the mapping if found.
+		 * \return Whether the mapping was found.
+		 */
+		bool lookupFunctionIRMapping(const FunctionType& functionType,
+		                             llvm::ArrayRef<Type> argumentTypes,
+		                             FunctionIRMapping& functionIRMapping) const;
+		
+		void insertFunctionIRMapping(const FunctionType& functionType,
+		                             llvm::ArrayRef<Type> argumentTypes,
+		                             const FunctionIRMapping& functionIRMapping) const;
+		
+	private:
+		// Non-copyable.
+		ABICache(const ABICache&) = delete;
+		ABICache& operator=(const ABICache&) = delete;
+		
+		struct FunctionKey {
+			CallingConvention callingConvention;
+			bool isVarArg;
+			size_t numFixedArguments;
+			llvm::SmallVector<Type, 8> types;
+			
+			bool operator<(const FunctionKey& other) const;
+			
+			size_t hash() const;
+		};
+		
+		static const size_t NumShards = 16;
+		
+		struct TypeShard {
+			std::mutex mutex;
+			std::unordered_map<Type, DataSize> rawSizes;
+			std::unordered_map<Type, DataSize> requiredAligns;
+		};
+		
+		struct FunctionShard {
+			std::mutex mutex;
+			std::map<FunctionKey, FunctionIRMapping> functionIRMappings;
+		};
+		
+		TypeShard& getTypeShard(Type type) const;
+		
+		bool isCacheableType(Type type) const;
+		
+		bool getFunctionKey(const FunctionType& functionType,
+		                    llvm::ArrayRef<Type> argumentTypes,
+		                    FunctionKey& key) const;
+		
+		TypeBuilder typeBuilder_;
+		mutable TypeShard typeShards_[NumShards];
+		mutable FunctionShard functionShards_[NumShards];
+		
+	};
+	
+}
+
+#endif
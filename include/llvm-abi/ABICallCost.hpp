@@ -0,0 +1,182 @@
+#ifndef LLVMABI_ABICALLCOST_HPP
+#define LLVMABI_ABICALLCOST_HPP
+
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/DataSize.hpp>
+
+namespace llvm_abi {
+	
+	class ABIFunctionPlan;
+	class ABITypeLayout;
+	
+	/**
+	 * \brief ABI Register File
+	 *
+	 * Describes the registers and stack slots a calling
+	 * convention uses to pass arguments, which is needed to
+	 * estimate the cost of calls (see ABICallCost).
+	 */
+	struct ABIRegisterFile {
+		/**
+		 * \brief Number of general purpose argument registers.
+		 */
+		unsigned intRegisters;
+		
+		/**
+		 * \brief Number of floating point/vector argument
+		 *        registers.
+		 *
+		 * If this is zero, floating point values are passed
+		 * in general purpose registers.
+		 */
+		unsigned fpRegisters;
+		
+		/**
+		 * \brief The size of a general purpose register, which
+		 *        is also the size of a stack argument slot.
+		 */
+		DataSize slotSize;
+		
+		/**
+		 * \brief Whether registers are allocated by position.
+		 *
+		 * If so (as for Win64), each argument uses up a
+		 * register of both kinds.
+		 */
+		bool isPositional;
+		
+		/**
+		 * \brief Whether the struct return pointer is passed
+		 *        in a dedicated register (e.g. X8 on AArch64).
+		 */
+		bool hasStructRetRegister;
+		
+		/**
+		 * \brief Stack space the caller always allocates for
+		 *        arguments (e.g. Win64's register home area).
+		 */
+		DataSize reservedStackSize;
+		
+		ABIRegisterFile(const unsigned pIntRegisters,
+		                const unsigned pFPRegisters,
+		                const DataSize pSlotSize)
+		: intRegisters(pIntRegisters),
+		fpRegisters(pFPRegisters),
+		slotSize(pSlotSize),
+		isPositional(false),
+		hasStructRetRegister(false),
+		reservedStackSize(DataSize::Bytes(0)) { }
+	};
+	
+	/**
+	 * \brief ABI Value Cost
+	 *
+	 * The cost of passing a single argument (or of returning
+	 * a value) at a call boundary.
+	 */
+	struct ABIValueCost {
+		/**
+		 * \brief General purpose registers used.
+		 */
+		unsigned intRegisters;
+		
+		/**
+		 * \brief Floating point/vector registers used.
+		 */
+		unsigned fpRegisters;
+		
+		/**
+		 * \brief Bytes used in the stack argument area.
+		 */
+		DataSize stackSize;
+		
+		/**
+		 * \brief Whether the value is copied through memory
+		 *        (e.g. into a temporary that is passed by
+		 *        pointer, or to coerce it to another type).
+		 */
+		bool isCopied;
+		
+		/**
+		 * \brief Whether the copy is done with a memcpy.
+		 */
+		bool usesMemCpy;
+		
+		/**
+		 * \brief Bytes copied through memory.
+		 */
+		DataSize copySize;
+		
+		ABIValueCost()
+		: intRegisters(0),
+		fpRegisters(0),
+		stackSize(DataSize::Bytes(0)),
+		isCopied(false),
+		usesMemCpy(false),
+		copySize(DataSize::Bytes(0)) { }
+	};
+	
+	/**
+	 * \brief ABI Call Cost
+	 *
+	 * An estimate of the cost of a call boundary, for frontend
+	 * decisions (e.g. passing by value or by pointer) and
+	 * inlining heuristics. It's computed from an ABIFunctionPlan
+	 * without emitting any IR.
+	 *
+	 * The register allocation follows the target's register
+	 * file rather than the backend, so it's an approximation for
+	 * targets that e.g. split aggregates between registers and
+	 * the stack.
+	 */
+	struct ABICallCost {
+		/**
+		 * \brief The cost of the return value.
+		 *
+		 * For values returned via a hidden pointer, this
+		 * includes the register or stack slot used for the
+		 * pointer.
+		 */
+		ABIValueCost returnCost;
+		
+		/**
+		 * \brief The costs of each argument (including any
+		 *        varargs arguments).
+		 */
+		llvm::SmallVector<ABIValueCost, 8> argumentCosts;
+		
+		/**
+		 * \brief The total size of the stack argument area.
+		 */
+		DataSize stackArgumentSize;
+		
+		ABICallCost()
+		: stackArgumentSize(DataSize::Bytes(0)) { }
+		
+		/**
+		 * \brief Get the total number of registers used.
+		 */
+		unsigned totalRegisters() const;
+		
+		/**
+		 * \brief Get the total number of bytes copied.
+		 */
+		DataSize totalCopySize() const;
+	};
+	
+	/**
+	 * \brief Compute the cost of a call.
+	 *
+	 * \param typeLayout The ABI type layout.
+	 * \param registerFile The calling convention's registers.
+	 * \param plan The function plan.
+	 * \return The call cost.
+	 */
+	ABICallCost computeCallCost(const ABITypeLayout& typeLayout,
+	                            const ABIRegisterFile& registerFile,
+	                            const ABIFunctionPlan& plan);
+
+}
+
+#endif
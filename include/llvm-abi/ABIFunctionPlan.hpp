@@ -0,0 +1,66 @@
+#ifndef LLVMABI_ABIFUNCTIONPLAN_HPP
+#define LLVMABI_ABIFUNCTIONPLAN_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief ABI Function Plan
+	 * 
+	 * This holds the result of classifying a function (or a call
+	 * to it) for an ABI: the promoted argument types and how each
+	 * argument maps to IR arguments.
+	 * 
+	 * Plans don't contain any LLVM types, so they can be computed
+	 * once by an ABITarget and then used to emit IR in any
+	 * LLVMContext.
+	 */
+	class ABIFunctionPlan {
+	public:
+		ABIFunctionPlan(const FunctionType& pFunctionType,
+		                llvm::ArrayRef<Type> pArgumentTypes,
+		                const FunctionIRMapping& pFunctionIRMapping)
+		: functionType_(pFunctionType),
+		argumentTypes_(pArgumentTypes.begin(), pArgumentTypes.end()),
+		functionIRMapping_(pFunctionIRMapping) { }
+		
+		/**
+		 * \brief Get the ABI function type.
+		 */
+		const FunctionType& functionType() const {
+			return functionType_;
+		}
+		
+		/**
+		 * \brief Get the argument types.
+		 * 
+		 * These are the promoted types of all arguments,
+		 * including any varargs arguments.
+		 */
+		llvm::ArrayRef<Type> argumentTypes() const {
+			return argumentTypes_;
+		}
+		
+		/**
+		 * \brief Get the mapping from ABI arguments to IR arguments.
+		 */
+		const FunctionIRMapping& functionIRMapping() const {
+			return functionIRMapping_;
+		}
+		
+	private:
+		FunctionType functionType_;
+		llvm::SmallVector<Type, 8> argumentTypes_;
+		FunctionIRMapping functionIRMapping_;
+		
+	};
+	
+}
+
+#endif
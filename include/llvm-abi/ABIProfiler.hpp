@@ -0,0 +1,148 @@
+#ifndef LLVMABI_ABIPROFILER_HPP
+#define LLVMABI_ABIPROFILER_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/StringRef.h>
+
+#include <llvm-abi/DataSize.hpp>
+
+namespace llvm {
+	
+	class GlobalVariable;
+	class Module;
+
+}
+
+namespace llvm_abi {
+	
+	class Builder;
+	
+	/**
+	 * \brief ABI Profile Counts
+	 *
+	 * The bytes copied through memory by one execution of a
+	 * call site (or function entry), which are known statically.
+	 */
+	struct ABIProfileCounts {
+		/**
+		 * \brief Bytes copied for arguments passed 'byval'.
+		 */
+		DataSize byValBytes;
+		
+		/**
+		 * \brief Bytes copied for other values passed or
+		 *        returned via a pointer.
+		 */
+		DataSize indirectBytes;
+		
+		/**
+		 * \brief Bytes copied with a memcpy to coerce (or
+		 *        realign) a value.
+		 */
+		DataSize coercedBytes;
+		
+		ABIProfileCounts()
+		: byValBytes(DataSize::Bytes(0)),
+		indirectBytes(DataSize::Bytes(0)),
+		coercedBytes(DataSize::Bytes(0)) { }
+	};
+	
+	/**
+	 * \brief ABI Profiler
+	 *
+	 * Instruments the code emitted by an ABI (see ABI::setProfiler())
+	 * with a counter record for each call site and each function
+	 * entry. A record holds four i64 counters:
+	 *
+	 * - the number of calls (or function entries);
+	 * - the bytes copied for 'byval' arguments;
+	 * - the bytes copied for other indirect values;
+	 * - the bytes copied to coerce or realign values.
+	 *
+	 * Once all code has been emitted, finalize() creates the table
+	 * of records, which has the layout:
+	 *
+	 *     { i64 numSites, [numSites x { i8* name, [4 x i64]* counters }] }
+	 *
+	 * The table can be read through its symbol or dumped to a file
+	 * when the program exits.
+	 *
+	 * Counters are updated non-atomically, as for PGO counters.
+	 */
+	class ABIProfiler {
+	public:
+		/**
+		 * \brief Create a profiler for a module.
+		 *
+		 * \param module The module being emitted.
+		 * \param tableName The symbol name of the table; hosts that
+		 *                  link several instrumented modules should
+		 *                  give each a distinct name.
+		 */
+		ABIProfiler(llvm::Module& module,
+		            std::string tableName = "__llvm_abi_profile");
+		
+		/**
+		 * \brief Create the counters for a call site.
+		 *
+		 * \param name The name of the site (e.g. the function
+		 *             containing the call).
+		 * \return The site's counters.
+		 */
+		llvm::GlobalVariable* createSite(const std::string& name);
+		
+		/**
+		 * \brief Emit updates of a site's counters.
+		 *
+		 * Updates are emitted at the builder's insert point; counts
+		 * that are zero aren't emitted.
+		 *
+		 * \param builder The builder for emitting instructions.
+		 * \param site The site's counters.
+		 * \param numCalls The number of calls to add.
+		 * \param counts The bytes to add.
+		 */
+		void emitUpdates(Builder& builder,
+		                 llvm::GlobalVariable* site,
+		                 uint64_t numCalls,
+		                 const ABIProfileCounts& counts) const;
+		
+		/**
+		 * \brief Create the table of sites.
+		 *
+		 * This must be called once, after all code is emitted.
+		 *
+		 * \param dumpFileName If non-empty, the table is appended
+		 *                     to this file (as tab separated name,
+		 *                     calls, byval, indirect and coerced
+		 *                     bytes) when the program exits.
+		 */
+		void finalize(llvm::StringRef dumpFileName = "");
+		
+		/**
+		 * \brief Get the number of sites.
+		 */
+		size_t numSites() const;
+	
+	private:
+		// Non-copyable.
+		ABIProfiler(const ABIProfiler&) = delete;
+		ABIProfiler& operator=(const ABIProfiler&) = delete;
+		
+		void createDumpFunction(llvm::GlobalVariable* table,
+		                        llvm::StringRef dumpFileName);
+		
+		llvm::Module& module_;
+		std::string tableName_;
+		std::vector<std::pair<std::string, llvm::GlobalVariable*>> sites_;
+		bool isFinalized_;
+	
+	};
+
+}
+
+#endif
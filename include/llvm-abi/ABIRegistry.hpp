@@ -0,0 +1,88 @@
+#ifndef LLVMABI_ABIREGISTRY_HPP
+#define LLVMABI_ABIREGISTRY_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+namespace llvm_abi {
+	
+	class ABI;
+	class ABITarget;
+	
+	/**
+	 * \brief ABI Registry
+	 * 
+	 * This class holds ABI targets keyed by target triple, CPU
+	 * and ABI name, so that ABIs created for different modules
+	 * (e.g. when splitting a translation unit for parallel code
+	 * generation) share the same target description and
+	 * layout/classification caches.
+	 * 
+	 * All methods are thread-safe.
+	 */
+	class ABIRegistry {
+	public:
+		ABIRegistry();
+		~ABIRegistry();
+		
+		/**
+		 * \brief Get the process-wide registry.
+		 * 
+		 * \return The global registry.
+		 */
+		static ABIRegistry& global();
+		
+		/**
+		 * \brief Get (or create) the target for a triple, CPU and
+		 *        ABI name.
+		 * 
+		 * \param targetTriple the LLVM target triple.
+		 * \param cpu The CPU name (or empty for the default CPU).
+		 * \param abiName The ABI name (or empty for the default ABI).
+		 * \return The shared ABI target.
+		 */
+		std::shared_ptr<ABITarget> getTarget(const llvm::Triple& targetTriple,
+		                                     const std::string& cpu = "",
+		                                     const std::string& abiName = "");
+		
+		/**
+		 * \brief Create an ABI for a module using a shared target.
+		 * 
+		 * \param module The LLVM module.
+		 * \param targetTriple the LLVM target triple.
+		 * \param cpu The CPU name (or empty for the default CPU).
+		 * \param abiName The ABI name (or empty for the default ABI).
+		 * \return The ABI for the module.
+		 */
+		std::unique_ptr<ABI> createABI(llvm::Module& module,
+		                               const llvm::Triple& targetTriple,
+		                               const std::string& cpu = "",
+		                               const std::string& abiName = "");
+		
+		/**
+		 * \brief Remove all targets from the registry.
+		 * 
+		 * Existing ABIs keep their targets alive.
+		 */
+		void clear();
+		
+	private:
+		// Non-copyable.
+		ABIRegistry(const ABIRegistry&) = delete;
+		ABIRegistry& operator=(const ABIRegistry&) = delete;
+		
+		std::mutex mutex_;
+		std::map<std::tuple<std::string, std::string, std::string>,
+		         std::shared_ptr<ABITarget>> targets_;
+		
+	};
+	
+}
+
+#endif
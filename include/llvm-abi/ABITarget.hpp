@@ -0,0 +1,207 @@
+#ifndef LLVMABI_ABITARGET_HPP
+#define LLVMABI_ABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABICallCost.hpp>
+#include <llvm-abi/ABIFunctionPlan.hpp>
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	class ABI;
+	class ABITypeInfo;
+	class ABITypeLayout;
+	
+	/**
+	 * \brief ABI Target
+	 * 
+	 * This class describes an ABI for a particular target (e.g.
+	 * a triple and CPU) independently of any LLVM module or
+	 * context. It is immutable once constructed (other than
+	 * its cache) and can be shared between threads.
+	 * 
+	 * The target is responsible for type layout and for planning
+	 * how functions are passed (see ABIFunctionPlan); the ABI
+	 * instances created from it (see DefaultABI) only emit IR for
+	 * those plans in a particular LLVMContext, so creating one per
+	 * module is cheap.
+	 */
+	class ABITarget: public std::enable_shared_from_this<ABITarget> {
+	public:
+		ABITarget(const llvm::Triple& targetTriple);
+		virtual ~ABITarget();
+		
+		/**
+		 * \brief Get target triple.
+		 * 
+		 * \return The LLVM target triple.
+		 */
+		const llvm::Triple& targetTriple() const;
+		
+		/**
+		 * \brief Get the layout/classification cache.
+		 * 
+		 * \return The cache shared by ABIs for this target.
+		 */
+		const ABICache& cache() const;
+		
+		/**
+		 * \brief Get the ABI's name.
+		 * 
+		 * \return The name of the ABI (e.g. 'x86_64').
+		 */
+		virtual std::string name() const = 0;
+		
+		/**
+		 * \brief Get the (context-free) type layout.
+		 * 
+		 * \return The ABI type layout.
+		 */
+		virtual const ABITypeLayout& typeLayout() const = 0;
+		
+		/**
+		 * \brief Get the LLVM type of 'long double'.
+		 * 
+		 * \param llvmContext The LLVM context.
+		 * \return The LLVM floating point type.
+		 */
+		virtual llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const = 0;
+		
+		/**
+		 * \brief Get the LLVM calling convention.
+		 * 
+		 * The default maps the C conventions to llvm::CallingConv::C
+		 * and the fast convention to llvm::CallingConv::Fast; other
+		 * conventions are invalid.
+		 * 
+		 * \param callingConvention The ABI calling convention.
+		 * \return The LLVM calling convention.
+		 */
+		virtual llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+		
+		/**
+		 * \brief Get LLVM function attributes.
+		 * 
+		 * Targets can override this to add attributes that the
+		 * backend needs for their function plans.
+		 * 
+		 * \param llvmContext The LLVM context.
+		 * \param typeInfo The ABI type information.
+		 * \param functionIRMapping The ABI function IR mapping.
+		 * \param existingAttributes Any existing attributes.
+		 * \return The ABI-encoded LLVM function attributes.
+		 */
+		virtual llvm::AttributeList
+		getFunctionAttributes(llvm::LLVMContext& llvmContext,
+		                      const ABITypeInfo& typeInfo,
+		                      const FunctionIRMapping& functionIRMapping,
+		                      llvm::AttributeList existingAttributes) const;
+		
+		/**
+		 * \brief Get the plan for a function's declared arguments.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \return The function plan.
+		 */
+		ABIFunctionPlan getFunctionPlan(const FunctionType& functionType) const;
+		
+		/**
+		 * \brief Get the plan for a call with the given arguments.
+		 * 
+		 * Argument types beyond those declared by the function type
+		 * (i.e. varargs) are promoted.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The argument types.
+		 * \return The function plan.
+		 */
+		ABIFunctionPlan getFunctionPlan(const FunctionType& functionType,
+		                                llvm::ArrayRef<Type> argumentTypes) const;
+		
+		/**
+		 * \brief Get the cost of a call with the given arguments.
+		 * 
+		 * This is computed from the function plan without
+		 * emitting IR, so it's cheap enough to be used for
+		 * frontend lowering decisions.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The argument types.
+		 * \return The call cost.
+		 */
+		ABICallCost getCallCost(const FunctionType& functionType,
+		                        llvm::ArrayRef<Type> argumentTypes) const;
+		
+		/**
+		 * \brief Create an ABI for a module.
+		 * 
+		 * The returned ABI holds a reference to this target,
+		 * which must therefore be owned by a std::shared_ptr.
+		 * 
+		 * \param module The LLVM module.
+		 * \return The ABI for the module.
+		 */
+		std::unique_ptr<ABI> createABI(llvm::Module& module) const;
+		
+	protected:
+		/**
+		 * \brief Classify a function's arguments.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The (promoted) argument types.
+		 * \return The mapping from ABI arguments to IR arguments.
+		 */
+		virtual FunctionIRMapping
+		computeFunctionIRMapping(const FunctionType& functionType,
+		                         llvm::ArrayRef<Type> argumentTypes) const = 0;
+		
+		/**
+		 * \brief Get the registers used to pass arguments.
+		 * 
+		 * \param functionType The ABI function type.
+		 * \return The register file for the function's
+		 *         calling convention.
+		 */
+		virtual ABIRegisterFile
+		argumentRegisterFile(const FunctionType& functionType) const = 0;
+		
+	private:
+		// Non-copyable.
+		ABITarget(const ABITarget&) = delete;
+		ABITarget& operator=(const ABITarget&) = delete;
+		
+		llvm::Triple targetTriple_;
+		ABICache cache_;
+		
+	};
+	
+	/**
+	 * \brief Create an ABI target for the specified target triple.
+	 * 
+	 * \param targetTriple the LLVM target triple.
+	 * \param cpu The CPU name (or empty for the default CPU).
+	 * \param abiName The ABI name, as for clang's -target-abi
+	 *                (or empty for the target's default ABI).
+	 * \return The ABI target.
+	 */
+	std::shared_ptr<ABITarget> createABITarget(const llvm::Triple& targetTriple,
+	                                           const std::string& cpu = "",
+	                                           const std::string& abiName = "");
+	
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef LLVMABI_ABITIMEREGION_HPP
+#define LLVMABI_ABITIMEREGION_HPP
+
+#include <llvm/Pass.h>
+#include <llvm/Support/TimeProfiler.h>
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief Time region kinds.
+	 *
+	 * Each kind has its own timer in the 'llvm-abi' timer group.
+	 */
+	enum ABITimeRegionKind {
+		TypeInterningRegion,
+		TypeLayoutRegion,
+		ClassificationRegion,
+		IRMappingRegion,
+		CallerEncodingRegion,
+		CalleeDecodingRegion,
+		NumABITimeRegionKinds
+	};
+	
+	/**
+	 * \brief ABI Time Region
+	 *
+	 * Times a region of the library, both for -time-passes
+	 * (via an llvm::Timer) and for -ftime-trace style profiles
+	 * (via the LLVM time trace profiler). Nothing is done
+	 * unless the host compiler has enabled one of these.
+	 *
+	 * Regions of the same kind may nest (e.g. layout recurses
+	 * into member types), in which case only the outermost
+	 * region is timed.
+	 */
+	class ABITimeRegion {
+	public:
+		ABITimeRegion(const ABITimeRegionKind kind)
+		: kind_(kind),
+		isActive_(false),
+		isTimed_(false),
+		isTraced_(false) {
+			if (llvm::TimePassesIsEnabled ||
+			    llvm::timeTraceProfilerEnabled()) {
+				start();
+			}
+		}
+		
+		~ABITimeRegion() {
+			if (isActive_) {
+				stop();
+			}
+		}
+	
+	private:
+		// Non-copyable.
+		ABITimeRegion(const ABITimeRegion&) = delete;
+		ABITimeRegion& operator=(const ABITimeRegion&) = delete;
+		
+		void start();
+		
+		void stop();
+		
+		ABITimeRegionKind kind_;
+		bool isActive_;
+		bool isTimed_;
+		bool isTraced_;
+	
+	};
+
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <sstream>
 
+#include <llvm/ADT/SmallVector.h>
+
 #include <llvm-abi/Type.hpp>
 
 namespace llvm_abi {
@@ -47,21 +49,70 @@ namespace llvm_abi {
 			 */
 			Expand,
 			
+			/**
+			 * \brief Coerce aggregate type to a struct with padding
+			 *        and pass its non-padding fields separately.
+			 */
+			CoerceAndExpand,
+			
 			/**
 			 * \brief Pass argument using LLVM inalloca attribute.
 			 */
 			InAlloca
 		};
 		
+		/**
+		 * \brief Indirect Reason
+		 * 
+		 * Records why an ABI chose to pass an argument in
+		 * memory, so that this can be reported to users (see
+		 * emitMemoryRemark()).
+		 */
+		enum IndirectReason {
+			/**
+			 * \brief The ABI's rules for the type require memory.
+			 */
+			ABIRequired,
+			
+			/**
+			 * \brief No registers were left for the argument.
+			 */
+			RegistersExhausted,
+			
+			/**
+			 * \brief The type is too large for registers.
+			 */
+			TooLarge,
+			
+			/**
+			 * \brief The type has unaligned fields.
+			 */
+			UnalignedFields,
+			
+			/**
+			 * \brief The type is (or contains) an x87 value,
+			 *        which is never passed in registers.
+			 */
+			X87Value,
+			
+			/**
+			 * \brief The type has an X87UP eightbyte that isn't
+			 *        preceded by an X87 eightbyte.
+			 */
+			X87UpWithoutX87
+		};
+	
 	private:
-		Type typeData; // isDirect() || isExtend() || isExpand()
+		Type typeData; // isDirect() || isExtend() || isExpand() || isCoerceAndExpand()
 		Type paddingType;
+		Type unpaddedCoerceAndExpandType; // isCoerceAndExpand()
 		union {
 			unsigned directOffset; // isDirect() || isExtend()
 			unsigned indirectAlign; // isIndirect()
 			unsigned allocaFieldIndex; // isInAlloca()
 		};
 		ArgInfoKind kind;
+		IndirectReason indirectReason; // isIndirect()
 		bool paddingInReg : 1;
 		bool inAllocaSRet : 1; // isInAlloca()
 		bool indirectByVal : 1; // isIndirect()
@@ -73,6 +124,7 @@ namespace llvm_abi {
 		ArgInfo(ArgInfoKind K)
 		: directOffset(0),
 		kind(K),
+		indirectReason(ABIRequired),
 		paddingInReg(false),
 		inAllocaSRet(false),
 		indirectByVal(false),
@@ -83,8 +135,10 @@ namespace llvm_abi {
 		
 	public:
 		ArgInfo()
-		: typeData(VoidTy), paddingType(VoidTy), directOffset(0),
-		kind(Direct), paddingInReg(false), inReg(false) {}
+		: typeData(VoidTy), paddingType(VoidTy),
+		unpaddedCoerceAndExpandType(VoidTy), directOffset(0),
+		kind(Direct), indirectReason(ABIRequired),
+		paddingInReg(false), inReg(false) {}
 		
 		static ArgInfo getDirect(Type type,
 		                         unsigned offset = 0,
@@ -165,6 +219,22 @@ namespace llvm_abi {
 			return argInfo;
 		}
 		
+		static ArgInfo getCoerceAndExpand(const Type coerceToType,
+		                                  const Type unpaddedCoerceToType) {
+			auto argInfo = ArgInfo(CoerceAndExpand);
+			argInfo.setCoerceAndExpandType(coerceToType,
+			                               unpaddedCoerceToType);
+			return argInfo;
+		}
+		
+		/**
+		 * \brief Query whether a member of a CoerceAndExpand
+		 *        struct is padding (which isn't passed).
+		 */
+		static bool isPaddingForCoerceAndExpand(const Type type) {
+			return type.isArray() && type.arrayElementType() == Int8Ty;
+		}
+		
 		ArgInfoKind getKind() const { return kind; }
 		bool isDirect() const { return kind == Direct; }
 		bool isInAlloca() const { return kind == InAlloca; }
@@ -172,6 +242,7 @@ namespace llvm_abi {
 		bool isIgnore() const { return kind == Ignore; }
 		bool isIndirect() const { return kind == Indirect; }
 		bool isExpand() const { return kind == Expand; }
+		bool isCoerceAndExpand() const { return kind == CoerceAndExpand; }
 		
 		bool canHaveCoerceToType() const { return isDirect() || isExtend(); }
 		
@@ -218,6 +289,45 @@ namespace llvm_abi {
 			typeData = type;
 		}
 		
+		// CoerceAndExpand accessors
+		Type getCoerceAndExpandType() const {
+			assert(isCoerceAndExpand() && "Invalid kind!");
+			return typeData;
+		}
+		
+		Type getUnpaddedCoerceAndExpandType() const {
+			assert(isCoerceAndExpand() && "Invalid kind!");
+			return unpaddedCoerceAndExpandType;
+		}
+		
+		/**
+		 * \brief Get the types of the values passed for a
+		 *        CoerceAndExpand type.
+		 * 
+		 * These are the non-padding members of the coerced
+		 * struct, in order.
+		 */
+		llvm::SmallVector<Type, 2> getCoerceAndExpandTypeSequence() const {
+			const auto unpaddedType = getUnpaddedCoerceAndExpandType();
+			llvm::SmallVector<Type, 2> types;
+			if (unpaddedType.isStruct()) {
+				for (const auto& member: unpaddedType.structMembers()) {
+					types.push_back(member.type());
+				}
+			} else {
+				types.push_back(unpaddedType);
+			}
+			return types;
+		}
+		
+		void setCoerceAndExpandType(const Type coerceToType,
+		                            const Type unpaddedCoerceToType) {
+			assert(isCoerceAndExpand() && "Invalid kind!");
+			assert(coerceToType.isStruct());
+			typeData = coerceToType;
+			unpaddedCoerceAndExpandType = unpaddedCoerceToType;
+		}
+		
 		bool getInReg() const {
 			assert((isDirect() || isExtend() || isIndirect()) && "Invalid kind!");
 			return inReg;
@@ -259,6 +369,34 @@ namespace llvm_abi {
 			indirectRealign = IR;
 		}
 
+		IndirectReason getIndirectReason() const {
+			assert(isIndirect() && "Invalid kind!");
+			return indirectReason;
+		}
+		
+		void setIndirectReason(IndirectReason reason) {
+			assert(isIndirect() && "Invalid kind!");
+			indirectReason = reason;
+		}
+		
+		const char* getIndirectReasonString() const {
+			switch (getIndirectReason()) {
+				case ABIRequired:
+					return "required by ABI";
+				case RegistersExhausted:
+					return "registers exhausted";
+				case TooLarge:
+					return "too large";
+				case UnalignedFields:
+					return "unaligned fields";
+				case X87Value:
+					return "x87 value";
+				case X87UpWithoutX87:
+					return "X87UP without X87";
+			}
+			return "unknown";
+		}
+		
 		bool isSRetAfterThis() const {
 			assert(isIndirect() && "Invalid kind!");
 			return sRetAfterThis;
@@ -321,11 +459,16 @@ namespace llvm_abi {
 			case Indirect:
 				OS << "Indirect Align=" << getIndirectAlign()
 					 << " ByVal=" << getIndirectByVal()
-					 << " Realign=" << getIndirectRealign();
+					 << " Realign=" << getIndirectRealign()
+					 << " Reason=" << getIndirectReasonString();
 				break;
 			case Expand:
 				OS << "Expand";
 				break;
+			case CoerceAndExpand:
+				OS << "CoerceAndExpand Type=";
+				OS << getCoerceAndExpandType().toString();
+				break;
 			}
 			OS << ")\n";
 			return OS.str();
@@ -1,13 +1,23 @@
 #ifndef LLVMABI_CALLEE_HPP
 #define LLVMABI_CALLEE_HPP
 
+#include <cstdint>
+
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/Value.h>
 
 #include <llvm-abi/FunctionType.hpp>
 
+namespace llvm {
+	
+	class GlobalVariable;
+	
+}
+
 namespace llvm_abi {
 	
+	class ABIProfiler;
+	struct ABIProfileCounts;
 	class ABITypeInfo;
 	class Builder;
 	class FunctionIRMapping;
@@ -22,7 +32,8 @@ namespace llvm_abi {
 		Callee(const ABITypeInfo& typeInfo,
 		       const FunctionType& functionType,
 		       const FunctionIRMapping& functionIRMapping,
-		       Builder& builder);
+		       Builder& builder,
+		       ABIProfiler* profiler = nullptr);
 		
 		/**
 		 * \brief Decode function arguments.
@@ -39,10 +50,15 @@ namespace llvm_abi {
 		                  llvm::Value* returnValuePtr = nullptr);
 		
 	private:
+		void emitProfileUpdates(uint64_t numCalls,
+		                        const ABIProfileCounts& profileCounts);
+		
 		const ABITypeInfo& typeInfo_;
 		FunctionType functionType_;
 		const FunctionIRMapping& functionIRMapping_;
 		Builder& builder_;
+		ABIProfiler* profiler_;
+		llvm::GlobalVariable* profileSite_;
 		
 	};
 	
@@ -1,14 +1,24 @@
 #ifndef LLVMABI_CALLER_HPP
 #define LLVMABI_CALLER_HPP
 
+#include <cstdint>
+
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/Value.h>
 
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/TypedValue.hpp>
 
+namespace llvm {
+	
+	class GlobalVariable;
+	
+}
+
 namespace llvm_abi {
 	
+	class ABIProfiler;
+	struct ABIProfileCounts;
 	class ABITypeInfo;
 	class Builder;
 	class FunctionIRMapping;
@@ -23,7 +33,8 @@ namespace llvm_abi {
 		Caller(const ABITypeInfo& typeInfo,
 		       const FunctionType& functionType,
 		       const FunctionIRMapping& functionIRMapping,
-		       Builder& builder);
+		       Builder& builder,
+		       ABIProfiler* profiler = nullptr);
 		
 		/**
 		 * \brief Encode function arguments.
@@ -49,10 +60,15 @@ namespace llvm_abi {
 		                  llvm::Value* returnValuePtr = nullptr);
 		
 	private:
+		void emitProfileUpdates(uint64_t numCalls,
+		                        const ABIProfileCounts& profileCounts);
+		
 		const ABITypeInfo& typeInfo_;
 		FunctionType functionType_;
 		const FunctionIRMapping& functionIRMapping_;
 		Builder& builder_;
+		ABIProfiler* profiler_;
+		llvm::GlobalVariable* profileSite_;
 		
 	};
 	
@@ -50,7 +50,23 @@ namespace llvm_abi {
 		 * \brief MSVC calling convention that passes vectors and
 		 *        vector aggregates in SSE registers.
 		 */
-		CC_VectorCall
+		CC_VectorCall,
+		
+		/**
+		 * \brief Intel calling convention that passes more
+		 *        arguments, and structs field by field, in
+		 *        registers.
+		 */
+		CC_RegCall,
+		
+		/**
+		 * \brief Internal fast calling convention, for functions
+		 *        that are never called from C.
+		 * 
+		 * Aggregates are flattened into registers as far as the
+		 * target's register file allows. Maps to LLVM's 'fastcc'.
+		 */
+		CC_Fast
 	};
 	
 	inline const char*
@@ -72,6 +88,10 @@ namespace llvm_abi {
 				return "pascal";
 			case CC_VectorCall:
 				return "vectorcall";
+			case CC_RegCall:
+				return "regcall";
+			case CC_Fast:
+				return "fastcc";
 		}
 		llvm_unreachable("Unknown calling convention.");
 	}
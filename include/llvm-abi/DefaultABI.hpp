@@ -0,0 +1,75 @@
+#ifndef LLVMABI_DEFAULTABI_HPP
+#define LLVMABI_DEFAULTABI_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/IR/Value.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/DefaultABITypeInfo.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief Default ABI
+	 * 
+	 * This class implements the ABI interface for any ABITarget,
+	 * which plans how functions are passed; this class just emits
+	 * IR for those plans in the module's LLVMContext.
+	 */
+	class DefaultABI: public ABI, private DefaultABITypeInfoDelegate {
+	public:
+		DefaultABI(llvm::Module* module,
+		           std::shared_ptr<const ABITarget> target);
+		~DefaultABI();
+		
+		std::string name() const;
+		
+		const ABITypeInfo& typeInfo() const;
+		
+		llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+		
+		llvm::FunctionType* getFunctionType(const FunctionType& functionType) const;
+		
+		llvm::AttributeList getAttributes(const FunctionType& functionType,
+		                                  llvm::ArrayRef<Type> argumentTypes,
+		                                  llvm::AttributeList existingAttributes) const;
+		
+		ABICallCost getCallCost(const FunctionType& functionType,
+		                        llvm::ArrayRef<Type> argumentTypes) const;
+		
+		llvm::Value* createCall(Builder& builder,
+		                        const FunctionType& functionType,
+		                        std::function<llvm::Value* (llvm::ArrayRef<llvm::Value*>)> callBuilder,
+		                        llvm::ArrayRef<TypedValue> arguments) const;
+		
+		std::unique_ptr<FunctionEncoder>
+		createFunctionEncoder(Builder& builder,
+		                      const FunctionType& functionType,
+		                      llvm::ArrayRef<llvm::Value*> arguments) const;
+		
+		/**
+		 * \brief Get the target that plans calls for this ABI.
+		 */
+		const ABITarget& target() const;
+	
+	private:
+		llvm::Type* getLongDoubleIRType() const;
+		
+		std::shared_ptr<const ABITarget> target_;
+		llvm::LLVMContext& llvmContext_;
+		DefaultABITypeInfo typeInfo_;
+	
+	};
+
+}
+
+#endif
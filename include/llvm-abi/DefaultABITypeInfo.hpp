@@ -4,31 +4,20 @@
 #include <map>
 #include <string>
 
+#include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Type.h>
 
+#include <llvm-abi/ABITypeInfo.hpp>
+
 namespace llvm_abi {
 	
+	class ABITypeLayout;
 	class DataSize;
 	class RecordMember;
 	class Type;
 	
 	class DefaultABITypeInfoDelegate {
 	public:
-		virtual DataSize getPointerSize() const = 0;
-		virtual DataSize getPointerAlign() const = 0;
-		
-		virtual DataSize getIntSize(IntegerKind kind) const = 0;
-		virtual DataSize getIntAlign(IntegerKind kind) const = 0;
-		
-		virtual DataSize getFloatSize(FloatingPointKind kind) const = 0;
-		virtual DataSize getFloatAlign(FloatingPointKind kind) const = 0;
-		
-		virtual DataSize getComplexSize(FloatingPointKind kind) const = 0;
-		virtual DataSize getComplexAlign(FloatingPointKind kind) const = 0;
-		
-		virtual DataSize getArrayAlign(Type type) const = 0;
-		virtual DataSize getVectorAlign(Type type) const = 0;
-		
 		virtual llvm::Type* getLongDoubleIRType() const = 0;
 		
 	protected:
@@ -40,55 +29,52 @@ namespace llvm_abi {
 	/**
 	 * \brief Default ABI Type Information
 	 * 
-	 * This class contains ABI type information functionality that is
-	 * typically common to all ABIs, such as how to layout structs.
+	 * This class provides ABI type information for an LLVMContext
+	 * on top of a (context-free) ABI type layout, which answers all
+	 * size and alignment queries. It contains the mapping from ABI
+	 * types to LLVM types that is typically common to all ABIs.
 	 */
-	class DefaultABITypeInfo {
+	class DefaultABITypeInfo: public ABITypeInfo {
 	public:
 		DefaultABITypeInfo(llvm::LLVMContext& llvmContext,
-		                   const ABITypeInfo& typeInfo,
+		                   const ABITypeLayout& typeLayout,
 		                   const DefaultABITypeInfoDelegate& delegate);
 		~DefaultABITypeInfo();
 		
 		/**
-		 * \brief Get the size of a type for this ABI.
+		 * \brief Get the underlying type layout.
 		 * 
-		 * \param type The ABI type.
-		 * \return The size of the type.
+		 * \return The ABI type layout.
 		 */
-		DataSize getDefaultTypeRawSize(Type type) const;
+		const ABITypeLayout& typeLayout() const;
 		
-		/**
-		 * \brief Get the allocation size of a type for this ABI.
-		 * 
-		 * \param type The ABI type.
-		 * \return The size of the type.
-		 */
-		DataSize getDefaultTypeAllocSize(Type type) const;
+		const TypeBuilder& typeBuilder() const;
 		
-		/**
-		 * \brief Get the store size of a type for this ABI.
-		 * 
-		 * \param type The ABI type.
-		 * \return The size of the type.
-		 */
-		DataSize getDefaultTypeStoreSize(Type type) const;
+		DataSize getTypeRawSize(Type type) const;
 		
-		/**
-		 * \brief Get the required alignment of a type for this ABI.
-		 * 
-		 * \param type The ABI type.
-		 * \return The alignment of the type.
-		 */
-		DataSize getDefaultTypeRequiredAlign(Type type) const;
+		DataSize getTypeAllocSize(Type type) const;
 		
-		/**
-		 * \brief Get the preferred alignment of a type for this ABI.
-		 * 
-		 * \param type The ABI type.
-		 * \return The alignment of the type.
-		 */
-		DataSize getDefaultTypePreferredAlign(Type type) const;
+		DataSize getTypeStoreSize(Type type) const;
+		
+		DataSize getTypeRequiredAlign(Type type) const;
+		
+		DataSize getTypePreferredAlign(Type type) const;
+		
+		llvm::Type* getLLVMType(Type type) const;
+		
+		llvm::SmallVector<DataSize, 8>
+		calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+		
+		bool isLegalVectorType(Type type) const;
+		
+		bool isBigEndian() const;
+		
+		bool isCharSigned() const;
+		
+		bool isHomogeneousAggregateBaseType(Type type) const;
+		
+		bool isHomogeneousAggregateSmallEnough(Type base,
+		                                       uint64_t members) const;
 		
 		/**
 		 * \brief Get LLVM struct type with name and member types.
@@ -108,18 +94,9 @@ namespace llvm_abi {
 		 */
 		llvm::Type* getDefaultLLVMType(Type type) const;
 		
-		/**
-		 * \brief Create an array of offsets based on struct member types.
-		 * 
-		 * \param structMembers The member types of the struct.
-		 * \return The offsets of each member of the struct.
-		 */
-		llvm::SmallVector<DataSize, 8>
-		calculateDefaultStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
-		
 	private:
 		llvm::LLVMContext& llvmContext_;
-		const ABITypeInfo& typeInfo_;
+		const ABITypeLayout& typeLayout_;
 		const DefaultABITypeInfoDelegate& delegate_;
 		mutable std::map<std::string, llvm::StructType*> structTypes_;
 		
@@ -0,0 +1,117 @@
+#ifndef LLVMABI_DEFAULTABITYPELAYOUT_HPP
+#define LLVMABI_DEFAULTABITYPELAYOUT_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	class ABITypeLayout;
+	class DataSize;
+	class RecordMember;
+	
+	class DefaultABITypeLayoutDelegate {
+	public:
+		virtual DataSize getPointerSize() const = 0;
+		virtual DataSize getPointerAlign() const = 0;
+		
+		virtual DataSize getIntSize(IntegerKind kind) const = 0;
+		virtual DataSize getIntAlign(IntegerKind kind) const = 0;
+		
+		virtual DataSize getFloatSize(FloatingPointKind kind) const = 0;
+		virtual DataSize getFloatAlign(FloatingPointKind kind) const = 0;
+		
+		virtual DataSize getComplexSize(FloatingPointKind kind) const = 0;
+		virtual DataSize getComplexAlign(FloatingPointKind kind) const = 0;
+		
+		virtual DataSize getArrayAlign(Type type) const = 0;
+		virtual DataSize getVectorAlign(Type type) const = 0;
+		
+	protected:
+		// Prevent destructor call via this class.
+		~DefaultABITypeLayoutDelegate() { }
+		
+	};
+	
+	/**
+	 * \brief Default ABI Type Layout
+	 * 
+	 * This class contains ABI type layout functionality that is
+	 * typically common to all ABIs, such as how to layout structs.
+	 * 
+	 * If an ABICache is given, raw sizes and required alignments of
+	 * aggregate types are stored in (and retrieved from) the cache.
+	 */
+	class DefaultABITypeLayout {
+	public:
+		DefaultABITypeLayout(const ABITypeLayout& typeLayout,
+		                     const DefaultABITypeLayoutDelegate& delegate,
+		                     const ABICache* cache = nullptr);
+		~DefaultABITypeLayout();
+		
+		/**
+		 * \brief Get the size of a type for this ABI.
+		 * 
+		 * \param type The ABI type.
+		 * \return The size of the type.
+		 */
+		DataSize getDefaultTypeRawSize(Type type) const;
+		
+		/**
+		 * \brief Get the allocation size of a type for this ABI.
+		 * 
+		 * \param type The ABI type.
+		 * \return The size of the type.
+		 */
+		DataSize getDefaultTypeAllocSize(Type type) const;
+		
+		/**
+		 * \brief Get the store size of a type for this ABI.
+		 * 
+		 * \param type The ABI type.
+		 * \return The size of the type.
+		 */
+		DataSize getDefaultTypeStoreSize(Type type) const;
+		
+		/**
+		 * \brief Get the required alignment of a type for this ABI.
+		 * 
+		 * \param type The ABI type.
+		 * \return The alignment of the type.
+		 */
+		DataSize getDefaultTypeRequiredAlign(Type type) const;
+		
+		/**
+		 * \brief Get the preferred alignment of a type for this ABI.
+		 * 
+		 * \param type The ABI type.
+		 * \return The alignment of the type.
+		 */
+		DataSize getDefaultTypePreferredAlign(Type type) const;
+		
+		/**
+		 * \brief Create an array of offsets based on struct member types.
+		 * 
+		 * \param structMembers The member types of the struct.
+		 * \return The offsets of each member of the struct.
+		 */
+		llvm::SmallVector<DataSize, 8>
+		calculateDefaultStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+		
+	private:
+		DataSize computeDefaultTypeRawSize(Type type) const;
+		
+		DataSize computeDefaultTypeRequiredAlign(Type type) const;
+		
+		const ABITypeLayout& typeLayout_;
+		const DefaultABITypeLayoutDelegate& delegate_;
+		const ABICache* cache_;
+		
+	};
+
+}
+
+#endif
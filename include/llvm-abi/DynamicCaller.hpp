@@ -0,0 +1,176 @@
+#ifndef LLVMABI_DYNAMICCALLER_HPP
+#define LLVMABI_DYNAMICCALLER_HPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/DynamicClosure.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm {
+	
+	class ExecutionEngine;
+	class LLVMContext;
+
+}
+
+namespace llvm_abi {
+	
+	class ABITarget;
+	class TypeBuilder;
+	
+	/**
+	 * \brief Dynamic Caller
+	 *
+	 * Calls native functions whose signatures are only known at
+	 * run time (as libffi does), on the host.
+	 *
+	 * For each signature, a 'thunk' is JIT-compiled (with MCJIT)
+	 * which loads the arguments from memory, calls the function
+	 * via ABI::createCall() and stores the return value. Thunks
+	 * are cached by signature, so after the first call of a
+	 * signature a call only costs calling the thunk.
+	 *
+	 * In the other direction, it creates closures: native
+	 * functions with a given signature that forward their
+	 * arguments to a generic handler (see DynamicClosure).
+	 *
+	 * Aggregate types must be built with typeBuilder(), which
+	 * makes signatures cheap to compare.
+	 *
+	 * All methods are thread-safe.
+	 */
+	class DynamicCaller {
+	public:
+		/**
+		 * \brief Thunk function.
+		 *
+		 * \param function The function to call.
+		 * \param returnValue Memory for the return value (in
+		 *                    native layout), or NULL for a void
+		 *                    return type.
+		 * \param arguments Pointers to each argument (in native
+		 *                  layout).
+		 */
+		typedef void (*Thunk)(void* function, void* returnValue,
+		                      void* const* arguments);
+		
+		/**
+		 * \brief Create a dynamic caller for the host.
+		 *
+		 * Code is generated for the host's CPU and features.
+		 */
+		DynamicCaller();
+		~DynamicCaller();
+		
+		/**
+		 * \brief Get the type builder for argument and return types.
+		 *
+		 * \return The type builder.
+		 */
+		const TypeBuilder& typeBuilder() const;
+		
+		/**
+		 * \brief Get (or compile) the thunk for a signature.
+		 *
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The argument types (including varargs).
+		 * \return The thunk.
+		 */
+		Thunk getThunk(const FunctionType& functionType,
+		               llvm::ArrayRef<Type> argumentTypes);
+		
+		Thunk getThunk(const FunctionType& functionType) {
+			return getThunk(functionType, functionType.argumentTypes());
+		}
+		
+		/**
+		 * \brief Call a function.
+		 *
+		 * \param functionType The ABI function type.
+		 * \param argumentTypes The argument types (including varargs).
+		 * \param function The function to call.
+		 * \param returnValue Memory for the return value, or NULL
+		 *                    for a void return type.
+		 * \param arguments Pointers to each argument.
+		 */
+		void call(const FunctionType& functionType,
+		          llvm::ArrayRef<Type> argumentTypes,
+		          void* function, void* returnValue,
+		          void* const* arguments);
+		
+		void call(const FunctionType& functionType,
+		          void* function, void* returnValue,
+		          void* const* arguments) {
+			call(functionType, functionType.argumentTypes(),
+			     function, returnValue, arguments);
+		}
+		
+		/**
+		 * \brief Create a closure.
+		 *
+		 * Closures are only supported on x86 hosts, since they
+		 * rely on LLVM's trampoline intrinsics; varargs signatures
+		 * aren't supported.
+		 *
+		 * \param functionType The ABI function type.
+		 * \param handler The handler for calls of the closure.
+		 * \param userData The user data passed to the handler.
+		 * \return The closure.
+		 */
+		std::unique_ptr<DynamicClosure> createClosure(const FunctionType& functionType,
+		                                              DynamicClosure::Handler handler,
+		                                              void* userData);
+		
+		/**
+		 * \brief Get the number of thunks compiled.
+		 */
+		size_t numThunks() const;
+		
+		/**
+		 * \brief Get the number of closure signatures compiled.
+		 */
+		size_t numClosureSignatures() const;
+	
+	private:
+		// Non-copyable.
+		DynamicCaller(const DynamicCaller&) = delete;
+		DynamicCaller& operator=(const DynamicCaller&) = delete;
+		
+		struct SignatureKey {
+			CallingConvention callingConvention;
+			bool isVarArg;
+			size_t numFixedArguments;
+			llvm::SmallVector<Type, 8> types;
+			
+			bool operator<(const SignatureKey& other) const;
+		};
+		
+		SignatureKey getSignatureKey(const FunctionType& functionType,
+		                     llvm::ArrayRef<Type> argumentTypes) const;
+		
+		Thunk compileThunk(const FunctionType& functionType,
+		                   llvm::ArrayRef<Type> argumentTypes);
+		
+		DynamicClosure::InitFunction compileClosure(const FunctionType& functionType);
+		
+		std::shared_ptr<ABITarget> target_;
+		std::unique_ptr<llvm::LLVMContext> context_;
+		std::unique_ptr<llvm::ExecutionEngine> engine_;
+		mutable std::mutex mutex_;
+		std::map<SignatureKey, Thunk> thunks_;
+		std::map<SignatureKey, DynamicClosure::InitFunction> closures_;
+	
+	};
+
+}
+
+#endif
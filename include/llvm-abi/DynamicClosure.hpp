@@ -0,0 +1,77 @@
+#ifndef LLVMABI_DYNAMICCLOSURE_HPP
+#define LLVMABI_DYNAMICCLOSURE_HPP
+
+#include <llvm/Support/Memory.h>
+
+namespace llvm_abi {
+	
+	class DynamicCaller;
+	
+	/**
+	 * \brief Dynamic Closure
+	 *
+	 * A native function, created by DynamicCaller::createClosure(),
+	 * which forwards its arguments to a generic handler.
+	 *
+	 * The code for each signature is compiled once and shared
+	 * by its closures; each closure just has a small trampoline
+	 * which binds its handler and user data. The closure (and
+	 * its function) lives until it is destroyed.
+	 */
+	class DynamicClosure {
+	public:
+		/**
+		 * \brief Handler function.
+		 *
+		 * \param userData The user data given for the closure.
+		 * \param arguments Pointers to each argument (in native
+		 *                  layout).
+		 * \param returnValue Memory for the return value (in
+		 *                    native layout), or NULL for a void
+		 *                    return type.
+		 */
+		typedef void (*Handler)(void* userData, void** arguments,
+		                        void* returnValue);
+		
+		~DynamicClosure();
+		
+		/**
+		 * \brief Get the closure's native function.
+		 *
+		 * \return The function, which has the closure's signature.
+		 */
+		void* function() const;
+		
+		Handler handler() const;
+		
+		void* userData() const;
+	
+	private:
+		friend class DynamicCaller;
+		
+		// Initialises a trampoline for the signature's code,
+		// returning the function pointer.
+		typedef void* (*InitFunction)(void* trampoline, void* data);
+		
+		DynamicClosure(InitFunction initFunction,
+		               Handler pHandler, void* pUserData);
+		
+		// Non-copyable.
+		DynamicClosure(const DynamicClosure&) = delete;
+		DynamicClosure& operator=(const DynamicClosure&) = delete;
+		
+		// Read by the generated code.
+		struct Data {
+			Handler handler;
+			void* userData;
+		};
+		
+		Data data_;
+		llvm::sys::MemoryBlock trampoline_;
+		void* function_;
+	
+	};
+
+}
+
+#endif
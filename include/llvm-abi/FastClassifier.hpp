@@ -0,0 +1,62 @@
+#ifndef LLVMABI_FASTCLASSIFIER_HPP
+#define LLVMABI_FASTCLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	class ABITypeLayout;
+	
+	/**
+	 * \brief Fast Classifier
+	 * 
+	 * Classifies functions using the internal fast calling
+	 * convention (CC_Fast), which only has to agree with itself.
+	 * Aggregates are flattened into scalar arguments and returned
+	 * as multiple values for as long as the target's register
+	 * file allows; only beyond that are they passed by reference
+	 * or returned via a hidden pointer.
+	 */
+	class FastClassifier {
+	public:
+		FastClassifier(const ABITypeLayout& typeLayout,
+		               const llvm::Triple& targetTriple);
+		
+		ArgInfo classifyReturnType(Type returnType,
+		                           unsigned& freeIntRegs) const;
+		
+		ArgInfo classifyArgumentType(Type argumentType,
+		                             unsigned& freeIntRegs,
+		                             unsigned& freeFPRegs) const;
+		
+		llvm::SmallVector<ArgInfo, 8>
+		classifyFunctionType(const FunctionType& functionType,
+		                     llvm::ArrayRef<Type> argumentTypes) const;
+	
+	private:
+		bool countRegisters(Type type,
+		                    unsigned& neededInt,
+		                    unsigned& neededFP) const;
+		
+		Type getIntegerChunks(Type type,
+		                      unsigned& neededInt) const;
+		
+		const ABITypeLayout& typeLayout_;
+		DataSize registerSize_;
+		unsigned intRegs_;
+		unsigned fpRegs_;
+		unsigned returnIntRegs_;
+		unsigned returnFPRegs_;
+	
+	};
+
+}
+
+#endif
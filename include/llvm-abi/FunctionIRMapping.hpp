@@ -1,7 +1,12 @@
 #ifndef LLVMABI_FUNCTIONIRMAPPING_HPP
 #define LLVMABI_FUNCTIONIRMAPPING_HPP
 
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/LLVMContext.h>
+
 #include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/ArgInfo.hpp>
 #include <llvm-abi/ArgumentIRMapping.hpp>
 #include <llvm-abi/FunctionType.hpp>
@@ -140,13 +145,29 @@ namespace llvm_abi {
 	/**
 	 * \brief Get function IR mapping.
 	 * 
+	 * \param typeLayout The ABI type layout.
 	 * \param argInfoArray The ArgInfo values for each argument.
 	 * \return The mapping from ABI arguments to IR arguments.
 	 */
 	FunctionIRMapping
-	getFunctionIRMapping(const ABITypeInfo& typeInfo,
+	getFunctionIRMapping(const ABITypeLayout& typeLayout,
 	                     llvm::ArrayRef<ArgInfo> argInfoArray);
 	
+	/**
+	 * \brief Query whether a direct value is passed without coercion.
+	 * 
+	 * This is the case if the value is passed as its own IR type,
+	 * so it doesn't have to go through memory.
+	 * 
+	 * \param typeLayout The ABI type layout.
+	 * \param type The ABI type of the value.
+	 * \param argInfo The (direct or extended) ArgInfo of the value.
+	 * \return Whether the value is passed as is.
+	 */
+	bool isTrivialCoercion(const ABITypeLayout& typeLayout,
+	                       Type type,
+	                       const ArgInfo& argInfo);
+	
 	/**
 	 * \brief Get LLVM function type.
 	 * 
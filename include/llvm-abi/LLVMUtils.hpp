@@ -1,12 +1,18 @@
 #ifndef LLVMABI_LLVMUTILS_HPP
 #define LLVMABI_LLVMUTILS_HPP
 
+#include <string>
+
+#include <llvm/ADT/StringRef.h>
 #include <llvm/IR/Value.h>
 
+#include <llvm-abi/DataSize.hpp>
+
 namespace llvm_abi {
 	
 	class ABITypeInfo;
 	class Builder;
+	class FunctionType;
 	
 	llvm::AllocaInst* createTempAlloca(const ABITypeInfo& typeInfo,
 	                                   Builder& builder,
@@ -31,6 +37,35 @@ namespace llvm_abi {
 	                             llvm::Value* ptr, unsigned idx,
 	                             const llvm::Twine& name = "");
 	
+	/**
+	 * \brief Emit a remark for a value passed through memory.
+	 * 
+	 * Emits a missed-optimization remark (pass name
+	 * 'llvm-abi') in the function currently being built,
+	 * so that '-pass-remarks-missed=llvm-abi' or a remarks
+	 * file shows where values lose register passing.
+	 * 
+	 * \param argumentNumber The argument index, or -1 for
+	 *                       the return value.
+	 */
+	void emitMemoryRemark(Builder& builder,
+	                      llvm::StringRef remarkName,
+	                      int argumentNumber,
+	                      Type type,
+	                      llvm::StringRef reason,
+	                      DataSize bytes);
+	
+	/**
+	 * \brief Get the name of a profiling site.
+	 * 
+	 * The name identifies the function currently being built,
+	 * the kind of site (e.g. 'call') and its function type, along
+	 * with the current debug location if there is one.
+	 */
+	std::string getProfileSiteName(Builder& builder,
+	                               llvm::StringRef kind,
+	                               const FunctionType& functionType);
+
 }
 
 #endif
\ No newline at end of file
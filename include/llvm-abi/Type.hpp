@@ -67,7 +67,7 @@ namespace llvm_abi {
 	};
 	
 	// Forward declaration.
-	class ABITypeInfo;
+	class ABITypeLayout;
 	class RecordMember;
 	class TypeBuilder;
 	
@@ -256,11 +256,11 @@ namespace llvm_abi {
 			 * array members are never considered single element
 			 * structs.
 			 * 
-			 * \param typeInfo ABI Type Information.
+			 * \param typeLayout ABI Type Layout.
 			 * \return The type for the single non-empty field, if
 			 * it exists, or VoidTy otherwise.
 			 */
-			Type getStructSingleElement(const ABITypeInfo& typeInfo) const;
+			Type getStructSingleElement(const ABITypeLayout& typeLayout) const;
 			
 			/**
 			 * \brief Query if a structure contains only empty fields.
@@ -280,13 +280,13 @@ namespace llvm_abi {
 			 * 
 			 * It is conservatively correct to return false.
 			 * 
-			 * \param typeInfo ABI Type Information.
+			 * \param typeLayout ABI Type Layout.
 			 * \param startBit Start of bit range.
 			 * \param endBit End of bit range.
 			 * \return Whether the specified bit range is known to
 			 *         not contain user data.
 			 */
-			bool bitsContainNoUserData(const ABITypeInfo& typeInfo,
+			bool bitsContainNoUserData(const ABITypeLayout& typeLayout,
 			                           size_t startBit,
 			                           size_t endBit) const;
 			
@@ -307,18 +307,28 @@ namespace llvm_abi {
 			 * Argument 'base' is set to the base element type, and
 			 * 'members' is set to the number of base elements.
 			 */
-			bool isHomogeneousAggregate(const ABITypeInfo& typeInfo,
+			bool isHomogeneousAggregate(const ABITypeLayout& typeLayout,
 			                            Type& base,
 			                            uint64_t& members) const;
 			
-			bool hasUnalignedFields(const ABITypeInfo& typeInfo) const;
+			bool hasUnalignedFields(const ABITypeLayout& typeLayout) const;
 			
-			bool hasSignedIntegerRepresentation(const ABITypeInfo& typeInfo) const;
+			bool hasSignedIntegerRepresentation(const ABITypeLayout& typeLayout) const;
 			
-			bool hasUnsignedIntegerRepresentation(const ABITypeInfo& typeInfo) const;
+			bool hasUnsignedIntegerRepresentation(const ABITypeLayout& typeLayout) const;
 			
 			size_t hash() const;
 			
+			/**
+			 * \brief Queries whether type is uniqued by a type builder.
+			 * 
+			 * Types that aren't uniqued (e.g. int) always return true.
+			 * 
+			 * \param typeBuilder The type builder.
+			 * \return Whether the type builder owns this type.
+			 */
+			bool isUniquedBy(const TypeBuilder& typeBuilder) const;
+			
 			std::string toString() const;
 			
 			struct TypeData;
@@ -484,6 +494,10 @@ namespace llvm_abi {
 	};
 	
 	struct Type::TypeData {
+		// The builder that uniqued this type data, so that
+		// Type::isUniquedBy() doesn't need to look it up.
+		const TypeBuilder* builder;
+		
 		struct {
 			std::string name;
 			llvm::SmallVector<RecordMember, 8> members;
@@ -505,6 +519,9 @@ namespace llvm_abi {
 			: elementCount(0) { }
 		} vectorType;
 		
+		TypeData()
+		: builder(nullptr) { }
+		
 		bool operator<(const TypeData& other) const {
 			if (recordType.name != other.recordType.name) {
 				return recordType.name < other.recordType.name;
@@ -1,6 +1,8 @@
 #ifndef LLVMABI_TYPEBUILDER_HPP
 #define LLVMABI_TYPEBUILDER_HPP
 
+#include <cstddef>
+#include <mutex>
 #include <set>
 
 #include <llvm-abi/Type.hpp>
@@ -56,7 +58,17 @@ namespace llvm_abi {
 			TypeBuilder(const TypeBuilder&) = delete;
 			TypeBuilder& operator=(const TypeBuilder&) = delete;
 			
-			mutable std::set<Type::TypeData> typeDataSet_;
+			// Builders can be shared between threads (see ABICache),
+			// so type data is spread over independently locked
+			// shards by its hash.
+			static const size_t NumShards = 16;
+			
+			struct Shard {
+				std::mutex mutex;
+				std::set<Type::TypeData> typeDataSet;
+			};
+			
+			mutable Shard shards_[NumShards];
 			
 	};
 	
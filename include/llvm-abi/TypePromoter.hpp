@@ -6,6 +6,7 @@
 namespace llvm_abi {
 	
 	class ABITypeInfo;
+	class ABITypeLayout;
 	class Builder;
 	class FunctionType;
 	
@@ -14,9 +15,14 @@ namespace llvm_abi {
 	 * 
 	 * This class handles promoting types as required in cases such as
 	 * passing varargs arguments.
+	 * 
+	 * Promoting types only needs the ABI type layout; promoting
+	 * values also needs the ABI type information.
 	 */
 	class TypePromoter {
 	public:
+		TypePromoter(const ABITypeLayout& typeLayout);
+		
 		TypePromoter(const ABITypeInfo& typeInfo);
 		
 		TypedValue promoteValue(Builder& builder,
@@ -38,7 +44,10 @@ namespace llvm_abi {
 		                 llvm::ArrayRef<TypedValue> arguments) const;
 		
 	private:
-		const ABITypeInfo& typeInfo_;
+		const ABITypeInfo& typeInfo() const;
+		
+		const ABITypeLayout& typeLayout_;
+		const ABITypeInfo* typeInfo_;
 		
 	};
 	
@@ -0,0 +1,52 @@
+#ifndef LLVMABI_AARCH64_AARCH64ABITARGET_HPP
+#define LLVMABI_AARCH64_AARCH64ABITARGET_HPP
+
+#include <memory>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/aarch64/AArch64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace aarch64 {
+		
+		/**
+		 * \brief AArch64 ABI Target
+		 */
+		class AArch64ABITarget: public ABITarget {
+		public:
+			AArch64ABITarget(const llvm::Triple& targetTriple);
+			~AArch64ABITarget();
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			const AArch64ABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			AArch64ABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
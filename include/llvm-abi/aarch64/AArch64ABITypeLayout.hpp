@@ -0,0 +1,90 @@
+#ifndef LLVMABI_AARCH64_AARCH64ABITYPELAYOUT_HPP
+#define LLVMABI_AARCH64_AARCH64ABITYPELAYOUT_HPP
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace aarch64 {
+		
+		/**
+		 * \brief AArch64 ABI Type Layout
+		 * 
+		 * AAPCS64 uses the LP64 data model, with an unsigned 'char'
+		 * and a 128-bit IEEE quad 'long double'. Darwin (DarwinPCS)
+		 * differs in making 'char' signed and 'long double' the same
+		 * as 'double'.
+		 */
+		class AArch64ABITypeLayout: public ABITypeLayout,
+		                            public DefaultABITypeLayoutDelegate {
+		public:
+			AArch64ABITypeLayout(const llvm::Triple& targetTriple,
+			                     const ABICache* cache = nullptr);
+			
+			/**
+			 * \brief Query whether this is Apple's variant of AAPCS64.
+			 */
+			bool isDarwinPCS() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type type) const;
+			
+			bool isHomogeneousAggregateSmallEnough(Type base,
+			                                       uint64_t members) const;
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			bool isDarwinPCS_;
+			bool isBigEndian_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
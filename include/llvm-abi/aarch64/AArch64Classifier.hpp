@@ -0,0 +1,50 @@
+#ifndef LLVMABI_AARCH64_AARCH64CLASSIFIER_HPP
+#define LLVMABI_AARCH64_AARCH64CLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace aarch64 {
+		
+		class AArch64ABITypeLayout;
+		
+		/**
+		 * \brief AArch64 Classifier
+		 * 
+		 * Classifies arguments according to AAPCS64. Homogeneous
+		 * floating point and short-vector aggregates (HFAs/HVAs) of
+		 * up to four members go in consecutive V registers, other
+		 * composites of up to 16 bytes go in (a pair of) X registers
+		 * and larger composites are passed by reference.
+		 */
+		class AArch64Classifier {
+		public:
+			AArch64Classifier(const AArch64ABITypeLayout& typeLayout);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo classifyReturnType(Type returnType) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			const AArch64ABITypeLayout& typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
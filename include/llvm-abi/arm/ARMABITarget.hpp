@@ -0,0 +1,72 @@
+#ifndef LLVMABI_ARM_ARMABITARGET_HPP
+#define LLVMABI_ARM_ARMABITARGET_HPP
+
+#include <memory>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/arm/ARMABITypeLayout.hpp>
+#include <llvm-abi/arm/ARMClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace arm {
+		
+		/**
+		 * \brief Get the default ARM ABI kind for a triple.
+		 * 
+		 * Hard-float EABI environments (e.g. 'gnueabihf') use
+		 * AAPCS-VFP; everything else uses the base AAPCS.
+		 */
+		ARMABIKind getDefaultARMABIKind(const llvm::Triple& targetTriple);
+		
+		/**
+		 * \brief ARM ABI Target
+		 * 
+		 * Supports 32-bit ARM and Thumb (little and big endian)
+		 * with either the base (soft-float) AAPCS or the
+		 * hard-float AAPCS-VFP.
+		 */
+		class ARMABITarget: public ABITarget {
+		public:
+			ARMABITarget(const llvm::Triple& targetTriple);
+			ARMABITarget(const llvm::Triple& targetTriple,
+			             ARMABIKind abiKind);
+			~ARMABITarget();
+			
+			ARMABIKind abiKind() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+			
+			const ARMABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			ARMABIKind abiKind_;
+			ARMABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
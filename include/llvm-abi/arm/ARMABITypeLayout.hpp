@@ -0,0 +1,83 @@
+#ifndef LLVMABI_ARM_ARMABITYPELAYOUT_HPP
+#define LLVMABI_ARM_ARMABITYPELAYOUT_HPP
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace arm {
+		
+		/**
+		 * \brief ARM ABI Type Layout
+		 * 
+		 * AAPCS uses the ILP32 data model, with an unsigned 'char'
+		 * and a 'long double' that is the same as 'double'. 64-bit
+		 * types are 8-byte aligned, as are (at most) vectors.
+		 */
+		class ARMABITypeLayout: public ABITypeLayout,
+		                        public DefaultABITypeLayoutDelegate {
+		public:
+			ARMABITypeLayout(const llvm::Triple& targetTriple,
+			                 const ABICache* cache = nullptr);
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type type) const;
+			
+			bool isHomogeneousAggregateSmallEnough(Type base,
+			                                       uint64_t members) const;
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			bool isBigEndian_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef LLVMABI_ARM_ARMCLASSIFIER_HPP
+#define LLVMABI_ARM_ARMCLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace arm {
+		
+		class ARMABITypeLayout;
+		
+		enum ARMABIKind {
+			/**
+			 * \brief The base AAPCS, where floating point values
+			 *        are passed in core registers (soft-float).
+			 */
+			AAPCS,
+			
+			/**
+			 * \brief The AAPCS VFP variant, where floating point
+			 *        values and homogeneous aggregates are passed
+			 *        in VFP registers (hard-float).
+			 */
+			AAPCS_VFP
+		};
+		
+		/**
+		 * \brief ARM Classifier
+		 * 
+		 * Classifies arguments according to the AAPCS. Under the
+		 * VFP variant, homogeneous floating point and short-vector
+		 * aggregates of up to four members go in VFP registers;
+		 * everything else is coerced to an array of core register
+		 * sized integers (or of i64 for 8-byte aligned types, which
+		 * must start in an even register). Variadic functions always
+		 * use the base AAPCS.
+		 */
+		class ARMClassifier {
+		public:
+			ARMClassifier(const ARMABITypeLayout& typeLayout,
+			              ARMABIKind abiKind);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo coerceIllegalVector(Type type) const;
+			
+			ArgInfo classifyReturnType(Type returnType,
+			                           bool isVariadic) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType,
+			                             bool isVariadic) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			const ARMABITypeLayout& typeLayout_;
+			ARMABIKind abiKind_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
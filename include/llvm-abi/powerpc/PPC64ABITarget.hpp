@@ -0,0 +1,71 @@
+#ifndef LLVMABI_POWERPC_PPC64ABITARGET_HPP
+#define LLVMABI_POWERPC_PPC64ABITARGET_HPP
+
+#include <memory>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/powerpc/PPC64ABITypeLayout.hpp>
+#include <llvm-abi/powerpc/PPC64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace powerpc {
+		
+		/**
+		 * \brief Get the default 64-bit PowerPC ELF ABI version.
+		 * 
+		 * Little endian targets use ELFv2; big endian targets use
+		 * ELFv1, except for musl which uses ELFv2.
+		 */
+		PPC64ABIKind getDefaultPPC64ABIKind(const llvm::Triple& targetTriple);
+		
+		/**
+		 * \brief PPC64 ABI Target
+		 */
+		class PPC64ABITarget: public ABITarget {
+		public:
+			/**
+			 * \brief Create PPC64 ABI Target with the default ABI
+			 *        version and 'long double' format.
+			 */
+			PPC64ABITarget(const llvm::Triple& targetTriple);
+			PPC64ABITarget(const llvm::Triple& targetTriple,
+			               PPC64ABIKind abiKind,
+			               LongDoubleFormat longDoubleFormat);
+			~PPC64ABITarget();
+			
+			PPC64ABIKind abiKind() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			const PPC64ABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			PPC64ABIKind abiKind_;
+			PPC64ABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
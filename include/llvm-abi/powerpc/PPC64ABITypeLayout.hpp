@@ -0,0 +1,110 @@
+#ifndef LLVMABI_POWERPC_PPC64ABITYPELAYOUT_HPP
+#define LLVMABI_POWERPC_PPC64ABITYPELAYOUT_HPP
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace powerpc {
+		
+		/**
+		 * \brief 'long double' format.
+		 */
+		enum LongDoubleFormat {
+			// IBM extended precision: a pair of doubles (ppc_fp128).
+			LongDoubleIBM128,
+			
+			// IEEE quad precision (fp128).
+			LongDoubleIEEEQuad,
+			
+			// Same as 'double'.
+			LongDoubleIEEEDouble
+		};
+		
+		/**
+		 * \brief Get the default 'long double' format for a target.
+		 * 
+		 * Most systems use the IBM extended precision format;
+		 * FreeBSD and musl use a 64-bit 'long double'.
+		 */
+		LongDoubleFormat getDefaultLongDoubleFormat(const llvm::Triple& targetTriple);
+		
+		/**
+		 * \brief PPC64 ABI Type Layout
+		 * 
+		 * The 64-bit PowerPC ELF ABIs use the LP64 data model, with
+		 * an unsigned 'char'. The byte order comes from the triple
+		 * (ppc64 vs ppc64le) and the 'long double' format varies
+		 * between systems.
+		 */
+		class PPC64ABITypeLayout: public ABITypeLayout,
+		                          public DefaultABITypeLayoutDelegate {
+		public:
+			PPC64ABITypeLayout(const llvm::Triple& targetTriple,
+			                   LongDoubleFormat longDoubleFormat,
+			                   const ABICache* cache = nullptr);
+			
+			LongDoubleFormat longDoubleFormat() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type type) const;
+			
+			bool isHomogeneousAggregateSmallEnough(Type base,
+			                                       uint64_t members) const;
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			LongDoubleFormat longDoubleFormat_;
+			bool isBigEndian_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef LLVMABI_POWERPC_PPC64CLASSIFIER_HPP
+#define LLVMABI_POWERPC_PPC64CLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace powerpc {
+		
+		class PPC64ABITypeLayout;
+		
+		/**
+		 * \brief 64-bit PowerPC ELF ABI version.
+		 */
+		enum PPC64ABIKind {
+			ELFv1,
+			ELFv2
+		};
+		
+		/**
+		 * \brief PPC64 Classifier
+		 * 
+		 * Classifies arguments according to the 64-bit PowerPC ELF
+		 * ABIs. Arguments are mapped onto doublewords of the
+		 * parameter save area, the first eight of which are passed
+		 * in GPRs. Floating point and vector values (including
+		 * single-element structs of them) are passed in FPRs/VRs.
+		 * 
+		 * ELFv2 additionally passes and returns homogeneous float
+		 * and vector aggregates of up to eight registers in
+		 * FPRs/VRs, and returns other aggregates of up to 16 bytes
+		 * in GPRs.
+		 */
+		class PPC64Classifier {
+		public:
+			PPC64Classifier(const PPC64ABITypeLayout& typeLayout,
+			                PPC64ABIKind abiKind);
+			
+			/**
+			 * \brief Get the alignment of a type in the parameter
+			 *        save area.
+			 */
+			DataSize getParamTypeAlignment(Type type) const;
+			
+			ArgInfo classifyReturnType(Type returnType) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			const PPC64ABITypeLayout& typeLayout_;
+			PPC64ABIKind abiKind_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef LLVMABI_RISCV_RISCVABITARGET_HPP
+#define LLVMABI_RISCV_RISCVABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/riscv/RISCVABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace riscv {
+		
+		/**
+		 * \brief RISC-V ABI Target
+		 * 
+		 * Supports the ilp32/ilp32f/ilp32d and lp64/lp64f/lp64d
+		 * ABIs; XLEN comes from the triple and the floating point
+		 * ABI from the ISA string (e.g. "rv64gc") given as the CPU
+		 * name, like the defaults chosen by clang.
+		 */
+		class RISCVABITarget: public ABITarget {
+		public:
+			/**
+			 * \brief Create RISC-V ABI Target.
+			 * 
+			 * \param targetTriple The target triple.
+			 * \param cpuName The ISA string, or empty for the
+			 *                target's default.
+			 * \param abiName The ABI name (e.g. "lp64d"), or
+			 *                empty to derive it from the ISA.
+			 */
+			RISCVABITarget(const llvm::Triple& targetTriple,
+			               const std::string& cpuName = "",
+			               const std::string& abiName = "");
+			~RISCVABITarget();
+			
+			/**
+			 * \brief Get the ABI name (e.g. "lp64d").
+			 */
+			const std::string& abiName() const;
+			
+			/**
+			 * \brief Get the width of the floating point
+			 *        argument registers in bits.
+			 * 
+			 * \return 32 or 64 for a hardware floating point ABI,
+			 *         or 0 for a soft floating point ABI.
+			 */
+			unsigned fLen() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			const RISCVABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			std::string abiName_;
+			unsigned fLen_;
+			RISCVABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
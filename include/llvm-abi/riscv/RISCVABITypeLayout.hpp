@@ -0,0 +1,91 @@
+#ifndef LLVMABI_RISCV_RISCVABITYPELAYOUT_HPP
+#define LLVMABI_RISCV_RISCVABITYPELAYOUT_HPP
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace riscv {
+		
+		/**
+		 * \brief RISC-V ABI Type Layout
+		 * 
+		 * RV32 uses the ILP32 data model and RV64 uses LP64. Both
+		 * have an unsigned 'char' and a 128-bit IEEE quad 'long
+		 * double'. The layout doesn't depend on the floating point
+		 * ABI (e.g. lp64 vs lp64d).
+		 */
+		class RISCVABITypeLayout: public ABITypeLayout,
+		                          public DefaultABITypeLayoutDelegate {
+		public:
+			RISCVABITypeLayout(unsigned xLen,
+			                   const ABICache* cache = nullptr);
+			
+			/**
+			 * \brief Get the width of the integer registers in bits.
+			 */
+			unsigned xLen() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type /*type*/) const {
+				return false;
+			}
+			
+			bool isHomogeneousAggregateSmallEnough(Type /*base*/,
+			                                       uint64_t /*members*/) const {
+				return false;
+			}
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			unsigned xLen_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
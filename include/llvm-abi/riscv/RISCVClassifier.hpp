@@ -0,0 +1,83 @@
+#ifndef LLVMABI_RISCV_RISCVCLASSIFIER_HPP
+#define LLVMABI_RISCV_RISCVCLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace riscv {
+		
+		class RISCVABITypeLayout;
+		
+		/**
+		 * \brief RISC-V Classifier
+		 * 
+		 * Classifies arguments according to the RISC-V ELF psABI.
+		 * Scalars and aggregates of up to 2*XLEN bits go in (a pair
+		 * of) integer registers, larger values are passed by
+		 * reference. With a hardware floating point ABI, fixed
+		 * floating point arguments and structs containing one or
+		 * two floating point fields (or one integer and one
+		 * floating point field) go in floating point registers, as
+		 * long as enough of them are available.
+		 */
+		class RISCVClassifier {
+		public:
+			/**
+			 * \brief Create RISC-V Classifier.
+			 * 
+			 * \param typeLayout The type layout.
+			 * \param fLen The width of the floating point
+			 *             argument registers in bits, or 0 for a
+			 *             soft floating point ABI.
+			 */
+			RISCVClassifier(const RISCVABITypeLayout& typeLayout,
+			                unsigned fLen);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo classifyReturnType(Type returnType) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType,
+			                             bool isFixed,
+			                             int& argGPRsLeft,
+			                             int& argFPRsLeft,
+			                             bool isReturnType = false) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			bool detectFPCCEligibleStructHelper(Type type, DataSize currentOffset,
+			                                    Type& field1Type, DataSize& field1Offset,
+			                                    Type& field2Type, DataSize& field2Offset) const;
+			
+			bool detectFPCCEligibleStruct(Type type,
+			                              Type& field1Type, DataSize& field1Offset,
+			                              Type& field2Type, DataSize& field2Offset,
+			                              int& neededArgGPRs, int& neededArgFPRs) const;
+			
+			ArgInfo coerceFPCCEligibleStruct(Type field1Type, DataSize field1Offset,
+			                                 Type field2Type, DataSize field2Offset) const;
+			
+			ArgInfo extendType(Type type) const;
+			
+			const RISCVABITypeLayout& typeLayout_;
+			unsigned xLen_;
+			unsigned fLen_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef LLVMABI_SYSTEMZ_SYSTEMZABITARGET_HPP
+#define LLVMABI_SYSTEMZ_SYSTEMZABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/systemz/SystemZABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace systemz {
+		
+		/**
+		 * \brief SystemZ ABI Target
+		 * 
+		 * Supports the s390x ELF ABI. The vector ABI is used when
+		 * the CPU has the vector facility (z13 onwards), as
+		 * chosen by clang.
+		 */
+		class SystemZABITarget: public ABITarget {
+		public:
+			/**
+			 * \brief Create SystemZ ABI Target.
+			 * 
+			 * \param targetTriple The target triple.
+			 * \param cpuName The CPU name (e.g. "z13" or
+			 *                "arch11"), or empty for the
+			 *                target's default.
+			 */
+			SystemZABITarget(const llvm::Triple& targetTriple,
+			                 const std::string& cpuName = "");
+			~SystemZABITarget();
+			
+			/**
+			 * \brief Query whether the vector ABI is in use.
+			 */
+			bool hasVector() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			const SystemZABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			SystemZABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef LLVMABI_SYSTEMZ_SYSTEMZABITYPELAYOUT_HPP
+#define LLVMABI_SYSTEMZ_SYSTEMZABITYPELAYOUT_HPP
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace systemz {
+		
+		/**
+		 * \brief SystemZ ABI Type Layout
+		 * 
+		 * s390x is big endian and uses the LP64 data model, with an
+		 * unsigned 'char' and a 128-bit IEEE quad 'long double'
+		 * that is only 8-byte aligned. With the vector facility
+		 * (z13 onwards) vector types are also at most 8-byte
+		 * aligned.
+		 */
+		class SystemZABITypeLayout: public ABITypeLayout,
+		                            public DefaultABITypeLayoutDelegate {
+		public:
+			SystemZABITypeLayout(bool hasVector,
+			                     const ABICache* cache = nullptr);
+			
+			/**
+			 * \brief Query whether the vector ABI is in use.
+			 */
+			bool hasVector() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type /*type*/) const {
+				return false;
+			}
+			
+			bool isHomogeneousAggregateSmallEnough(Type /*base*/,
+			                                       uint64_t /*members*/) const {
+				return false;
+			}
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			bool hasVector_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef LLVMABI_SYSTEMZ_SYSTEMZCLASSIFIER_HPP
+#define LLVMABI_SYSTEMZ_SYSTEMZCLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace systemz {
+		
+		class SystemZABITypeLayout;
+		
+		/**
+		 * \brief SystemZ Classifier
+		 * 
+		 * Classifies arguments according to the s390x ELF ABI.
+		 * Integers are extended to 64 bits, structs of 1, 2, 4 or
+		 * 8 bytes are passed in a GPR (or an FPR if they only
+		 * contain a single float or double) and all other
+		 * aggregates, complex values and 'long double' are passed
+		 * by reference. Only scalars of up to 8 bytes are returned
+		 * in registers.
+		 */
+		class SystemZClassifier {
+		public:
+			SystemZClassifier(const SystemZABITypeLayout& typeLayout);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo classifyReturnType(Type returnType) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			bool isVectorArgumentType(Type type) const;
+			
+			const SystemZABITypeLayout& typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
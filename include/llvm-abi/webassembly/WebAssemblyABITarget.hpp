@@ -0,0 +1,69 @@
+#ifndef LLVMABI_WEBASSEMBLY_WEBASSEMBLYABITARGET_HPP
+#define LLVMABI_WEBASSEMBLY_WEBASSEMBLYABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/webassembly/WebAssemblyABITypeLayout.hpp>
+#include <llvm-abi/webassembly/WebAssemblyClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace webassembly {
+		
+		/**
+		 * \brief WebAssembly ABI Target
+		 * 
+		 * Supports wasm32 and wasm64 with either the basic C ABI
+		 * ("mvp") or the experimental multivalue ABI
+		 * ("experimental-mv"), named as for clang's -target-abi.
+		 */
+		class WebAssemblyABITarget: public ABITarget {
+		public:
+			/**
+			 * \brief Create WebAssembly ABI Target.
+			 * 
+			 * \param targetTriple The target triple.
+			 * \param abiName The ABI name, or empty for the
+			 *                basic C ABI.
+			 */
+			WebAssemblyABITarget(const llvm::Triple& targetTriple,
+			                     const std::string& abiName = "");
+			~WebAssemblyABITarget();
+			
+			WebAssemblyABIKind abiKind() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			const WebAssemblyABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			WebAssemblyABIKind abiKind_;
+			WebAssemblyABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
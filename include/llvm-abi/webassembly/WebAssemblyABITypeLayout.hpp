@@ -0,0 +1,87 @@
+#ifndef LLVMABI_WEBASSEMBLY_WEBASSEMBLYABITYPELAYOUT_HPP
+#define LLVMABI_WEBASSEMBLY_WEBASSEMBLYABITYPELAYOUT_HPP
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace webassembly {
+		
+		/**
+		 * \brief WebAssembly ABI Type Layout
+		 * 
+		 * wasm32 uses the ILP32 data model and wasm64 uses LP64.
+		 * Both are little endian, with a signed 'char' and a
+		 * 16-byte aligned 128-bit IEEE quad 'long double'.
+		 */
+		class WebAssemblyABITypeLayout: public ABITypeLayout,
+		                                public DefaultABITypeLayoutDelegate {
+		public:
+			WebAssemblyABITypeLayout(const llvm::Triple& targetTriple,
+			                         const ABICache* cache = nullptr);
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type /*type*/) const {
+				return false;
+			}
+			
+			bool isHomogeneousAggregateSmallEnough(Type /*base*/,
+			                                       uint64_t /*members*/) const {
+				return false;
+			}
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			bool is64Bit_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef LLVMABI_WEBASSEMBLY_WEBASSEMBLYCLASSIFIER_HPP
+#define LLVMABI_WEBASSEMBLY_WEBASSEMBLYCLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace webassembly {
+		
+		class WebAssemblyABITypeLayout;
+		
+		enum WebAssemblyABIKind {
+			/**
+			 * \brief The basic C ABI ("mvp").
+			 */
+			MVP,
+			
+			/**
+			 * \brief The experimental multivalue ABI
+			 *        ("experimental-mv").
+			 */
+			ExperimentalMV
+		};
+		
+		/**
+		 * \brief WebAssembly Classifier
+		 * 
+		 * Classifies arguments according to the WebAssembly basic
+		 * C ABI, where single element structs are passed and
+		 * returned as their element and all other aggregates go
+		 * through linear memory. The experimental multivalue ABI
+		 * instead expands aggregate arguments into their fields
+		 * and returns aggregates as multiple values.
+		 */
+		class WebAssemblyClassifier {
+		public:
+			WebAssemblyClassifier(const WebAssemblyABITypeLayout& typeLayout,
+			                      WebAssemblyABIKind abiKind);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo classifyReturnType(Type returnType) const;
+			
+			ArgInfo classifyArgumentType(Type argumentType) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			const WebAssemblyABITypeLayout& typeLayout_;
+			WebAssemblyABIKind abiKind_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -1,9 +1,10 @@
 #ifndef LLVMABI_X86_CPUFEATURES_HPP
 #define LLVMABI_X86_CPUFEATURES_HPP
 
-#include <set>
+#include <cstdint>
 #include <string>
 
+#include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/Triple.h>
 
 #include <llvm-abi/x86/CPUKind.hpp>
@@ -25,25 +26,90 @@ namespace llvm_abi {
 			AVX512F
 		};
 		
+		/**
+		 * \brief X86 CPU feature.
+		 * 
+		 * Features are listed in CPUFeatures.def.
+		 */
+		enum CPUFeature {
+#define X86_FEATURE(ENUM, NAME) FEATURE_##ENUM,
+#include <llvm-abi/x86/CPUFeatures.def>
+			FEATURE_COUNT
+		};
+		
+		typedef uint64_t CPUFeatureMask;
+		
+		static_assert(FEATURE_COUNT <= 64,
+		              "Too many CPU features for CPUFeatureMask.");
+		
+		/**
+		 * \brief Get mask containing a single feature.
+		 */
+		constexpr CPUFeatureMask getFeatureMask(const CPUFeature feature) {
+			return CPUFeatureMask(1) << feature;
+		}
+		
+		/**
+		 * \brief Set of X86 CPU features.
+		 * 
+		 * This is a bitmask, so copying and querying features
+		 * are cheap and never allocate.
+		 */
 		class CPUFeatures {
 		public:
-			CPUFeatures();
+			constexpr CPUFeatures()
+			: features_(0) { }
+			
+			constexpr explicit CPUFeatures(const CPUFeatureMask features)
+			: features_(features) { }
+			
+			void add(CPUFeature feature);
+			
+			/**
+			 * \brief Add a feature given its LLVM name.
+			 * 
+			 * Features that aren't relevant to the ABI are
+			 * ignored.
+			 */
+			void add(llvm::StringRef feature);
 			
-			void add(const std::string& feature);
+			bool hasFeature(CPUFeature feature) const;
+			
+			bool hasFeature(llvm::StringRef feature) const;
 			
 			bool hasAVX() const;
 			
+			bool hasAVX512F() const;
+			
 			SSELevel sseLevel() const;
 			
+			CPUFeatureMask mask() const;
+			
 		private:
-			std::set<std::string> features_;
-			SSELevel sseLevel_;
+			CPUFeatureMask features_;
 			
 		};
 		
 		CPUFeatures getCPUFeatures(const llvm::Triple& targetTriple,
 		                           const CPUKind cpu);
 		
+		/**
+		 * \brief Get the features of the host CPU.
+		 * 
+		 * The result is computed once per process.
+		 */
+		CPUFeatures getHostCPUFeatures(const llvm::Triple& targetTriple);
+		
+		/**
+		 * \brief Get CPU features for a CPU name and kind.
+		 * 
+		 * This uses the host's actual features if the CPU name is
+		 * "native", and otherwise the features implied by the kind.
+		 */
+		CPUFeatures getCPUFeatures(const llvm::Triple& targetTriple,
+		                           const std::string& cpuName,
+		                           const CPUKind cpu);
+		
 	}
 	
 }
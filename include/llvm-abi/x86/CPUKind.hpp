@@ -3,6 +3,7 @@
 
 #include <string>
 
+#include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/Triple.h>
 
 namespace llvm_abi {
@@ -108,9 +109,13 @@ namespace llvm_abi {
 			/// Broadwell microarchitecture based processors.
 			CK_Broadwell,
 
-			/// \name Skylake
-			/// Skylake microarchitecture based processors.
-			CK_Skylake,
+			/// \name Skylake Client
+			/// Skylake client microarchitecture based processors.
+			CK_SkylakeClient,
+
+			/// \name Skylake Server
+			/// Skylake server microarchitecture based processors.
+			CK_SkylakeServer,
 
 			/// \name Knights Landing
 			/// Knights Landing processor.
@@ -177,8 +182,27 @@ namespace llvm_abi {
 			//@}
 		};
 		
-		std::string selectCPUName(const llvm::Triple& /*targetTriple*/,
-		                          const std::string& cpu);
+		/**
+		 * \brief Check whether the CPU name requests host detection.
+		 * 
+		 * Passing "native" as the CPU name selects the CPU (and its
+		 * features) of the machine running the process, which is
+		 * what JIT users generally want.
+		 */
+		bool isNativeCPUName(const std::string& cpu);
+		
+		/**
+		 * \brief Check whether the host CPU can be used for the target.
+		 */
+		bool canUseHostCPU(const llvm::Triple& targetTriple);
+		
+		/**
+		 * \brief Get the (cached) name of the host CPU.
+		 */
+		const std::string& getHostCPUName();
+		
+		llvm::StringRef selectCPUName(const llvm::Triple& targetTriple,
+		                              const std::string& cpu);
 		
 		CPUKind getCPUKind(const llvm::Triple& targetTriple,
 		                   const std::string& userCPUString);
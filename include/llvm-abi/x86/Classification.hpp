@@ -1,11 +1,12 @@
 #ifndef LLVMABI_X86_64_CLASSIFICATION_HPP
 #define LLVMABI_X86_64_CLASSIFICATION_HPP
 
+#include <llvm-abi/ArgInfo.hpp>
 #include <llvm-abi/x86/ArgClass.hpp>
 
 namespace llvm_abi {
 	
-	class ABITypeInfo;
+	class ABITypeLayout;
 	
 	namespace x86 {
 		
@@ -19,9 +20,32 @@ namespace llvm_abi {
 			
 			bool isMemory() const;
 			
+			/**
+			 * \brief Get the reason the type is in memory.
+			 * 
+			 * This is only meaningful if isMemory() is true.
+			 */
+			ArgInfo::IndirectReason memoryReason() const;
+			
+			/**
+			 * \brief Move the whole type into memory.
+			 * 
+			 * The reason is only recorded if the type wasn't
+			 * already in memory.
+			 */
+			void setMemory(ArgInfo::IndirectReason reason);
+			
 			void addField(size_t offset, ArgClass fieldClass);
 			
-			void classifyType(const ABITypeInfo& typeInfo,
+			/**
+			 * \brief Replace the class of the high eightbyte.
+			 * 
+			 * This is used for the post-merge cleanup, which
+			 * can override the merged class.
+			 */
+			void setHigh(ArgClass highClass);
+			
+			void classifyType(const ABITypeLayout& typeLayout,
 			                  Type type,
 			                  size_t offset,
 			                  bool isNamedArg);
@@ -29,6 +53,7 @@ namespace llvm_abi {
 		private:
 			// One class for each eightbyte.
 			ArgClass classes_[2];
+			ArgInfo::IndirectReason memoryReason_;
 			
 		};
 		
@@ -1,7 +1,7 @@
 #ifndef LLVMABI_X86_64_CLASSIFIER_HPP
 #define LLVMABI_X86_64_CLASSIFIER_HPP
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/ArgInfo.hpp>
 #include <llvm-abi/FunctionType.hpp>
 
@@ -13,7 +13,7 @@ namespace llvm_abi {
 		
 		class Classifier {
 		public:
-			Classifier(const ABITypeInfo& typeInfo);
+			Classifier(const ABITypeLayout& typeLayout);
 			
 			Classification classify(const Type type,
 			                        bool isNamedArg);
@@ -27,12 +27,29 @@ namespace llvm_abi {
 			
 			ArgInfo classifyReturnType(Type type);
 			
+			/**
+			 * \brief Classify a struct for the 'regcall'
+			 *        convention.
+			 * 
+			 * 'regcall' passes and returns structs field by
+			 * field in registers, as long as every field could
+			 * itself be passed in registers.
+			 */
+			ArgInfo classifyRegCallStructType(Type type,
+			                                  bool isArgument,
+			                                  unsigned &neededInt,
+			                                  unsigned &neededSse);
+			
 			llvm::SmallVector<ArgInfo, 8>
 			classifyFunctionType(const FunctionType& functionType,
 			                     llvm::ArrayRef<Type> argumentTypes);
 			
 		private:
-			const ABITypeInfo& typeInfo_;
+			bool classifyRegCallStructTypeImpl(Type type,
+			                                   unsigned &neededInt,
+			                                   unsigned &neededSse);
+			
+			const ABITypeLayout& typeLayout_;
 			
 		};
 		
@@ -0,0 +1,41 @@
+#ifndef LLVMABI_X86_VECTORCALL_HPP
+#define LLVMABI_X86_VECTORCALL_HPP
+
+#include <cstdint>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/**
+		 * \brief Query whether type can be passed in SSE registers
+		 *        with vectorcall.
+		 * 
+		 * Shared between x86_32 and x86_64.
+		 * 
+		 * \param typeLayout The ABI Type Layout.
+		 * \param type The ABI type.
+		 * \return Whether the type is a vectorcall vector type.
+		 */
+		bool isX86VectorTypeForVectorCall(const ABITypeLayout& typeLayout,
+		                                  Type type);
+		
+		/**
+		 * \brief Query whether an aggregate is small enough to be passed
+		 *        in SSE registers with vectorcall.
+		 * 
+		 * Shared between x86_32 and x86_64.
+		 * 
+		 * \param numMembers The number of aggregate members.
+		 * \return Whether the aggregate is small enough.
+		 */
+		bool isX86VectorCallAggregateSmallEnough(uint64_t numMembers);
+		
+	}
+	
+}
+
+#endif
@@ -1,50 +1,43 @@
 #ifndef LLVMABI_X86_WIN64ABI_HPP
 #define LLVMABI_X86_WIN64ABI_HPP
 
-#include <unordered_map>
-#include <vector>
+#include <memory>
+#include <utility>
 
-#include <llvm/IR/Intrinsics.h>
-#include <llvm/IR/IRBuilder.h>
-#include <llvm/IR/Type.h>
-#include <llvm/IR/Value.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
 
-#include <llvm-abi/ABI.hpp>
-#include <llvm-abi/CallingConvention.hpp>
-#include <llvm-abi/Type.hpp>
+#include <llvm-abi/DefaultABI.hpp>
+
+#include <llvm-abi/x86/Win64ABITarget.hpp>
 
 namespace llvm_abi {
 	
 	namespace x86 {
 		
-		class Win64ABI: public ABI {
+		/**
+		 * \brief Win64 ABI
+		 * 
+		 * \deprecated Use Win64ABITarget::createABI() (or
+		 *             createABI()); this class only forwards to
+		 *             DefaultABI.
+		 */
+		class Win64ABI: public DefaultABI {
 		public:
-			Win64ABI(llvm::Module* module);
-			~Win64ABI();
-			
-			std::string name() const;
-			
-			const ABITypeInfo& typeInfo() const;
-			
-			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
-			
-			llvm::FunctionType* getFunctionType(const FunctionType& functionType) const;
-			
-			llvm::AttributeList getAttributes(const FunctionType& functionType,
-			                                  llvm::ArrayRef<Type> argumentTypes,
-			                                  llvm::AttributeList existingAttributes) const;
-			
-			llvm::Value* createCall(Builder& builder,
-			                        const FunctionType& functionType,
-			                        std::function<llvm::Value* (llvm::ArrayRef<llvm::Value*>)> callBuilder,
-			                        llvm::ArrayRef<TypedValue> arguments) const;
-			
-			std::unique_ptr<FunctionEncoder> createFunctionEncoder(Builder& builder,
-			                                                       const FunctionType& functionType,
-			                                                       llvm::ArrayRef<llvm::Value*> arguments) const;
-			
-		private:
-			llvm::LLVMContext& llvmContext_;
+			Win64ABI(llvm::Module* const module)
+			: DefaultABI(module,
+			             std::make_shared<Win64ABITarget>(llvm::Triple(module->getTargetTriple()))) { }
+			
+			Win64ABI(llvm::Module* const module,
+			         std::shared_ptr<const Win64ABITarget> pTarget)
+			: DefaultABI(module, std::move(pTarget)) { }
+			
+			/**
+			 * \brief Get the target that plans calls for this ABI.
+			 */
+			const Win64ABITarget& target() const {
+				return static_cast<const Win64ABITarget&>(DefaultABI::target());
+			}
 			
 		};
 		
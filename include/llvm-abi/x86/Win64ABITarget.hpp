@@ -0,0 +1,57 @@
+#ifndef LLVMABI_X86_WIN64ABITARGET_HPP
+#define LLVMABI_X86_WIN64ABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/Win64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/**
+		 * \brief Win64 ABI Target
+		 */
+		class Win64ABITarget: public ABITarget {
+		public:
+			Win64ABITarget(const llvm::Triple& targetTriple);
+			~Win64ABITarget();
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+			
+			const Win64ABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			Win64ABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef LLVMABI_X86_WIN64ABITYPELAYOUT_HPP
+#define LLVMABI_X86_WIN64ABITYPELAYOUT_HPP
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace x86 {
+		
+		/**
+		 * \brief Win64 ABI Type Layout
+		 * 
+		 * Windows x86_64 uses the LLP64 data model, so 'long' is
+		 * 32 bits. 'long double' is the same as 'double' for MSVC but
+		 * is the x87 80-bit type for MinGW.
+		 */
+		class Win64ABITypeLayout: public ABITypeLayout,
+		                          public DefaultABITypeLayoutDelegate {
+		public:
+			Win64ABITypeLayout(bool isMinGW,
+			                   const ABICache* cache = nullptr);
+			
+			/**
+			 * \brief Query whether this is the MinGW variant of the ABI.
+			 */
+			bool isMinGW() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type type) const;
+			
+			bool isHomogeneousAggregateSmallEnough(Type base,
+			                                       uint64_t members) const;
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			bool isMinGW_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef LLVMABI_X86_WIN64CLASSIFIER_HPP
+#define LLVMABI_X86_WIN64CLASSIFIER_HPP
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/**
+		 * \brief Win64 Classifier
+		 * 
+		 * Classifies arguments according to the Microsoft x64 calling
+		 * convention. Arguments occupy one 8 byte slot each (plus the
+		 * 32 bytes of shadow space, which the backend allocates), so
+		 * any aggregate that isn't 1, 2, 4 or 8 bytes is passed by
+		 * reference. With vectorcall, homogeneous vector aggregates
+		 * (HVAs) are instead passed in XMM0-5.
+		 */
+		class Win64Classifier {
+		public:
+			Win64Classifier(const ABITypeLayout& typeLayout,
+			                const TypeBuilder& typeBuilder,
+			                bool isMinGW);
+			
+			ArgInfo getNaturalAlignIndirect(Type type,
+			                                bool isReturnType = false) const;
+			
+			ArgInfo classify(Type type,
+			                 unsigned& freeSSERegs,
+			                 bool isReturnType,
+			                 bool isVectorCall) const;
+			
+			/// reclassifyHVAArgType - Assign SSE registers left over by
+			/// the first pass over vectorcall arguments to HVAs.
+			ArgInfo reclassifyHVAArgType(Type type,
+			                             unsigned& freeSSERegs,
+			                             const ArgInfo& current) const;
+			
+			llvm::SmallVector<ArgInfo, 8>
+			classifyFunctionType(const FunctionType& functionType,
+			                     llvm::ArrayRef<Type> argumentTypes) const;
+			
+		private:
+			const ABITypeLayout& typeLayout_;
+			const TypeBuilder& typeBuilder_;
+			bool isMinGW_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
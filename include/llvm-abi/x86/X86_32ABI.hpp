@@ -1,55 +1,44 @@
 #ifndef LLVMABI_X86_X86_32ABI_HPP
 #define LLVMABI_X86_X86_32ABI_HPP
 
-#include <vector>
+#include <memory>
+#include <utility>
 
-#include <llvm/IR/Type.h>
-#include <llvm/IR/Value.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
 
-#include <llvm-abi/ABI.hpp>
-#include <llvm-abi/CallingConvention.hpp>
-#include <llvm-abi/Type.hpp>
-#include <llvm-abi/TypeBuilder.hpp>
+#include <llvm-abi/DefaultABI.hpp>
 
-#include <llvm-abi/x86/X86_32ABITypeInfo.hpp>
+#include <llvm-abi/x86/X86_32ABITarget.hpp>
 
 namespace llvm_abi {
 	
 	namespace x86 {
 		
-		class X86_32ABI: public ABI {
+		/**
+		 * \brief x86 (32-bit) ABI
+		 * 
+		 * \deprecated Use X86_32ABITarget::createABI() (or
+		 *             createABI()); this class only forwards to
+		 *             DefaultABI.
+		 */
+		class X86_32ABI: public DefaultABI {
 		public:
-			X86_32ABI(llvm::Module* module,
-			       llvm::Triple targetTriple);
-			~X86_32ABI();
-			
-			std::string name() const;
-			
-			const ABITypeInfo& typeInfo() const;
-			
-			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
-			
-			llvm::FunctionType* getFunctionType(const FunctionType& functionType) const;
-			
-			llvm::AttributeList getAttributes(const FunctionType& functionType,
-			                                  llvm::ArrayRef<Type> argumentTypes,
-			                                  llvm::AttributeList existingAttributes) const;
-			
-			llvm::Value* createCall(Builder& builder,
-			                        const FunctionType& functionType,
-			                        std::function<llvm::Value* (llvm::ArrayRef<llvm::Value*>)> callBuilder,
-			                        llvm::ArrayRef<TypedValue> arguments) const;
-			
-			std::unique_ptr<FunctionEncoder>
-			createFunctionEncoder(Builder& builder,
-			                      const FunctionType& functionType,
-			                      llvm::ArrayRef<llvm::Value*> arguments) const;
-			
-		private:
-			llvm::LLVMContext& llvmContext_;
-			llvm::Triple targetTriple_;
-			TypeBuilder typeBuilder_;
-			X86_32ABITypeInfo typeInfo_;
+			X86_32ABI(llvm::Module* const module,
+			          const llvm::Triple targetTriple)
+			: DefaultABI(module,
+			             std::make_shared<X86_32ABITarget>(targetTriple)) { }
+			
+			X86_32ABI(llvm::Module* const module,
+			          std::shared_ptr<const X86_32ABITarget> pTarget)
+			: DefaultABI(module, std::move(pTarget)) { }
+			
+			/**
+			 * \brief Get the target that plans calls for this ABI.
+			 */
+			const X86_32ABITarget& target() const {
+				return static_cast<const X86_32ABITarget&>(DefaultABI::target());
+			}
 			
 		};
 		
@@ -0,0 +1,54 @@
+#ifndef LLVMABI_X86_X86_32ABITARGET_HPP
+#define LLVMABI_X86_X86_32ABITARGET_HPP
+
+#include <memory>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/X86_32ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/**
+		 * \brief x86 (32-bit) ABI Target
+		 */
+		class X86_32ABITarget: public ABITarget {
+		public:
+			X86_32ABITarget(const llvm::Triple& targetTriple);
+			~X86_32ABITarget();
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+			
+			const X86_32ABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			X86_32ABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
@@ -3,7 +3,7 @@
 
 #include <llvm/ADT/Triple.h>
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/ArgInfo.hpp>
 #include <llvm-abi/CallingConvention.hpp>
 #include <llvm-abi/FunctionType.hpp>
@@ -30,7 +30,7 @@ namespace llvm_abi {
 				Float
 			};
 			
-			X86_32Classifier(const ABITypeInfo& typeInfo,
+			X86_32Classifier(const ABITypeLayout& typeLayout,
 			                 const TypeBuilder& typeBuilder,
 			                 llvm::Triple targetTriple);
 			
@@ -81,7 +81,7 @@ namespace llvm_abi {
 			                     llvm::ArrayRef<Type> argumentTypes) const;
 			
 		private:
-			const ABITypeInfo& typeInfo_;
+			const ABITypeLayout& typeLayout_;
 			const TypeBuilder& typeBuilder_;
 			llvm::Triple targetTriple_;
 			
@@ -1,76 +1,48 @@
 #ifndef LLVMABI_X86_64_X86_64ABI_HPP
 #define LLVMABI_X86_64_X86_64ABI_HPP
 
-#include <unordered_map>
-#include <vector>
+#include <memory>
+#include <string>
+#include <utility>
 
-#include <llvm/IR/Intrinsics.h>
-#include <llvm/IR/IRBuilder.h>
-#include <llvm/IR/Type.h>
-#include <llvm/IR/Value.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
 
-#include <llvm-abi/ABI.hpp>
-#include <llvm-abi/CallingConvention.hpp>
-#include <llvm-abi/Type.hpp>
+#include <llvm-abi/DefaultABI.hpp>
 
-#include <llvm-abi/x86/CPUFeatures.hpp>
-#include <llvm-abi/x86/CPUKind.hpp>
-#include <llvm-abi/x86/X86_64ABITypeInfo.hpp>
+#include <llvm-abi/x86/X86_64ABITarget.hpp>
 
 namespace llvm_abi {
 	
 	namespace x86 {
 		
-		using ABISizeCache = std::unordered_map<Type, size_t>;
-		using ABITypeCache = std::unordered_map<Type, llvm::Type*>;
-		
-		class X86_64ABI: public ABI {
+		/**
+		 * \brief x86_64 ABI
+		 * 
+		 * \deprecated Use X86_64ABITarget::createABI() (or
+		 *             createABI()); this class only forwards to
+		 *             DefaultABI.
+		 */
+		class X86_64ABI: public DefaultABI {
 		public:
-			X86_64ABI(llvm::Module* module,
+			X86_64ABI(llvm::Module* const module,
 			          const llvm::Triple& targetTriple,
-			          const std::string& cpuName);
-			~X86_64ABI();
-			
-			llvm::LLVMContext& context() const {
-				return llvmContext_;
-			}
-			
-			llvm::Value* memcpyIntrinsic() const {
-				return nullptr;
+			          const std::string& cpuName)
+			: DefaultABI(module,
+			             std::make_shared<X86_64ABITarget>(targetTriple,
+			                                               cpuName)) { }
+			
+			X86_64ABI(llvm::Module* const module,
+			          std::shared_ptr<const X86_64ABITarget> pTarget)
+			: DefaultABI(module, std::move(pTarget)) { }
+			
+			/**
+			 * \brief Get the target that plans calls for this ABI.
+			 */
+			const X86_64ABITarget& target() const {
+				return static_cast<const X86_64ABITarget&>(DefaultABI::target());
 			}
 			
-			std::string name() const;
-			
-			const ABITypeInfo& typeInfo() const;
-			
-			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
-			
-			llvm::FunctionType* getFunctionType(const FunctionType& functionType) const;
-			
-			llvm::AttributeList getAttributes(const FunctionType& functionType,
-			                                  llvm::ArrayRef<Type> argumentTypes,
-		                                          llvm::AttributeList existingAttributes) const;
-			
-			llvm::Value* createCall(Builder& builder,
-			                        const FunctionType& functionType,
-			                        std::function<llvm::Value* (llvm::ArrayRef<llvm::Value*>)> callBuilder,
-			                        llvm::ArrayRef<TypedValue> arguments) const;
-			
-			std::unique_ptr<FunctionEncoder>
-			createFunctionEncoder(Builder& builder,
-			                      const FunctionType& functionType,
-			                      llvm::ArrayRef<llvm::Value*> arguments) const;
-			
-		private:
-			llvm::LLVMContext& llvmContext_;
-			CPUKind cpuKind_;
-			CPUFeatures cpuFeatures_;
-			llvm::Module* module_;
-			X86_64ABITypeInfo typeInfo_;
-			mutable ABITypeCache abiTypeCache_;
-			mutable ABISizeCache alignOfCache_;
-			mutable ABISizeCache sizeOfCache_;
-			
 		};
 		
 	}
@@ -0,0 +1,74 @@
+#ifndef LLVMABI_X86_X86_64ABITARGET_HPP
+#define LLVMABI_X86_X86_64ABITARGET_HPP
+
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/CPUFeatures.hpp>
+#include <llvm-abi/x86/CPUKind.hpp>
+#include <llvm-abi/x86/X86_64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/**
+		 * \brief x86_64 ABI Target
+		 * 
+		 * Holds the CPU information and type layout for the x86_64
+		 * ABI, and classifies functions; these are computed once
+		 * and shared by all ABIs created from it.
+		 */
+		class X86_64ABITarget: public ABITarget {
+		public:
+			X86_64ABITarget(const llvm::Triple& targetTriple,
+			                const std::string& cpuName);
+			~X86_64ABITarget();
+			
+			CPUKind cpuKind() const;
+			
+			const CPUFeatures& cpuFeatures() const;
+			
+			std::string name() const;
+			
+			llvm::Type* getLongDoubleIRType(llvm::LLVMContext& llvmContext) const;
+			
+			llvm::CallingConv::ID getCallingConvention(CallingConvention callingConvention) const;
+			
+			llvm::AttributeList
+			getFunctionAttributes(llvm::LLVMContext& llvmContext,
+			                      const ABITypeInfo& typeInfo,
+			                      const FunctionIRMapping& functionIRMapping,
+			                      llvm::AttributeList existingAttributes) const;
+			
+			const X86_64ABITypeLayout& typeLayout() const;
+			
+		protected:
+			FunctionIRMapping
+			computeFunctionIRMapping(const FunctionType& functionType,
+			                         llvm::ArrayRef<Type> argumentTypes) const;
+			
+			ABIRegisterFile
+			argumentRegisterFile(const FunctionType& functionType) const;
+			
+		private:
+			CPUKind cpuKind_;
+			CPUFeatures cpuFeatures_;
+			X86_64ABITypeLayout typeLayout_;
+			
+		};
+		
+	}
+	
+}
+
+#endif
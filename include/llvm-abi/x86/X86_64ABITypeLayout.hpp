@@ -0,0 +1,92 @@
+#ifndef LLVMABI_X86_X86_64ABITYPELAYOUT_HPP
+#define LLVMABI_X86_X86_64ABITYPELAYOUT_HPP
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	class ABICache;
+	
+	namespace x86 {
+		
+		class CPUFeatures;
+		
+		/**
+		 * \brief x86_64 ABI Type Layout
+		 * 
+		 * Uses the LP64 data model, or ILP32 for the x32 ABI
+		 * (which otherwise classifies arguments identically).
+		 */
+		class X86_64ABITypeLayout: public ABITypeLayout,
+		                           public DefaultABITypeLayoutDelegate {
+		public:
+			X86_64ABITypeLayout(const CPUFeatures& cpuFeatures,
+			                    bool isX32 = false,
+			                    const ABICache* cache = nullptr);
+			
+			/**
+			 * \brief Query whether this is the x32 (ILP32) ABI.
+			 */
+			bool isX32() const;
+			
+			const TypeBuilder& typeBuilder() const;
+			
+			DataSize getTypeRawSize(Type type) const;
+			
+			DataSize getTypeAllocSize(Type type) const;
+			
+			DataSize getTypeStoreSize(Type type) const;
+			
+			DataSize getTypeRequiredAlign(Type type) const;
+			
+			DataSize getTypePreferredAlign(Type type) const;
+			
+			llvm::SmallVector<DataSize, 8>
+			calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const;
+			
+			bool isLegalVectorType(Type type) const;
+			
+			bool isBigEndian() const;
+			
+			bool isCharSigned() const;
+			
+			bool isHomogeneousAggregateBaseType(Type /*type*/) const {
+				return false;
+			}
+			
+			bool isHomogeneousAggregateSmallEnough(Type /*base*/,
+			                                       uint64_t /*members*/) const {
+				return false;
+			}
+			
+			DataSize getPointerSize() const;
+			DataSize getPointerAlign() const;
+			
+			DataSize getIntSize(IntegerKind kind) const;
+			DataSize getIntAlign(IntegerKind kind) const;
+			
+			DataSize getFloatSize(FloatingPointKind kind) const;
+			DataSize getFloatAlign(FloatingPointKind kind) const;
+			
+			DataSize getComplexSize(FloatingPointKind kind) const;
+			DataSize getComplexAlign(FloatingPointKind kind) const;
+			
+			DataSize getArrayAlign(Type type) const;
+			DataSize getVectorAlign(Type type) const;
+			
+		private:
+			const CPUFeatures& cpuFeatures_;
+			bool isX32_;
+			const ABICache* cache_;
+			TypeBuilder typeBuilder_;
+			DefaultABITypeLayout defaultABITypeLayout_;
+		};
+		
+	}
+
+}
+
+#endif
@@ -1,38 +1,27 @@
 #include <memory>
-#include <stdexcept>
 #include <string>
 
 #include <llvm-abi/ABI.hpp>
-
-#include <llvm-abi/x86/Win64ABI.hpp>
-#include <llvm-abi/x86/X86_32ABI.hpp>
-#include <llvm-abi/x86/X86_64ABI.hpp>
+#include <llvm-abi/ABITarget.hpp>
 
 namespace llvm_abi {
 	
+	ABI::ABI()
+	: profiler_(nullptr) { }
+	
+	void ABI::setProfiler(ABIProfiler* const profiler) {
+		profiler_ = profiler;
+	}
+	
+	ABIProfiler* ABI::profiler() const {
+		return profiler_;
+	}
+	
 	std::unique_ptr<ABI> createABI(llvm::Module& module,
 	                               const llvm::Triple& targetTriple,
-	                               const std::string& cpuName) {
-		switch (targetTriple.getArch()) {
-			case llvm::Triple::x86:
-				return std::unique_ptr<ABI>(new x86::X86_32ABI(&module,
-				                                               targetTriple));
-			case llvm::Triple::x86_64: {
-				if (targetTriple.isOSWindows()) {
-					return std::unique_ptr<ABI>(new x86::Win64ABI(&module));
-				} else {
-					return std::unique_ptr<ABI>(new x86::X86_64ABI(&module,
-					                                               targetTriple,
-					                                               cpuName));
-				}
-			}
-			default:
-				break;
-		}
-		
-		std::string errorString = "No ABI available for triple: ";
-		errorString += targetTriple.str();
-		throw std::runtime_error(errorString);
+	                               const std::string& cpuName,
+	                               const std::string& abiName) {
+		return createABITarget(targetTriple, cpuName, abiName)->createABI(module);
 	}
 	
 }
@@ -0,0 +1,172 @@
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Hashing.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	ABICache::ABICache() { }
+	
+	ABICache::~ABICache() { }
+	
+	const TypeBuilder& ABICache::typeBuilder() const {
+		return typeBuilder_;
+	}
+	
+	bool ABICache::isCacheableType(const Type type) const {
+		// Scalar layout is cheap to compute directly, so only
+		// bother caching aggregates from our own builder.
+		return (type.isAggregateType() || type.isVector()) &&
+		       type.isUniquedBy(typeBuilder_);
+	}
+	
+	ABICache::TypeShard& ABICache::getTypeShard(const Type type) const {
+		// Aggregate hashes are just their uniqued pointers, so
+		// mix them before picking a shard.
+		return typeShards_[llvm::hash_value(type.hash()) % NumShards];
+	}
+	
+	bool ABICache::lookupTypeRawSize(const Type type, DataSize& size) const {
+		if (!isCacheableType(type)) {
+			return false;
+		}
+		
+		auto& shard = getTypeShard(type);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		const auto iterator = shard.rawSizes.find(type);
+		if (iterator == shard.rawSizes.end()) {
+			return false;
+		}
+		
+		size = iterator->second;
+		return true;
+	}
+	
+	void ABICache::insertTypeRawSize(const Type type, const DataSize size) const {
+		if (!isCacheableType(type)) {
+			return;
+		}
+		
+		auto& shard = getTypeShard(type);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.rawSizes[type] = size;
+	}
+	
+	bool ABICache::lookupTypeRequiredAlign(const Type type, DataSize& align) const {
+		if (!isCacheableType(type)) {
+			return false;
+		}
+		
+		auto& shard = getTypeShard(type);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		const auto iterator = shard.requiredAligns.find(type);
+		if (iterator == shard.requiredAligns.end()) {
+			return false;
+		}
+		
+		align = iterator->second;
+		return true;
+	}
+	
+	void ABICache::insertTypeRequiredAlign(const Type type, const DataSize align) const {
+		if (!isCacheableType(type)) {
+			return;
+		}
+		
+		auto& shard = getTypeShard(type);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.requiredAligns[type] = align;
+	}
+	
+	bool ABICache::FunctionKey::operator<(const FunctionKey& other) const {
+		if (callingConvention != other.callingConvention) {
+			return callingConvention < other.callingConvention;
+		}
+		
+		if (isVarArg != other.isVarArg) {
+			return isVarArg < other.isVarArg;
+		}
+		
+		if (numFixedArguments != other.numFixedArguments) {
+			return numFixedArguments < other.numFixedArguments;
+		}
+		
+		return types < other.types;
+	}
+	
+	size_t ABICache::FunctionKey::hash() const {
+		auto result = llvm::hash_combine(callingConvention, isVarArg,
+		                                 numFixedArguments);
+		for (const auto& type: types) {
+			result = llvm::hash_combine(result, type.hash());
+		}
+		return result;
+	}
+	
+	bool ABICache::getFunctionKey(const FunctionType& functionType,
+	                              llvm::ArrayRef<Type> argumentTypes,
+	                              FunctionKey& key) const {
+		key.callingConvention = functionType.callingConvention();
+		key.isVarArg = functionType.isVarArg();
+		// Varargs calls can pass more arguments than the function type
+		// declares, so the key also records the number of fixed arguments.
+		key.numFixedArguments = functionType.argumentTypes().size();
+		
+		if (!functionType.returnType().isUniquedBy(typeBuilder_)) {
+			return false;
+		}
+		key.types.push_back(functionType.returnType());
+		
+		for (const auto& argumentType: argumentTypes) {
+			if (!argumentType.isUniquedBy(typeBuilder_)) {
+				return false;
+			}
+			key.types.push_back(argumentType);
+		}
+		
+		return true;
+	}
+	
+	bool ABICache::lookupFunctionIRMapping(const FunctionType& functionType,
+	                                       llvm::ArrayRef<Type> argumentTypes,
+	                                       FunctionIRMapping& functionIRMapping) const {
+		FunctionKey key;
+		if (!getFunctionKey(functionType, argumentTypes, key)) {
+			return false;
+		}
+		
+		auto& shard = functionShards_[key.hash() % NumShards];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		const auto iterator = shard.functionIRMappings.find(key);
+		if (iterator == shard.functionIRMappings.end()) {
+			return false;
+		}
+		
+		functionIRMapping = iterator->second;
+		return true;
+	}
+	
+	void ABICache::insertFunctionIRMapping(const FunctionType& functionType,
+	                                       llvm::ArrayRef<Type> argumentTypes,
+	                                       const FunctionIRMapping& functionIRMapping) const {
+		FunctionKey key;
+		if (!getFunctionKey(functionType, argumentTypes, key)) {
+			return;
+		}
+		
+		auto& shard = functionShards_[key.hash() % NumShards];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.functionIRMappings.insert(std::make_pair(std::move(key),
+		                                              functionIRMapping));
+	}
+	
+}
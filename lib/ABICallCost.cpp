@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABICallCost.hpp>
+#include <llvm-abi/ABIFunctionPlan.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/Type.hpp>
+
+namespace llvm_abi {
+	
+	unsigned ABICallCost::totalRegisters() const {
+		unsigned total = returnCost.intRegisters + returnCost.fpRegisters;
+		for (const auto& argumentCost: argumentCosts) {
+			total += argumentCost.intRegisters + argumentCost.fpRegisters;
+		}
+		return total;
+	}
+	
+	DataSize ABICallCost::totalCopySize() const {
+		auto total = returnCost.copySize;
+		for (const auto& argumentCost: argumentCosts) {
+			total += argumentCost.copySize;
+		}
+		return total;
+	}
+	
+	/**
+	 * \brief Assigns IR arguments to registers or stack slots.
+	 */
+	class CallCostBuilder {
+	public:
+		CallCostBuilder(const ABITypeLayout& typeLayout,
+		                const ABIRegisterFile& registerFile)
+		: typeLayout_(typeLayout),
+		registerFile_(registerFile),
+		freeIntRegs_(registerFile.intRegisters),
+		freeFPRegs_(registerFile.fpRegisters),
+		position_(0),
+		stackOffset_(DataSize::Bytes(0)) { }
+		
+		DataSize stackArgumentSize() const {
+			return registerFile_.reservedStackSize +
+			       stackOffset_.roundUpToAlign(registerFile_.slotSize);
+		}
+		
+		/**
+		 * \brief Count the registers needed for an IR value of
+		 *        the given type.
+		 */
+		void countRegisters(const Type type,
+		                    unsigned& neededInt,
+		                    unsigned& neededFP) const {
+			switch (type.kind()) {
+				case VoidType:
+					return;
+				case StructType:
+					for (const auto& member: type.structMembers()) {
+						countRegisters(member.type(), neededInt, neededFP);
+					}
+					return;
+				case ArrayType: {
+					unsigned elementInt = 0;
+					unsigned elementFP = 0;
+					countRegisters(type.arrayElementType(), elementInt, elementFP);
+					neededInt += elementInt * type.arrayElementCount();
+					neededFP += elementFP * type.arrayElementCount();
+					return;
+				}
+				case ComplexType:
+					countRegisters(type.complexFloatingPointType(), neededInt, neededFP);
+					countRegisters(type.complexFloatingPointType(), neededInt, neededFP);
+					return;
+				case FloatingPointType:
+				case VectorType:
+					if (registerFile_.fpRegisters != 0) {
+						neededFP++;
+						return;
+					}
+					break;
+				case PointerType:
+				case UnspecifiedWidthIntegerType:
+				case FixedWidthIntegerType:
+				case UnionType:
+					break;
+			}
+			
+			const auto size = typeLayout_.getTypeAllocSize(type);
+			neededInt += size.roundUpToAlign(registerFile_.slotSize) /
+			             registerFile_.slotSize;
+		}
+		
+		/**
+		 * \brief Assign an IR value to registers or the stack.
+		 */
+		void assign(const Type type, const bool isInReg,
+		            ABIValueCost& cost) {
+			unsigned neededInt = 0;
+			unsigned neededFP = 0;
+			countRegisters(type, neededInt, neededFP);
+			
+			if (registerFile_.isPositional) {
+				// Each value takes the next position, which
+				// selects a register of either kind.
+				const unsigned positions = std::max(neededInt + neededFP, 1U);
+				if (position_ + positions <= registerFile_.intRegisters) {
+					position_ += positions;
+					cost.intRegisters += neededInt;
+					cost.fpRegisters += neededFP;
+					return;
+				}
+				position_ = registerFile_.intRegisters;
+				assignStack(type, cost);
+				return;
+			}
+			
+			// Values marked 'inreg' (e.g. for fastcall) are in
+			// registers that aren't part of the usual file.
+			if (isInReg) {
+				cost.intRegisters += neededInt;
+				cost.fpRegisters += neededFP;
+				return;
+			}
+			
+			if (neededInt <= freeIntRegs_ && neededFP <= freeFPRegs_) {
+				freeIntRegs_ -= neededInt;
+				freeFPRegs_ -= neededFP;
+				cost.intRegisters += neededInt;
+				cost.fpRegisters += neededFP;
+				return;
+			}
+			
+			assignStack(type, cost);
+		}
+		
+		/**
+		 * \brief Assign a value to the stack argument area.
+		 */
+		void assignStack(const Type type, ABIValueCost& cost) {
+			// Stack slots are aligned to at least the slot size,
+			// and over-aligned types to at most 16 bytes.
+			const auto align = std::max(registerFile_.slotSize,
+			                            std::min(typeLayout_.getTypeRequiredAlign(type),
+			                                     DataSize::Bytes(16)));
+			const auto size = typeLayout_.getTypeAllocSize(type).roundUpToAlign(registerFile_.slotSize);
+			stackOffset_ = stackOffset_.roundUpToAlign(align);
+			stackOffset_ += size;
+			cost.stackSize += size;
+		}
+		
+		/**
+		 * \brief Get the leaf types of an expanded aggregate.
+		 */
+		void getExpandedTypes(const Type type,
+		                      llvm::SmallVectorImpl<Type>& types) const {
+			if (type.isArray()) {
+				for (size_t i = 0; i < type.arrayElementCount(); i++) {
+					getExpandedTypes(type.arrayElementType(), types);
+				}
+			} else if (type.isStruct()) {
+				for (const auto& member: type.structMembers()) {
+					if (member.isBitField()) {
+						continue;
+					}
+					getExpandedTypes(member.type(), types);
+				}
+			} else if (type.isUnion()) {
+				// As for FunctionIRMapping, only the largest
+				// member is passed.
+				auto largestSize = DataSize::Zero();
+				Type largestType = VoidTy;
+				for (const auto& member: type.unionMembers()) {
+					const auto memberSize = typeLayout_.getTypeAllocSize(member.type());
+					if (largestSize < memberSize) {
+						largestSize = memberSize;
+						largestType = member.type();
+					}
+				}
+				if (largestType != VoidTy) {
+					getExpandedTypes(largestType, types);
+				}
+			} else if (type.isComplex()) {
+				types.push_back(type.complexFloatingPointType());
+				types.push_back(type.complexFloatingPointType());
+			} else {
+				types.push_back(type);
+			}
+		}
+		
+		/**
+		 * \brief Compute whether a direct value goes through
+		 *        memory to be coerced, as in Caller.
+		 */
+		void addCoercionCost(const Type type, const ArgInfo& argInfo,
+		                     ABIValueCost& cost) const {
+			if (isTrivialCoercion(typeLayout_, type, argInfo)) {
+				return;
+			}
+			
+			const auto coerceType = argInfo.getCoerceToType();
+			const auto size = typeLayout_.getTypeAllocSize(type);
+			cost.isCopied = true;
+			cost.copySize += size;
+			
+			// A memcpy is only needed if the value is smaller than
+			// what must be loaded from it (and isn't an integer).
+			const bool isIntegerCoercion =
+				(type.isInteger() || type.isPointer()) &&
+				(coerceType.isInteger() || coerceType.isPointer());
+			if (!isIntegerCoercion &&
+			    size < typeLayout_.getTypeStoreSize(coerceType)) {
+				cost.usesMemCpy = true;
+			}
+		}
+		
+		/**
+		 * \brief Assign the IR values of a direct argument.
+		 */
+		void assignDirect(const ArgInfo& argInfo, ABIValueCost& cost) {
+			const auto coerceType = argInfo.getCoerceToType();
+			if (coerceType.isStruct() && argInfo.isDirect() &&
+			    argInfo.getCanBeFlattened()) {
+				for (const auto& member: coerceType.structMembers()) {
+					assign(member.type(), argInfo.getInReg(), cost);
+				}
+			} else {
+				assign(coerceType, argInfo.getInReg(), cost);
+			}
+		}
+		
+		void addReturnCost(const ArgInfo& argInfo, const Type returnType,
+		                   ABIValueCost& cost) {
+			switch (argInfo.getKind()) {
+				case ArgInfo::Ignore:
+					return;
+				case ArgInfo::Direct:
+				case ArgInfo::ExtendInteger: {
+					// Return registers are separate from
+					// argument registers.
+					countRegisters(argInfo.getCoerceToType(),
+					               cost.intRegisters, cost.fpRegisters);
+					if (isTrivialCoercion(typeLayout_, returnType, argInfo) &&
+					    (returnType.isArray() || returnType.isStruct())) {
+						// Caller still stores an aggregate to a
+						// temporary and loads it back.
+						cost.isCopied = true;
+						cost.copySize += typeLayout_.getTypeAllocSize(returnType);
+						return;
+					}
+					addCoercionCost(returnType, argInfo, cost);
+					return;
+				}
+				case ArgInfo::CoerceAndExpand:
+					// The fields are returned in registers and
+					// stored to a temporary by the caller.
+					countRegisters(argInfo.getUnpaddedCoerceAndExpandType(),
+					               cost.intRegisters, cost.fpRegisters);
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(returnType);
+					return;
+				case ArgInfo::Indirect:
+				case ArgInfo::InAlloca: {
+					// The value is returned in memory, via a
+					// hidden pointer argument.
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(returnType);
+					if (argInfo.isInAlloca()) {
+						return;
+					}
+					if (registerFile_.hasStructRetRegister) {
+						cost.intRegisters++;
+					} else {
+						assign(PointerTy, argInfo.getInReg(), cost);
+					}
+					return;
+				}
+				case ArgInfo::Expand:
+					break;
+			}
+			llvm_unreachable("Invalid return ArgInfo kind.");
+		}
+		
+		void addArgumentCost(const ArgumentIRMapping& mapping,
+		                     const Type argumentType,
+		                     ABIValueCost& cost) {
+			const auto& argInfo = mapping.argInfo;
+			if (mapping.paddingArgIndex != InvalidIndex) {
+				assign(argInfo.getPaddingType(), argInfo.getPaddingInReg(), cost);
+			}
+			
+			switch (argInfo.getKind()) {
+				case ArgInfo::Ignore:
+					return;
+				case ArgInfo::Direct:
+				case ArgInfo::ExtendInteger:
+					assignDirect(argInfo, cost);
+					addCoercionCost(argumentType, argInfo, cost);
+					return;
+				case ArgInfo::Indirect: {
+					// The caller copies the value into a temporary.
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(argumentType);
+					if (argInfo.getIndirectByVal()) {
+						// The backend copies the temporary into the
+						// stack argument area.
+						cost.usesMemCpy = true;
+						assignStack(argumentType, cost);
+					} else {
+						assign(PointerTy, argInfo.getInReg(), cost);
+					}
+					return;
+				}
+				case ArgInfo::InAlloca:
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(argumentType);
+					assignStack(argumentType, cost);
+					return;
+				case ArgInfo::Expand: {
+					// The value is stored to a temporary and each
+					// element is loaded from it.
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(argumentType);
+					llvm::SmallVector<Type, 8> expandedTypes;
+					getExpandedTypes(argInfo.getExpandType(), expandedTypes);
+					for (const auto& expandedType: expandedTypes) {
+						assign(expandedType, /*isInReg=*/false, cost);
+					}
+					return;
+				}
+				case ArgInfo::CoerceAndExpand: {
+					// As for Expand, but only the non-padding
+					// fields of the coerced struct are passed.
+					cost.isCopied = true;
+					cost.copySize += typeLayout_.getTypeAllocSize(argumentType);
+					for (const auto& type: argInfo.getCoerceAndExpandTypeSequence()) {
+						assign(type, /*isInReg=*/false, cost);
+					}
+					return;
+				}
+			}
+			llvm_unreachable("Invalid argument ArgInfo kind.");
+		}
+	
+	private:
+		const ABITypeLayout& typeLayout_;
+		const ABIRegisterFile& registerFile_;
+		unsigned freeIntRegs_;
+		unsigned freeFPRegs_;
+		unsigned position_;
+		DataSize stackOffset_;
+	
+	};
+	
+	ABICallCost computeCallCost(const ABITypeLayout& typeLayout,
+	                            const ABIRegisterFile& registerFile,
+	                            const ABIFunctionPlan& plan) {
+		const auto& functionIRMapping = plan.functionIRMapping();
+		const auto argumentTypes = plan.argumentTypes();
+		assert(functionIRMapping.arguments().size() == argumentTypes.size());
+		
+		CallCostBuilder builder(typeLayout, registerFile);
+		
+		ABICallCost cost;
+		
+		// The struct return pointer is the first argument, unless
+		// it follows 'this'.
+		const auto& returnArgInfo = functionIRMapping.returnArgInfo();
+		const bool isSRetAfterThis = returnArgInfo.isIndirect() &&
+		                             returnArgInfo.isSRetAfterThis();
+		if (!isSRetAfterThis) {
+			builder.addReturnCost(returnArgInfo,
+			                      plan.functionType().returnType(),
+			                      cost.returnCost);
+		}
+		
+		for (size_t i = 0; i < argumentTypes.size(); i++) {
+			cost.argumentCosts.push_back(ABIValueCost());
+			builder.addArgumentCost(functionIRMapping.arguments()[i],
+			                        argumentTypes[i],
+			                        cost.argumentCosts.back());
+			if (i == 0 && isSRetAfterThis) {
+				builder.addReturnCost(returnArgInfo,
+				                      plan.functionType().returnType(),
+				                      cost.returnCost);
+			}
+		}
+		
+		if (isSRetAfterThis && argumentTypes.empty()) {
+			builder.addReturnCost(returnArgInfo,
+			                      plan.functionType().returnType(),
+			                      cost.returnCost);
+		}
+		
+		cost.stackArgumentSize = builder.stackArgumentSize();
+		return cost;
+	}
+
+}
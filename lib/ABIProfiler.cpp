@@ -0,0 +1,237 @@
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/ModuleUtils.h>
+
+#include <llvm-abi/ABIProfiler.hpp>
+#include <llvm-abi/Builder.hpp>
+#include <llvm-abi/DataSize.hpp>
+
+namespace llvm_abi {
+	
+	namespace {
+		
+		const unsigned NumCounters = 4;
+		
+		llvm::ArrayType* getCountersType(llvm::LLVMContext& context) {
+			return llvm::ArrayType::get(llvm::Type::getInt64Ty(context),
+			                            NumCounters);
+		}
+		
+		llvm::Constant* getStringConstant(llvm::Module& module,
+		                                  llvm::StringRef string,
+		                                  const llvm::Twine& name) {
+			const auto stringConstant =
+				llvm::ConstantDataArray::getString(module.getContext(), string);
+			const auto global =
+				new llvm::GlobalVariable(module, stringConstant->getType(),
+				                         /*isConstant=*/true,
+				                         llvm::GlobalValue::PrivateLinkage,
+				                         stringConstant, name);
+			global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+			const auto zero = llvm::ConstantInt::get(llvm::Type::getInt32Ty(module.getContext()), 0);
+			llvm::Constant* const indices[] = { zero, zero };
+			return llvm::ConstantExpr::getInBoundsGetElementPtr(stringConstant->getType(),
+			                                                    global, indices);
+		}
+	
+	}
+	
+	ABIProfiler::ABIProfiler(llvm::Module& module,
+	                         std::string tableName)
+	: module_(module),
+	tableName_(std::move(tableName)),
+	isFinalized_(false) { }
+	
+	llvm::GlobalVariable* ABIProfiler::createSite(const std::string& name) {
+		assert(!isFinalized_);
+		const auto countersType = getCountersType(module_.getContext());
+		const auto site =
+			new llvm::GlobalVariable(module_, countersType,
+			                         /*isConstant=*/false,
+			                         llvm::GlobalValue::PrivateLinkage,
+			                         llvm::ConstantAggregateZero::get(countersType),
+			                         tableName_ + ".counters");
+		sites_.push_back(std::make_pair(name, site));
+		return site;
+	}
+	
+	void ABIProfiler::emitUpdates(Builder& builder,
+	                              llvm::GlobalVariable* const site,
+	                              const uint64_t numCalls,
+	                              const ABIProfileCounts& counts) const {
+		const uint64_t values[NumCounters] = {
+			numCalls,
+			counts.byValBytes.asBytes(),
+			counts.indirectBytes.asBytes(),
+			counts.coercedBytes.asBytes()
+		};
+		
+		auto& irBuilder = builder.getBuilder();
+		const auto i64Type = irBuilder.getInt64Ty();
+		for (unsigned i = 0; i < NumCounters; i++) {
+			if (values[i] == 0) {
+				continue;
+			}
+			
+			const auto counterPtr = irBuilder.CreateConstInBoundsGEP2_32(site->getValueType(),
+			                                                             site, 0, i);
+			const auto counter = irBuilder.CreateLoad(i64Type, counterPtr);
+			const auto newCounter = irBuilder.CreateAdd(counter,
+			                                            irBuilder.getInt64(values[i]));
+			irBuilder.CreateStore(newCounter, counterPtr);
+		}
+	}
+	
+	void ABIProfiler::finalize(const llvm::StringRef dumpFileName) {
+		assert(!isFinalized_);
+		isFinalized_ = true;
+		
+		auto& context = module_.getContext();
+		const auto i64Type = llvm::Type::getInt64Ty(context);
+		const auto entryType =
+			llvm::StructType::get(llvm::Type::getInt8PtrTy(context),
+			                      getCountersType(context)->getPointerTo());
+		
+		std::vector<llvm::Constant*> entries;
+		entries.reserve(sites_.size());
+		for (const auto& site: sites_) {
+			const auto name = getStringConstant(module_, site.first,
+			                                    tableName_ + ".name");
+			entries.push_back(llvm::ConstantStruct::get(entryType, name,
+			                                            site.second));
+		}
+		
+		const auto entriesType = llvm::ArrayType::get(entryType, entries.size());
+		const auto tableType = llvm::StructType::get(i64Type, entriesType);
+		const auto tableValue =
+			llvm::ConstantStruct::get(tableType,
+			                          llvm::ConstantInt::get(i64Type, entries.size()),
+			                          llvm::ConstantArray::get(entriesType, entries));
+		const auto table =
+			new llvm::GlobalVariable(module_, tableType,
+			                         /*isConstant=*/true,
+			                         llvm::GlobalValue::ExternalLinkage,
+			                         tableValue, tableName_);
+		
+		if (!dumpFileName.empty()) {
+			createDumpFunction(table, dumpFileName);
+		}
+	}
+	
+	void ABIProfiler::createDumpFunction(llvm::GlobalVariable* const table,
+	                                     const llvm::StringRef dumpFileName) {
+		auto& context = module_.getContext();
+		const auto i8PtrType = llvm::Type::getInt8PtrTy(context);
+		const auto i32Type = llvm::Type::getInt32Ty(context);
+		const auto i64Type = llvm::Type::getInt64Ty(context);
+		
+		// FILE* is passed around as an i8*.
+		const auto fopenFunction =
+			module_.getOrInsertFunction("fopen",
+			                            llvm::FunctionType::get(i8PtrType,
+			                                                    { i8PtrType, i8PtrType },
+			                                                    /*isVarArg=*/false));
+		const auto fprintfFunction =
+			module_.getOrInsertFunction("fprintf",
+			                            llvm::FunctionType::get(i32Type,
+			                                                    { i8PtrType, i8PtrType },
+			                                                    /*isVarArg=*/true));
+		const auto fcloseFunction =
+			module_.getOrInsertFunction("fclose",
+			                            llvm::FunctionType::get(i32Type,
+			                                                    { i8PtrType },
+			                                                    /*isVarArg=*/false));
+		
+		const auto function =
+			llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getVoidTy(context),
+			                                               /*isVarArg=*/false),
+			                       llvm::GlobalValue::InternalLinkage,
+			                       tableName_ + ".dump", &module_);
+		const auto entryBlock = llvm::BasicBlock::Create(context, "entry", function);
+		const auto closeBlock = llvm::BasicBlock::Create(context, "close", function);
+		const auto exitBlock = llvm::BasicBlock::Create(context, "exit", function);
+		
+		llvm::IRBuilder<> builder(entryBlock);
+		const auto file = builder.CreateCall(fopenFunction,
+		                                     { getStringConstant(module_, dumpFileName,
+		                                                         tableName_ + ".file"),
+		                                       getStringConstant(module_, "a",
+		                                                         tableName_ + ".mode") },
+		                                     "file");
+		const auto isFileNull = builder.CreateIsNull(file);
+		
+		if (sites_.empty()) {
+			builder.CreateCondBr(isFileNull, exitBlock, closeBlock);
+		} else {
+			// Print each record of the table.
+			const auto loopBlock = llvm::BasicBlock::Create(context, "loop",
+			                                                function, closeBlock);
+			builder.CreateCondBr(isFileNull, exitBlock, loopBlock);
+			
+			builder.SetInsertPoint(loopBlock);
+			const auto index = builder.CreatePHI(i64Type, 2, "index");
+			index->addIncoming(builder.getInt64(0), entryBlock);
+			
+			const auto tableType = table->getValueType();
+			const auto entryType = tableType->getStructElementType(1)->getArrayElementType();
+			const auto countersType = getCountersType(context);
+			llvm::Value* const namePtrIndices[] = {
+				builder.getInt32(0), builder.getInt32(1), index, builder.getInt32(0)
+			};
+			llvm::Value* const countersPtrIndices[] = {
+				builder.getInt32(0), builder.getInt32(1), index, builder.getInt32(1)
+			};
+			const auto name = builder.CreateLoad(i8PtrType,
+			                                     builder.CreateInBoundsGEP(tableType, table,
+			                                                               namePtrIndices));
+			const auto counters = builder.CreateLoad(entryType->getStructElementType(1),
+			                                         builder.CreateInBoundsGEP(tableType, table,
+			                                                                   countersPtrIndices));
+			
+			llvm::SmallVector<llvm::Value*, 8> printArgs;
+			printArgs.push_back(file);
+			printArgs.push_back(getStringConstant(module_, "%s\t%llu\t%llu\t%llu\t%llu\n",
+			                                      tableName_ + ".format"));
+			printArgs.push_back(name);
+			for (unsigned i = 0; i < NumCounters; i++) {
+				const auto counterPtr = builder.CreateConstInBoundsGEP2_32(countersType,
+				                                                           counters, 0, i);
+				printArgs.push_back(builder.CreateLoad(i64Type, counterPtr));
+			}
+			builder.CreateCall(fprintfFunction, printArgs);
+			
+			const auto nextIndex = builder.CreateAdd(index, builder.getInt64(1));
+			index->addIncoming(nextIndex, loopBlock);
+			const auto isDone = builder.CreateICmpEQ(nextIndex,
+			                                         builder.getInt64(sites_.size()));
+			builder.CreateCondBr(isDone, closeBlock, loopBlock);
+		}
+		
+		builder.SetInsertPoint(closeBlock);
+		builder.CreateCall(fcloseFunction, { file });
+		builder.CreateBr(exitBlock);
+		
+		builder.SetInsertPoint(exitBlock);
+		builder.CreateRetVoid();
+		
+		llvm::appendToGlobalDtors(module_, function, /*Priority=*/65535);
+	}
+	
+	size_t ABIProfiler::numSites() const {
+		return sites_.size();
+	}
+
+}
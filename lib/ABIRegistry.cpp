@@ -0,0 +1,57 @@
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABIRegistry.hpp>
+#include <llvm-abi/ABITarget.hpp>
+
+namespace llvm_abi {
+	
+	ABIRegistry::ABIRegistry() { }
+	
+	ABIRegistry::~ABIRegistry() { }
+	
+	ABIRegistry& ABIRegistry::global() {
+		static ABIRegistry registry;
+		return registry;
+	}
+	
+	std::shared_ptr<ABITarget>
+	ABIRegistry::getTarget(const llvm::Triple& targetTriple,
+	                       const std::string& cpu,
+	                       const std::string& abiName) {
+		// CPU features are derived from the CPU name, so the
+		// triple, CPU and ABI name identify the target completely.
+		const auto key = std::make_tuple(targetTriple.str(), cpu, abiName);
+		
+		std::lock_guard<std::mutex> lock(mutex_);
+		const auto iterator = targets_.find(key);
+		if (iterator != targets_.end()) {
+			return iterator->second;
+		}
+		
+		auto target = createABITarget(targetTriple, cpu, abiName);
+		targets_.insert(std::make_pair(key, target));
+		return target;
+	}
+	
+	std::unique_ptr<ABI>
+	ABIRegistry::createABI(llvm::Module& module,
+	                       const llvm::Triple& targetTriple,
+	                       const std::string& cpu,
+	                       const std::string& abiName) {
+		return getTarget(targetTriple, cpu, abiName)->createABI(module);
+	}
+	
+	void ABIRegistry::clear() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		targets_.clear();
+	}
+	
+}
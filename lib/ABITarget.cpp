@@ -0,0 +1,208 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Statistic.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABICallCost.hpp>
+#include <llvm-abi/ABIFunctionPlan.hpp>
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/DefaultABI.hpp>
+#include <llvm-abi/FastClassifier.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypePromoter.hpp>
+
+#include <llvm-abi/aarch64/AArch64ABITarget.hpp>
+
+#include <llvm-abi/arm/ARMABITarget.hpp>
+
+#include <llvm-abi/powerpc/PPC64ABITarget.hpp>
+
+#include <llvm-abi/riscv/RISCVABITarget.hpp>
+
+#include <llvm-abi/systemz/SystemZABITarget.hpp>
+
+#include <llvm-abi/webassembly/WebAssemblyABITarget.hpp>
+
+#include <llvm-abi/x86/Win64ABITarget.hpp>
+#include <llvm-abi/x86/X86_32ABITarget.hpp>
+#include <llvm-abi/x86/X86_64ABITarget.hpp>
+
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumFunctionPlans, "Number of ABI function plans requested");
+STATISTIC(NumFunctionPlansComputed, "Number of ABI function plans computed (cache misses)");
+
+namespace llvm_abi {
+	
+	ABITarget::ABITarget(const llvm::Triple& targetTriple)
+	: targetTriple_(targetTriple) { }
+	
+	ABITarget::~ABITarget() { }
+	
+	const llvm::Triple& ABITarget::targetTriple() const {
+		return targetTriple_;
+	}
+	
+	const ABICache& ABITarget::cache() const {
+		return cache_;
+	}
+	
+	llvm::CallingConv::ID
+	ABITarget::getCallingConvention(const CallingConvention callingConvention) const {
+		switch (callingConvention) {
+			case CC_CDefault:
+			case CC_CppDefault:
+			case CC_CDecl:
+				return llvm::CallingConv::C;
+			case CC_Fast:
+				return llvm::CallingConv::Fast;
+			default:
+				llvm_unreachable("Invalid calling convention for ABI.");
+		}
+	}
+	
+	llvm::AttributeList
+	ABITarget::getFunctionAttributes(llvm::LLVMContext& llvmContext,
+	                                 const ABITypeInfo& typeInfo,
+	                                 const FunctionIRMapping& functionIRMapping,
+	                                 const llvm::AttributeList existingAttributes) const {
+		return llvm_abi::getFunctionAttributes(llvmContext,
+		                                       typeInfo,
+		                                       functionIRMapping,
+		                                       existingAttributes);
+	}
+	
+	ABIFunctionPlan
+	ABITarget::getFunctionPlan(const FunctionType& functionType) const {
+		return getFunctionPlan(functionType,
+		                       functionType.argumentTypes());
+	}
+	
+	ABIFunctionPlan
+	ABITarget::getFunctionPlan(const FunctionType& functionType,
+	                           llvm::ArrayRef<Type> rawArgumentTypes) const {
+		assert(rawArgumentTypes.size() >= functionType.argumentTypes().size());
+		
+		// Promote argument types (e.g. for varargs).
+		TypePromoter typePromoter(typeLayout());
+		const auto argumentTypes = typePromoter.promoteArgumentTypes(functionType,
+		                                                             rawArgumentTypes);
+		
+		++NumFunctionPlans;
+		
+		FunctionIRMapping functionIRMapping;
+		if (!cache_.lookupFunctionIRMapping(functionType, argumentTypes,
+		                                    functionIRMapping)) {
+			++NumFunctionPlansComputed;
+			if (functionType.callingConvention() == CC_Fast) {
+				// The fast convention is target independent
+				// other than the register file.
+				FastClassifier classifier(typeLayout(), targetTriple());
+				functionIRMapping =
+					getFunctionIRMapping(typeLayout(),
+					                     classifier.classifyFunctionType(functionType,
+					                                                     argumentTypes));
+			} else {
+				functionIRMapping = computeFunctionIRMapping(functionType,
+				                                             argumentTypes);
+			}
+			cache_.insertFunctionIRMapping(functionType, argumentTypes,
+			                               functionIRMapping);
+		}
+		
+		return ABIFunctionPlan(functionType,
+		                       argumentTypes,
+		                       functionIRMapping);
+	}
+	
+	ABICallCost
+	ABITarget::getCallCost(const FunctionType& functionType,
+	                       llvm::ArrayRef<Type> argumentTypes) const {
+		const auto plan = getFunctionPlan(functionType,
+		                                  argumentTypes);
+		return computeCallCost(typeLayout(),
+		                       argumentRegisterFile(functionType),
+		                       plan);
+	}
+	
+	std::unique_ptr<ABI> ABITarget::createABI(llvm::Module& module) const {
+		return std::unique_ptr<ABI>(new DefaultABI(&module, shared_from_this()));
+	}
+	
+	std::shared_ptr<ABITarget> createABITarget(const llvm::Triple& targetTriple,
+	                                           const std::string& cpuName,
+	                                           const std::string& abiName) {
+		switch (targetTriple.getArch()) {
+			case llvm::Triple::x86:
+				return std::make_shared<x86::X86_32ABITarget>(targetTriple);
+			case llvm::Triple::x86_64: {
+				if (targetTriple.isOSWindows()) {
+					return std::make_shared<x86::Win64ABITarget>(targetTriple);
+				} else {
+					return std::make_shared<x86::X86_64ABITarget>(targetTriple,
+					                                              cpuName);
+				}
+			}
+			case llvm::Triple::aarch64:
+			case llvm::Triple::aarch64_be: {
+				// TODO: Windows on ARM64 uses a variant of AAPCS64
+				// with LLP64 types and different variadic rules.
+				if (targetTriple.isOSWindows()) {
+					break;
+				}
+				return std::make_shared<aarch64::AArch64ABITarget>(targetTriple);
+			}
+			case llvm::Triple::arm:
+			case llvm::Triple::armeb:
+			case llvm::Triple::thumb:
+			case llvm::Triple::thumbeb: {
+				// TODO: Darwin (APCS and watchOS' AAPCS16) and
+				// Windows on ARM aren't supported yet.
+				if (targetTriple.isOSDarwin() || targetTriple.isOSWindows()) {
+					break;
+				}
+				return std::make_shared<arm::ARMABITarget>(targetTriple);
+			}
+			case llvm::Triple::ppc64:
+			case llvm::Triple::ppc64le: {
+				// AIX uses its own (XCOFF) ABI.
+				if (!targetTriple.isOSBinFormatELF()) {
+					break;
+				}
+				return std::make_shared<powerpc::PPC64ABITarget>(targetTriple);
+			}
+			case llvm::Triple::riscv32:
+			case llvm::Triple::riscv64:
+				return std::make_shared<riscv::RISCVABITarget>(targetTriple,
+				                                               cpuName,
+				                                               abiName);
+			case llvm::Triple::systemz:
+				return std::make_shared<systemz::SystemZABITarget>(targetTriple,
+				                                                   cpuName);
+			case llvm::Triple::wasm32:
+			case llvm::Triple::wasm64:
+				return std::make_shared<webassembly::WebAssemblyABITarget>(targetTriple,
+				                                                           abiName);
+			default:
+				break;
+		}
+		
+		std::string errorString = "No ABI available for triple: ";
+		errorString += targetTriple.str();
+		throw std::runtime_error(errorString);
+	}
+	
+}
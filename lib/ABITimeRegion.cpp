@@ -0,0 +1,77 @@
+#include <llvm/Pass.h>
+#include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/TimeProfiler.h>
+#include <llvm/Support/Timer.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+
+namespace llvm_abi {
+	
+	namespace {
+		
+		struct RegionInfo {
+			const char* name;
+			const char* description;
+		};
+		
+		const RegionInfo regionInfos[NumABITimeRegionKinds] = {
+			{ "type-interning", "ABI type interning" },
+			{ "type-layout", "ABI type layout" },
+			{ "classification", "ABI classification" },
+			{ "ir-mapping", "ABI IR mapping" },
+			{ "caller-encoding", "ABI caller encoding" },
+			{ "callee-decoding", "ABI callee decoding" }
+		};
+		
+		struct ABITimers {
+			llvm::TimerGroup group;
+			llvm::Timer timers[NumABITimeRegionKinds];
+			
+			ABITimers()
+			: group("llvm-abi", "llvm-abi ABI lowering") {
+				for (unsigned i = 0; i < NumABITimeRegionKinds; i++) {
+					timers[i].init(regionInfos[i].name,
+					               regionInfos[i].description,
+					               group);
+				}
+			}
+		};
+		
+		// Destroyed (and so reported) by llvm_shutdown(), along
+		// with LLVM's own timers.
+		llvm::ManagedStatic<ABITimers> abiTimers;
+		
+		thread_local unsigned regionDepth[NumABITimeRegionKinds];
+	
+	}
+	
+	void ABITimeRegion::start() {
+		isActive_ = true;
+		if (regionDepth[kind_]++ != 0) {
+			return;
+		}
+		
+		if (llvm::TimePassesIsEnabled) {
+			abiTimers->timers[kind_].startTimer();
+			isTimed_ = true;
+		}
+		
+		if (llvm::timeTraceProfilerEnabled()) {
+			llvm::timeTraceProfilerBegin(regionInfos[kind_].description, "");
+			isTraced_ = true;
+		}
+	}
+	
+	void ABITimeRegion::stop() {
+		if (isTraced_) {
+			llvm::timeTraceProfilerEnd();
+		}
+		
+		if (isTimed_) {
+			abiTimers->timers[kind_].stopTimer();
+		}
+		
+		regionDepth[kind_]--;
+	}
+
+}
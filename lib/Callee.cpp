@@ -1,3 +1,6 @@
+#include <llvm/ADT/Statistic.h>
+#include <llvm-abi/ABIProfiler.hpp>
+#include <llvm-abi/ABITimeRegion.hpp>
 #include <llvm-abi/ABITypeInfo.hpp>
 #include <llvm-abi/Builder.hpp>
 #include <llvm-abi/Callee.hpp>
@@ -5,6 +8,11 @@
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/LLVMUtils.hpp>
 
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumFunctionsDecoded, "Number of functions decoded for the ABI");
+STATISTIC(NumCalleeMemCpys, "Number of memcpys emitted by ABI callees");
+
 namespace llvm_abi {
 	
 	/// EnterStructPointerForCoercedAccess - Given a struct pointer that we are
@@ -85,12 +93,15 @@ namespace llvm_abi {
 		const auto destIntLLVMType = typeInfo.getLLVMType(destType.isPointer() ? IntPtrTy : destType);
 		
 		if (value->getType() != destIntLLVMType) {
-			if (typeInfo.isBigEndian()) {
+			// Compare the number of bytes each type occupies in
+			// memory, since that determines where the value ends
+			// up when coerced through memory.
+			const auto sourceSize = typeInfo.getTypeStoreSize(sourceType);
+			const auto destSize = typeInfo.getTypeStoreSize(destType);
+			
+			if (typeInfo.isBigEndian() && sourceSize != destSize) {
 				// Preserve the high bits on big-endian targets.
 				// That is what memory coercion does.
-				const auto sourceSize = typeInfo.getTypeRawSize(sourceType);
-				const auto destSize = typeInfo.getTypeRawSize(destType);
-				
 				if (sourceSize > destSize) {
 					value = builder.getBuilder().CreateLShr(value,
 					                                        (sourceSize - destSize).asBits(),
@@ -107,7 +118,9 @@ namespace llvm_abi {
 					                                       "coerce.highbits");
 				}
 			} else {
-				// Little-endian targets preserve the low bits. No shifts required.
+				// Little-endian targets preserve the low bits, as do
+				// big-endian ones when both types occupy the same
+				// bytes (e.g. i1 and i8). No shifts required.
 				value = builder.getBuilder().CreateIntCast(value,
 				                                           destIntLLVMType,
 				                                           false,
@@ -130,11 +143,18 @@ namespace llvm_abi {
 	/// This safely handles the case when the src type is smaller than the
 	/// destination type; in this situation the values of bits which not
 	/// present in the src are undefined.
+	///
+	/// \arg argumentNumber is only used for remarks (-1 for the return value),
+	/// and \arg profileCounts accumulates the bytes copied through memory.
 	static llvm::Value* createCoercedLoad(const ABITypeInfo& typeInfo,
 	                                      Builder& builder,
 	                                      llvm::Value* sourcePtr,
 	                                      Type sourceType,
-	                                      const Type destType) {
+	                                      const Type destType,
+	                                      const int argumentNumber,
+	                                      ABIProfileCounts& profileCounts) {
+		const auto valueType = sourceType;
+		
 		// If source and destination types are the same, just do a load.
 		if (typeInfo.getLLVMType(sourceType) == typeInfo.getLLVMType(destType)) {
 			return builder.getBuilder().CreateLoad(sourcePtr);
@@ -166,8 +186,10 @@ namespace llvm_abi {
 			                                destType);
 		}
 		
-		// If load is legal, just bitcast the src pointer.
-		if (sourceSize >= destSize) {
+		// If load is legal, just bitcast the src pointer. A load
+		// only accesses the store size of its type (e.g. 3 bytes
+		// for i24), which may be less than the alloc size.
+		if (sourceSize >= typeInfo.getTypeStoreSize(destType)) {
 			// Generally sourceSize is never greater than destSize, since this means we are
 			// losing bits. However, this can happen in cases where the structure has
 			// additional padding, for example due to a user specified alignment.
@@ -191,9 +213,14 @@ namespace llvm_abi {
 			const auto casted = builder.getBuilder().CreateBitCast(tmpAlloca, i8PtrType);
 			const auto sourceCasted = builder.getBuilder().CreateBitCast(sourcePtr, i8PtrType);
 			// FIXME: Use better alignment.
+			++NumCalleeMemCpys;
 			builder.getBuilder().CreateMemCpy(casted, /*dstAlign=*/1, sourceCasted, /*srcAlign=*/1,
 			                                  llvm::ConstantInt::get(typeInfo.getLLVMType(IntPtrTy),
 			                                                         sourceSize.asBytes()));
+			emitMemoryRemark(builder, "CoercedThroughMemory",
+			                 argumentNumber, valueType,
+			                 "coerced through memory", sourceSize);
+			profileCounts.coercedBytes += sourceSize;
 			return builder.getBuilder().CreateLoad(tmpAlloca);
 		}
 	}
@@ -232,12 +259,17 @@ namespace llvm_abi {
 	///
 	/// This safely handles the case when the src type is larger than the
 	/// destination type; the upper bits of the src will be lost.
+	///
+	/// \arg argumentNumber is only used for remarks (-1 for the return value),
+	/// and \arg profileCounts accumulates the bytes copied through memory.
 	static void createCoercedStore(const ABITypeInfo& typeInfo,
 	                               Builder& builder,
 	                               llvm::Value* const source,
 	                               llvm::Value* destPtr,
 	                               const Type sourceType,
-	                               Type destType) {
+	                               Type destType,
+	                               const int argumentNumber,
+	                               ABIProfileCounts& profileCounts) {
 		if (typeInfo.getLLVMType(sourceType) == typeInfo.getLLVMType(destType)) {
 			createStore(builder.getBuilder(), source, destPtr);
 			return;
@@ -270,8 +302,10 @@ namespace llvm_abi {
 		
 		const auto destSize = typeInfo.getTypeAllocSize(destType);
 		
-		// If store is legal, just bitcast the src pointer.
-		if (sourceSize <= destSize) {
+		// If store is legal, just bitcast the src pointer. As
+		// for loads, only the store size of the source is
+		// written.
+		if (typeInfo.getTypeStoreSize(sourceType) <= destSize) {
 			const auto sourcePtrType =
 				llvm::PointerType::getUnqual(typeInfo.getLLVMType(sourceType));
 			const auto castedDestPtr =
@@ -300,10 +334,15 @@ namespace llvm_abi {
 			const auto casted = builder.getBuilder().CreateBitCast(tempAlloca, i8PtrType);
 			const auto destCasted = builder.getBuilder().CreateBitCast(destPtr, i8PtrType);
 			// FIXME: Use better alignment.
+			++NumCalleeMemCpys;
 			builder.getBuilder().CreateMemCpy(destCasted, /*dstAlign=*/1,
 			                                  casted, /*srcAlign=*/1,
 			                                  llvm::ConstantInt::get(typeInfo.getLLVMType(IntPtrTy),
 			                                                         destSize.asBytes()));
+			emitMemoryRemark(builder, "CoercedThroughMemory",
+			                 argumentNumber, destType,
+			                 "coerced through memory", destSize);
+			profileCounts.coercedBytes += destSize;
 		}
 	}
 	
@@ -320,7 +359,7 @@ namespace llvm_abi {
 				                                               alloca, 0, i);
 				const auto elementIRType = typeInfo.getLLVMType(type.arrayElementType());
 				const auto castAddress = builder.getBuilder().CreateBitCast(elementAddress, elementIRType->getPointerTo());
-				expandTypeFromArgs(typeInfo, builder, type,
+				expandTypeFromArgs(typeInfo, builder, type.arrayElementType(),
 				                   castAddress, iterator);
 			}
 		} else if (type.isStruct()) {
@@ -373,7 +412,14 @@ namespace llvm_abi {
 			expandTypeFromArgs(typeInfo, builder, largestType,
 			                   castAddress, iterator);
 		} else if (type.isComplex()) {
-			llvm_unreachable("TODO");
+			// The real and imaginary parts.
+			const auto floatType = type.complexFloatingPointType();
+			for (unsigned i = 0; i < 2; i++) {
+				const auto partAddress = createConstGEP2_32(builder, typeInfo.getLLVMType(type),
+				                                            alloca, 0, i);
+				expandTypeFromArgs(typeInfo, builder, floatType,
+				                   partAddress, iterator);
+			}
 		} else {
 			const auto value = *iterator++;
 			const auto storeInst = createStore(builder.getBuilder(), value, alloca);
@@ -384,14 +430,34 @@ namespace llvm_abi {
 	Callee::Callee(const ABITypeInfo& typeInfo,
 	               const FunctionType& functionType,
 	               const FunctionIRMapping& functionIRMapping,
-	               Builder& builder)
+	               Builder& builder,
+	               ABIProfiler* const profiler)
 	: typeInfo_(typeInfo),
 	functionType_(functionType),
 	functionIRMapping_(functionIRMapping),
-	builder_(builder) { }
+	builder_(builder),
+	profiler_(profiler),
+	profileSite_(nullptr) { }
+	
+	void Callee::emitProfileUpdates(const uint64_t numCalls,
+	                                const ABIProfileCounts& profileCounts) {
+		if (profiler_ == nullptr) {
+			return;
+		}
+		
+		if (profileSite_ == nullptr) {
+			profileSite_ = profiler_->createSite(getProfileSiteName(builder_, "entry",
+			                                                        functionType_));
+		}
+		
+		profiler_->emitUpdates(builder_, profileSite_, numCalls, profileCounts);
+	}
 	
 	llvm::SmallVector<llvm::Value*, 8>
 	Callee::decodeArguments(llvm::ArrayRef<llvm::Value*> encodedArguments) {
+		ABITimeRegion timeRegion(CalleeDecodingRegion);
+		++NumFunctionsDecoded;
+		
 		assert(functionIRMapping_.totalIRArgs() == encodedArguments.size());
 		
 		// If we're using inalloca, all the memory arguments are GEPs off of the last
@@ -409,6 +475,7 @@ namespace llvm_abi {
 		}
 		
 		llvm::SmallVector<llvm::Value*, 8> arguments;
+		ABIProfileCounts profileCounts;
 		
 		for (size_t argIndex = 0; argIndex < functionType_.argumentTypes().size(); argIndex++) {
 			const auto& argumentType = functionType_.argumentTypes()[argIndex];
@@ -453,10 +520,15 @@ namespace llvm_abi {
 							                                                      i8PtrType);
 							const auto source = builder_.getBuilder().CreateBitCast(value,
 							                                                        i8PtrType);
+							++NumCalleeMemCpys;
 							builder_.getBuilder().CreateMemCpy(dest, /*dstAlign=*/argInfo.getIndirectAlign(),
 										           source, /*srcAlign=*/argInfo.getIndirectAlign(),
 							                                   llvm::ConstantInt::get(typeInfo_.getLLVMType(IntPtrTy),
 							                                                          typeSize.asBytes()));
+							emitMemoryRemark(builder_, "RealignedInMemory",
+							                 argIndex, argumentType,
+							                 "realigned", typeSize);
+							profileCounts.coercedBytes += typeSize;
 							value = alignedTempAlloca;
 						}
 						
@@ -483,9 +555,7 @@ namespace llvm_abi {
 					const auto coerceType = argInfo.getCoerceToType();
 					
 					// If we have the trivial case, handle it with no muss and fuss.
-					if (!coerceType.isStruct() &&
-					    coerceType == argumentType &&
-					    argInfo.getDirectOffset() == 0) {
+					if (isTrivialCoercion(typeInfo_, argumentType, argInfo)) {
 						assert(numIRArgs == 1);
 						
 						auto value = encodedArguments[firstIRArg];
@@ -570,9 +640,14 @@ namespace llvm_abi {
 								createStore(builder_.getBuilder(), argValue, elementPtr);
 							}
 							
+							++NumCalleeMemCpys;
 							builder_.getBuilder().CreateMemCpy(destPtr, /*dstAlign=*/alignmentToUse.asBytes(),
 							                                   tempAlloca, /*srcAlign=*/alignmentToUse.asBytes(),
 							                                   destSize.asBytes());
+							emitMemoryRemark(builder_, "CoercedThroughMemory",
+							                 argIndex, argumentType,
+							                 "coerced through memory", destSize);
+							profileCounts.coercedBytes += destSize;
 						}
 					} else {
 						// Simple case, just do a coerced store of the argument into the alloca.
@@ -585,7 +660,9 @@ namespace llvm_abi {
 						                   argValue,
 						                   destPtr,
 						                   coerceType,
-						                   destType);
+						                   destType,
+						                   argIndex,
+						                   profileCounts);
 					}
 					
 					arguments.push_back(builder_.getBuilder().CreateLoad(alloca));
@@ -612,6 +689,39 @@ namespace llvm_abi {
 					arguments.push_back(loadInst);
 					break;
 				}
+				case ArgInfo::CoerceAndExpand: {
+					// Reconstruct the value in a temporary by storing
+					// each argument to its field of the coerced struct.
+					const auto coerceType = argInfo.getCoerceAndExpandType();
+					const auto coerceLLVMType = typeInfo_.getLLVMType(coerceType);
+					
+					const auto alloca = createMemTemp(typeInfo_,
+					                                  builder_,
+					                                  argumentType,
+					                                  "coerce");
+					const auto destPtr = builder_.getBuilder().CreateBitCast(alloca,
+					                                                         llvm::PointerType::getUnqual(coerceLLVMType));
+					
+					auto irArgIndex = firstIRArg;
+					for (size_t i = 0; i < coerceType.structMembers().size(); i++) {
+						if (ArgInfo::isPaddingForCoerceAndExpand(coerceType.structMembers()[i].type())) {
+							continue;
+						}
+						
+						const auto argValue = encodedArguments[irArgIndex++];
+						const auto elementPtr = createConstGEP2_32(builder_,
+						                                           coerceLLVMType,
+						                                           destPtr,
+						                                           0, i);
+						createStore(builder_.getBuilder(), argValue, elementPtr);
+					}
+					assert(irArgIndex == firstIRArg + numIRArgs);
+					
+					const auto loadInst = builder_.getBuilder().CreateLoad(alloca);
+					loadInst->setAlignment(typeInfo_.getTypeRequiredAlign(argumentType).asBytes());
+					arguments.push_back(loadInst);
+					break;
+				}
 				case ArgInfo::Ignore: {
 					assert(numIRArgs == 0);
 					arguments.push_back(llvm::UndefValue::get(typeInfo_.getLLVMType(argumentType)));
@@ -620,6 +730,8 @@ namespace llvm_abi {
 			}
 		}
 		
+		emitProfileUpdates(/*numCalls=*/1, profileCounts);
+		
 		return arguments;
 	}
 	
@@ -627,6 +739,8 @@ namespace llvm_abi {
 	Callee::encodeReturnValue(llvm::Value* const returnValue,
 	                          llvm::ArrayRef<llvm::Value*> encodedArguments,
 	                          llvm::Value* const /*returnValuePtr*/) {
+		ABITimeRegion timeRegion(CalleeDecodingRegion);
+		
 		assert(returnValue != nullptr);
 		assert(functionIRMapping_.totalIRArgs() == encodedArguments.size());
 		
@@ -657,6 +771,10 @@ namespace llvm_abi {
 				// Value is returned by storing it into the struct-ret pointer argument.
 				createStore(builder_.getBuilder(), returnValue, indirectArg);
 				
+				ABIProfileCounts profileCounts;
+				profileCounts.indirectBytes += typeInfo_.getTypeAllocSize(returnType);
+				emitProfileUpdates(/*numCalls=*/0, profileCounts);
+				
 				// (Nothing is returned by-value.)
 				return llvm::UndefValue::get(typeInfo_.getLLVMType(VoidTy));
 			}
@@ -691,12 +809,57 @@ namespace llvm_abi {
 						sourceType = coerceType;
 					}
 					
-					return createCoercedLoad(typeInfo_,
-					                         builder_,
-					                         sourcePtr,
-					                         sourceType,
-					                         coerceType);
+					ABIProfileCounts profileCounts;
+					const auto value = createCoercedLoad(typeInfo_,
+					                                     builder_,
+					                                     sourcePtr,
+					                                     sourceType,
+					                                     coerceType,
+					                                     /*argumentNumber=*/-1,
+					                                     profileCounts);
+					emitProfileUpdates(/*numCalls=*/0, profileCounts);
+					return value;
+				}
+			}
+			case ArgInfo::CoerceAndExpand: {
+				// Store the value to a temporary and load each
+				// non-padding field of the coerced struct from it.
+				const auto coerceType = returnArgInfo.getCoerceAndExpandType();
+				const auto coerceLLVMType = typeInfo_.getLLVMType(coerceType);
+				
+				const auto alloca = createMemTemp(typeInfo_,
+				                                  builder_,
+				                                  returnType,
+				                                  "coerce");
+				const auto storeInst = createStore(builder_.getBuilder(), returnValue, alloca);
+				storeInst->setAlignment(typeInfo_.getTypeRequiredAlign(returnType).asBytes());
+				
+				const auto sourcePtr = builder_.getBuilder().CreateBitCast(alloca,
+				                                                           llvm::PointerType::getUnqual(coerceLLVMType));
+				
+				llvm::SmallVector<llvm::Value*, 2> results;
+				for (size_t i = 0; i < coerceType.structMembers().size(); i++) {
+					if (ArgInfo::isPaddingForCoerceAndExpand(coerceType.structMembers()[i].type())) {
+						continue;
+					}
+					
+					const auto elementPtr = createConstGEP2_32(builder_,
+					                                           coerceLLVMType,
+					                                           sourcePtr,
+					                                           0, i);
+					results.push_back(builder_.getBuilder().CreateLoad(elementPtr));
+				}
+				
+				if (results.size() == 1) {
+					return results[0];
+				}
+				
+				const auto unpaddedType = returnArgInfo.getUnpaddedCoerceAndExpandType();
+				llvm::Value* value = llvm::UndefValue::get(typeInfo_.getLLVMType(unpaddedType));
+				for (unsigned i = 0; i < results.size(); i++) {
+					value = builder_.getBuilder().CreateInsertValue(value, results[i], i);
 				}
+				return value;
 			}
 			case ArgInfo::Ignore:
 				return llvm::UndefValue::get(typeInfo_.getLLVMType(functionType_.returnType()));
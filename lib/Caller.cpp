@@ -1,4 +1,7 @@
+#include <llvm/ADT/Statistic.h>
 
+#include <llvm-abi/ABIProfiler.hpp>
+#include <llvm-abi/ABITimeRegion.hpp>
 #include <llvm-abi/ABITypeInfo.hpp>
 #include <llvm-abi/Builder.hpp>
 #include <llvm-abi/Caller.hpp>
@@ -6,16 +9,38 @@
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/LLVMUtils.hpp>
 
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumCallsEncoded, "Number of calls encoded for the ABI");
+STATISTIC(NumCallerMemCpys, "Number of memcpys emitted by ABI callers");
+
 namespace llvm_abi {
 	
 	Caller::Caller(const ABITypeInfo& typeInfo,
 	               const FunctionType& functionType,
 	               const FunctionIRMapping& functionIRMapping,
-	               Builder& builder)
+	               Builder& builder,
+	               ABIProfiler* const profiler)
 	: typeInfo_(typeInfo),
 	functionType_(functionType),
 	functionIRMapping_(functionIRMapping),
-	builder_(builder) { }
+	builder_(builder),
+	profiler_(profiler),
+	profileSite_(nullptr) { }
+	
+	void Caller::emitProfileUpdates(const uint64_t numCalls,
+	                                const ABIProfileCounts& profileCounts) {
+		if (profiler_ == nullptr) {
+			return;
+		}
+		
+		if (profileSite_ == nullptr) {
+			profileSite_ = profiler_->createSite(getProfileSiteName(builder_, "call",
+			                                                        functionType_));
+		}
+		
+		profiler_->emitUpdates(builder_, profileSite_, numCalls, profileCounts);
+	}
 	
 	/// EnterStructPointerForCoercedAccess - Given a struct pointer that we are
 	/// accessing some number of bytes out of it, try to gep into the struct to get
@@ -96,12 +121,15 @@ namespace llvm_abi {
 		const auto destIntLLVMType = typeInfo.getLLVMType(destType.isPointer() ? IntPtrTy : destType);
 		
 		if (value->getType() != destIntLLVMType) {
-			if (typeInfo.isBigEndian()) {
+			// Compare the number of bytes each type occupies in
+			// memory, since that determines where the value ends
+			// up when coerced through memory.
+			const auto sourceSize = typeInfo.getTypeStoreSize(sourceType);
+			const auto destSize = typeInfo.getTypeStoreSize(destType);
+			
+			if (typeInfo.isBigEndian() && sourceSize != destSize) {
 				// Preserve the high bits on big-endian targets.
 				// That is what memory coercion does.
-				const auto sourceSize = typeInfo.getTypeRawSize(sourceType);
-				const auto destSize = typeInfo.getTypeRawSize(destType);
-				
 				if (sourceSize > destSize) {
 					value = builder.getBuilder().CreateLShr(value,
 					                                        (sourceSize - destSize).asBits(),
@@ -118,7 +146,9 @@ namespace llvm_abi {
 					                                       "coerce.highbits");
 				}
 			} else {
-				// Little-endian targets preserve the low bits. No shifts required.
+				// Little-endian targets preserve the low bits, as do
+				// big-endian ones when both types occupy the same
+				// bytes (e.g. i1 and i8). No shifts required.
 				value = builder.getBuilder().CreateIntCast(value,
 				                                           destIntLLVMType,
 				                                           false,
@@ -141,11 +171,18 @@ namespace llvm_abi {
 	/// This safely handles the case when the src type is smaller than the
 	/// destination type; in this situation the values of bits which not
 	/// present in the src are undefined.
+	///
+	/// \arg argumentNumber is only used for remarks (-1 for the return value),
+	/// and \arg profileCounts accumulates the bytes copied through memory.
 	static llvm::Value* createCoercedLoad(const ABITypeInfo& typeInfo,
 	                                      Builder& builder,
 	                                      llvm::Value* sourcePtr,
 	                                      Type sourceType,
-	                                      const Type destType) {
+	                                      const Type destType,
+	                                      const int argumentNumber,
+	                                      ABIProfileCounts& profileCounts) {
+		const auto valueType = sourceType;
+		
 		// If source and destination types are the same, just do a load.
 		if (typeInfo.getLLVMType(sourceType) == typeInfo.getLLVMType(destType)) {
 			return builder.getBuilder().CreateLoad(sourcePtr);
@@ -177,8 +214,10 @@ namespace llvm_abi {
 			                                destType);
 		}
 		
-		// If load is legal, just bitcast the src pointer.
-		if (sourceSize >= destSize) {
+		// If load is legal, just bitcast the src pointer. A load
+		// only accesses the store size of its type (e.g. 3 bytes
+		// for i24), which may be less than the alloc size.
+		if (sourceSize >= typeInfo.getTypeStoreSize(destType)) {
 			// Generally sourceSize is never greater than destSize, since this means we are
 			// losing bits. However, this can happen in cases where the structure has
 			// additional padding, for example due to a user specified alignment.
@@ -202,9 +241,14 @@ namespace llvm_abi {
 			const auto casted = builder.getBuilder().CreateBitCast(tmpAlloca, i8PtrType);
 			const auto sourceCasted = builder.getBuilder().CreateBitCast(sourcePtr, i8PtrType);
 			// FIXME: Use better alignment.
+			++NumCallerMemCpys;
 			builder.getBuilder().CreateMemCpy(casted, /*dstAlign=*/1, sourceCasted, /*srcAlign=*/1,
 			                                  llvm::ConstantInt::get(typeInfo.getLLVMType(IntPtrTy),
 			                                                         sourceSize.asBytes()));
+			emitMemoryRemark(builder, "CoercedThroughMemory",
+			                 argumentNumber, valueType,
+			                 "coerced through memory", sourceSize);
+			profileCounts.coercedBytes += sourceSize;
 			return builder.getBuilder().CreateLoad(tmpAlloca);
 		}
 	}
@@ -244,12 +288,17 @@ namespace llvm_abi {
 	///
 	/// This safely handles the case when the src type is larger than the
 	/// destination type; the upper bits of the src will be lost.
+	///
+	/// \arg argumentNumber is only used for remarks (-1 for the return value),
+	/// and \arg profileCounts accumulates the bytes copied through memory.
 	static void createCoercedStore(const ABITypeInfo& typeInfo,
 	                               Builder& builder,
 	                               llvm::Value* const source,
 	                               llvm::Value* destPtr,
 	                               const Type sourceType,
-	                               Type destType) {
+	                               Type destType,
+	                               const int argumentNumber,
+	                               ABIProfileCounts& profileCounts) {
 		if (typeInfo.getLLVMType(sourceType) == typeInfo.getLLVMType(destType)) {
 			createStore(builder.getBuilder(), source, destPtr);
 			return;
@@ -282,8 +331,10 @@ namespace llvm_abi {
 		
 		const auto destSize = typeInfo.getTypeAllocSize(destType);
 		
-		// If store is legal, just bitcast the src pointer.
-		if (sourceSize <= destSize) {
+		// If store is legal, just bitcast the src pointer. As
+		// for loads, only the store size of the source is
+		// written.
+		if (typeInfo.getTypeStoreSize(sourceType) <= destSize) {
 			const auto sourcePtrType =
 				llvm::PointerType::getUnqual(typeInfo.getLLVMType(sourceType));
 			const auto castedDestPtr =
@@ -312,10 +363,15 @@ namespace llvm_abi {
 			const auto casted = builder.getBuilder().CreateBitCast(tempAlloca, i8PtrType);
 			const auto destCasted = builder.getBuilder().CreateBitCast(destPtr, i8PtrType);
 			// FIXME: Use better alignment.
+			++NumCallerMemCpys;
 			builder.getBuilder().CreateMemCpy(destCasted, /*dstAlign=*/1,
 			                                  casted, /*srcAlign=*/1,
 			                                  llvm::ConstantInt::get(typeInfo.getLLVMType(IntPtrTy),
 			                                                         destSize.asBytes()));
+			emitMemoryRemark(builder, "CoercedThroughMemory",
+			                 argumentNumber, destType,
+			                 "coerced through memory", destSize);
+			profileCounts.coercedBytes += destSize;
 		}
 	}
 	
@@ -334,7 +390,7 @@ namespace llvm_abi {
 				                                               0, i);
 				const auto elementIRType = typeInfo.getLLVMType(type.arrayElementType());
 				const auto castAddress = builder.getBuilder().CreateBitCast(elementAddress, elementIRType->getPointerTo());
-				expandTypeToArgs(typeInfo, builder, type,
+				expandTypeToArgs(typeInfo, builder, type.arrayElementType(),
 				                 castAddress, iterator);
 			}
 		} else if (type.isStruct()) {
@@ -389,7 +445,16 @@ namespace llvm_abi {
 			expandTypeToArgs(typeInfo, builder, largestType,
 			                 castAddress, iterator);
 		} else if (type.isComplex()) {
-			llvm_unreachable("TODO");
+			// The real and imaginary parts.
+			const auto floatType = type.complexFloatingPointType();
+			for (unsigned i = 0; i < 2; i++) {
+				const auto partAddress = createConstGEP2_32(builder,
+				                                            typeInfo.getLLVMType(type),
+				                                            alloca,
+				                                            0, i);
+				expandTypeToArgs(typeInfo, builder, floatType,
+				                 partAddress, iterator);
+			}
 		} else {
 			const auto loadInst = builder.getBuilder().CreateLoad(alloca);
 			loadInst->setAlignment(typeInfo.getTypeRequiredAlign(type).asBytes());
@@ -400,6 +465,9 @@ namespace llvm_abi {
 	llvm::SmallVector<llvm::Value*, 8>
 	Caller::encodeArguments(llvm::ArrayRef<TypedValue> arguments,
 	                        llvm::Value* const returnValuePtr) {
+		ABITimeRegion timeRegion(CallerEncodingRegion);
+		++NumCallsEncoded;
+		
 		// Number of arguments must be equal to or exceed (in the case
 		// of varargs) the number of specified argument types.
 		assert(arguments.size() >= functionType_.argumentTypes().size());
@@ -407,6 +475,8 @@ namespace llvm_abi {
 		llvm::SmallVector<llvm::Value*, 8> irCallArgs(functionIRMapping_.totalIRArgs());
 		const auto& returnArgInfo = functionIRMapping_.returnArgInfo();
 		
+		ABIProfileCounts profileCounts;
+		
 		// If we're using inalloca, insert the allocation after the stack save.
  		llvm::Value* argMemory = nullptr;
 // 		if (llvm::StructType* argStruct = callInfo.getArgStruct()) {
@@ -428,6 +498,14 @@ namespace llvm_abi {
 				structRetPtr = createMemTemp(typeInfo_, builder_,
 				                             functionType_.returnType());
 			}
+			if (returnArgInfo.isIndirect()) {
+				const auto returnSize = typeInfo_.getTypeAllocSize(functionType_.returnType());
+				emitMemoryRemark(builder_, "ReturnedInMemory",
+				                 /*argumentNumber=*/-1, functionType_.returnType(),
+				                 returnArgInfo.getIndirectReasonString(),
+				                 returnSize);
+				profileCounts.indirectBytes += returnSize;
+			}
 			if (functionIRMapping_.hasStructRetArg()) {
 				irCallArgs[functionIRMapping_.structRetArgIndex()] = structRetPtr;
 			} else {
@@ -492,6 +570,17 @@ namespace llvm_abi {
 						                                   argumentValue,
 						                                   allocaInst);
 						storeInst->setAlignment(allocaInst->getAlignment());
+						
+						const auto argumentSize = typeInfo_.getTypeAllocSize(argumentType);
+						emitMemoryRemark(builder_, "PassedInMemory",
+						                 argumentNumber, argumentType,
+						                 argInfo.getIndirectReasonString(),
+						                 argumentSize);
+						if (argInfo.getIndirectByVal()) {
+							profileCounts.byValBytes += argumentSize;
+						} else {
+							profileCounts.indirectBytes += argumentSize;
+						}
 					} else {
 						// We want to avoid creating an unnecessary temporary+copy here;
 						// however, we need one in three cases:
@@ -515,9 +604,7 @@ namespace llvm_abi {
 					const auto coerceType = argInfo.getCoerceToType();
 					
 					// Handle the trivial case.
-					if (!coerceType.isStruct() &&
-					    coerceType == argumentType &&
-					    argInfo.getDirectOffset() == 0) {
+					if (isTrivialCoercion(typeInfo_, argumentType, argInfo)) {
 						assert(numIRArgs == 1);
 						auto value = argumentValue;
 						
@@ -576,9 +663,14 @@ namespace llvm_abi {
 							                                         builder_,
 							                                         coerceType,
 							                                         sourcePtr->getName() + ".coerce");
+							++NumCallerMemCpys;
 							builder_.getBuilder().CreateMemCpy(tempAlloca, /*dstAlign=*/1,
 							                                   sourcePtr, /*srcAlign=*/1,
 							                                   sourceSize.asBytes());
+							emitMemoryRemark(builder_, "CoercedThroughMemory",
+							                 argumentNumber, argumentType,
+							                 "coerced through memory", sourceSize);
+							profileCounts.coercedBytes += sourceSize;
 							sourcePtr = tempAlloca;
 						} else {
 							sourcePtr = builder_.getBuilder().CreateBitCast(sourcePtr, llvm::PointerType::getUnqual(typeInfo_.getLLVMType(coerceType)));
@@ -603,7 +695,9 @@ namespace llvm_abi {
 						                                           builder_,
 						                                           sourcePtr,
 						                                           argumentType,
-						                                           coerceType);
+						                                           coerceType,
+						                                           argumentNumber,
+						                                           profileCounts);
 					}
 					break;
 				}
@@ -627,9 +721,42 @@ namespace llvm_abi {
 					assert(iterator == irCallArgs.begin() + firstIRArg + numIRArgs);
 					break;
 				}
+
+				case ArgInfo::CoerceAndExpand: {
+					// Store the value to a temporary and load each
+					// non-padding field of the coerced struct from it.
+					const auto coerceType = argInfo.getCoerceAndExpandType();
+					const auto coerceLLVMType = typeInfo_.getLLVMType(coerceType);
+					
+					const auto alloca = createMemTemp(typeInfo_,
+					                                  builder_,
+					                                  argumentType,
+					                                  "coerce.arg.source");
+					createStore(builder_.getBuilder(), argumentValue, alloca);
+					
+					const auto sourcePtr = builder_.getBuilder().CreateBitCast(alloca,
+					                                                           llvm::PointerType::getUnqual(coerceLLVMType));
+					
+					auto irArgIndex = firstIRArg;
+					for (size_t i = 0; i < coerceType.structMembers().size(); i++) {
+						if (ArgInfo::isPaddingForCoerceAndExpand(coerceType.structMembers()[i].type())) {
+							continue;
+						}
+						
+						const auto elementPtr = createConstGEP2_32(builder_,
+						                                           coerceLLVMType,
+						                                           sourcePtr,
+						                                           0, i);
+						irCallArgs[irArgIndex++] = builder_.getBuilder().CreateLoad(elementPtr);
+					}
+					assert(irArgIndex == firstIRArg + numIRArgs);
+					break;
+				}
 			}
 		}
 		
+		emitProfileUpdates(/*numCalls=*/1, profileCounts);
+		
 		return irCallArgs;
 	}
 	
@@ -637,6 +764,8 @@ namespace llvm_abi {
 	Caller::decodeReturnValue(llvm::ArrayRef<llvm::Value*> encodedArguments,
 	                          llvm::Value* const encodedReturnValue,
 	                          llvm::Value* const returnValuePtr) {
+		ABITimeRegion timeRegion(CallerEncodingRegion);
+		
 		const auto& returnArgInfo = functionIRMapping_.returnArgInfo();
 		const auto returnType = functionType_.returnType();
 		switch (returnArgInfo.getKind()) {
@@ -707,12 +836,60 @@ namespace llvm_abi {
 					destType = coerceType;
 				}
 				
+				ABIProfileCounts profileCounts;
 				createCoercedStore(typeInfo_,
 				                   builder_,
 				                   encodedReturnValue,
 				                   storePtr,
 				                   coerceType,
-				                   destType);
+				                   destType,
+				                   /*argumentNumber=*/-1,
+				                   profileCounts);
+				emitProfileUpdates(/*numCalls=*/0, profileCounts);
+				
+				const auto loadInst = builder_.getBuilder().CreateLoad(destPtr);
+				loadInst->setAlignment(typeInfo_.getTypeRequiredAlign(returnType).asBytes());
+				return loadInst;
+			}
+
+			case ArgInfo::CoerceAndExpand: {
+				// Store each returned field at its offset in
+				// the coerced struct.
+				const auto coerceType = returnArgInfo.getCoerceAndExpandType();
+				const auto coerceLLVMType = typeInfo_.getLLVMType(coerceType);
+				
+				auto destPtr = returnValuePtr;
+				if (destPtr == nullptr) {
+					destPtr = createMemTemp(typeInfo_,
+					                        builder_,
+					                        returnType,
+					                        "coerce");
+				}
+				
+				const auto storePtr = builder_.getBuilder().CreateBitCast(destPtr,
+				                                                          llvm::PointerType::getUnqual(coerceLLVMType));
+				
+				const bool requiresExtract = encodedReturnValue->getType()->isStructTy();
+				unsigned unpaddedIndex = 0;
+				for (size_t i = 0; i < coerceType.structMembers().size(); i++) {
+					if (ArgInfo::isPaddingForCoerceAndExpand(coerceType.structMembers()[i].type())) {
+						continue;
+					}
+					
+					auto element = encodedReturnValue;
+					if (requiresExtract) {
+						element = builder_.getBuilder().CreateExtractValue(encodedReturnValue,
+						                                                   unpaddedIndex++);
+					} else {
+						assert(unpaddedIndex == 0);
+					}
+					
+					const auto elementPtr = createConstGEP2_32(builder_,
+					                                           coerceLLVMType,
+					                                           storePtr,
+					                                           0, i);
+					createStore(builder_.getBuilder(), element, elementPtr);
+				}
 				
 				const auto loadInst = builder_.getBuilder().CreateLoad(destPtr);
 				loadInst->setAlignment(typeInfo_.getTypeRequiredAlign(returnType).asBytes());
@@ -0,0 +1,178 @@
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABIFunctionPlan.hpp>
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/Builder.hpp>
+#include <llvm-abi/Callee.hpp>
+#include <llvm-abi/Caller.hpp>
+#include <llvm-abi/DefaultABI.hpp>
+#include <llvm-abi/FunctionEncoder.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypePromoter.hpp>
+
+namespace llvm_abi {
+	
+	DefaultABI::DefaultABI(llvm::Module* const module,
+	                       std::shared_ptr<const ABITarget> target)
+	: target_(std::move(target)),
+	llvmContext_(module->getContext()),
+	typeInfo_(llvmContext_, target_->typeLayout(),
+	          /*delegate=*/*this) { }
+	
+	DefaultABI::~DefaultABI() { }
+	
+	std::string DefaultABI::name() const {
+		return target_->name();
+	}
+	
+	const ABITypeInfo& DefaultABI::typeInfo() const {
+		return typeInfo_;
+	}
+	
+	llvm::Type* DefaultABI::getLongDoubleIRType() const {
+		return target_->getLongDoubleIRType(llvmContext_);
+	}
+	
+	llvm::CallingConv::ID DefaultABI::getCallingConvention(const CallingConvention callingConvention) const {
+		return target_->getCallingConvention(callingConvention);
+	}
+	
+	const ABITarget& DefaultABI::target() const {
+		return *target_;
+	}
+	
+	llvm::FunctionType* DefaultABI::getFunctionType(const FunctionType& functionType) const {
+		const auto plan = target_->getFunctionPlan(functionType);
+		
+		return llvm_abi::getFunctionType(llvmContext_,
+		                                 typeInfo_,
+		                                 functionType,
+		                                 plan.functionIRMapping());
+	}
+	
+	llvm::AttributeList DefaultABI::getAttributes(const FunctionType& functionType,
+	                                              llvm::ArrayRef<Type> argumentTypes,
+	                                              const llvm::AttributeList existingAttributes) const {
+		const auto plan = target_->getFunctionPlan(functionType,
+		                                           argumentTypes);
+		
+		return target_->getFunctionAttributes(llvmContext_,
+		                                      typeInfo_,
+		                                      plan.functionIRMapping(),
+		                                      existingAttributes);
+	}
+	
+	ABICallCost DefaultABI::getCallCost(const FunctionType& functionType,
+	                                    llvm::ArrayRef<Type> argumentTypes) const {
+		return target_->getCallCost(functionType, argumentTypes);
+	}
+	
+	llvm::Value* DefaultABI::createCall(Builder& builder,
+	                                    const FunctionType& functionType,
+	                                    std::function<llvm::Value* (llvm::ArrayRef<llvm::Value*>)> callBuilder,
+	                                    llvm::ArrayRef<TypedValue> rawArguments) const {
+		for (size_t i = 0; i < rawArguments.size(); i++) {
+			assert(i >= functionType.argumentTypes().size() ||
+			       rawArguments[i].type() == functionType.argumentTypes()[i]);
+		}
+		
+		TypePromoter typePromoter(typeInfo());
+		
+		// Promote any varargs arguments (that haven't already been
+		// promoted). This changes char => int, float => double etc.
+		const auto arguments = typePromoter.promoteArguments(builder,
+		                                                     functionType,
+		                                                     rawArguments);
+		
+		llvm::SmallVector<Type, 8> argumentTypes;
+		for (const auto& value: arguments) {
+			argumentTypes.push_back(value.type());
+		}
+		
+		const auto plan = target_->getFunctionPlan(functionType,
+		                                           argumentTypes);
+		
+		Caller caller(typeInfo_,
+		              functionType,
+		              plan.functionIRMapping(),
+		              builder,
+		              profiler());
+		
+		const auto encodedArguments = caller.encodeArguments(arguments);
+		
+		const auto returnValue = callBuilder(encodedArguments);
+		
+		return caller.decodeReturnValue(encodedArguments, returnValue);
+	}
+	
+	namespace {
+		
+		class DefaultFunctionEncoder: public FunctionEncoder {
+		public:
+			DefaultFunctionEncoder(const DefaultABI& abi,
+			                       Builder& builder,
+			                       const FunctionType& functionType,
+			                       llvm::ArrayRef<llvm::Value*> pArguments)
+			: builder_(builder),
+			functionIRMapping_(abi.target().getFunctionPlan(functionType).functionIRMapping()),
+			callee_(abi.typeInfo(),
+			        functionType,
+			        functionIRMapping_,
+			        builder,
+			        abi.profiler()),
+			encodedArguments_(pArguments.begin(), pArguments.end()),
+			arguments_(callee_.decodeArguments(pArguments)) { }
+			
+			llvm::ArrayRef<llvm::Value*> arguments() const {
+				return arguments_;
+			}
+			
+			llvm::ReturnInst* returnValue(llvm::Value* const value) {
+				const auto encodedReturnValue = callee_.encodeReturnValue(value,
+				                                                          encodedArguments_);
+				if (encodedReturnValue->getType()->isVoidTy()) {
+					return builder_.getBuilder().CreateRetVoid();
+				} else {
+					return builder_.getBuilder().CreateRet(encodedReturnValue);
+				}
+			}
+			
+			llvm::Value* returnValuePointer() const {
+				// Only values returned via 'sret' are in memory.
+				if (!functionIRMapping_.hasStructRetArg()) {
+					return nullptr;
+				}
+				
+				return encodedArguments_[functionIRMapping_.structRetArgIndex()];
+			}
+		
+		private:
+			Builder& builder_;
+			FunctionIRMapping functionIRMapping_;
+			Callee callee_;
+			llvm::SmallVector<llvm::Value*, 8> encodedArguments_;
+			llvm::SmallVector<llvm::Value*, 8> arguments_;
+		
+		};
+	
+	}
+	
+	std::unique_ptr<FunctionEncoder>
+	DefaultABI::createFunctionEncoder(Builder& builder,
+	                                  const FunctionType& functionType,
+	                                  llvm::ArrayRef<llvm::Value*> arguments) const {
+		return std::unique_ptr<FunctionEncoder>(new DefaultFunctionEncoder(*this,
+		                                                                   builder,
+		                                                                   functionType,
+		                                                                   arguments));
+	}
+
+}
@@ -1,139 +1,83 @@
+#include <map>
+#include <string>
+
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Type.h>
 
 #include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/DataSize.hpp>
 #include <llvm-abi/DefaultABITypeInfo.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
 
 namespace llvm_abi {
 	
 	DefaultABITypeInfo::DefaultABITypeInfo(llvm::LLVMContext& llvmContext,
-	                                       const ABITypeInfo& typeInfo,
+	                                       const ABITypeLayout& typeLayout,
 	                                       const DefaultABITypeInfoDelegate& delegate)
 	: llvmContext_(llvmContext),
-	typeInfo_(typeInfo),
+	typeLayout_(typeLayout),
 	delegate_(delegate) { }
 	
 	DefaultABITypeInfo::~DefaultABITypeInfo() { }
 	
-	DataSize
-	DefaultABITypeInfo::getDefaultTypeRawSize(const Type type) const {
-		switch (type.kind()) {
-			case VoidType:
-				return DataSize::Bytes(0);
-			case PointerType:
-				return delegate_.getPointerSize();
-			case UnspecifiedWidthIntegerType:
-				return delegate_.getIntSize(type.integerKind());
-			case FixedWidthIntegerType:
-				return type.integerWidth();
-			case FloatingPointType:
-				return delegate_.getFloatSize(type.floatingPointKind());
-			case ComplexType:
-				return delegate_.getComplexSize(type.complexKind());
-			case StructType: {
-				auto size = DataSize::Bytes(0);
-				
-				for (const auto& member: type.structMembers()) {
-					if (member.offset() < size) {
-						// Add necessary padding before this member.
-						size = size.roundUpToAlign(typeInfo_.getTypeRequiredAlign(member.type()));
-					} else {
-						size = member.offset();
-					}
-					
-					// Add the member's size.
-					size += typeInfo_.getTypeAllocSize(member.type());
-				}
-				
-				// Add any final padding.
-				return size.roundUpToAlign(typeInfo_.getTypeRequiredAlign(type));
-			}
-			case UnionType: {
-				auto size = DataSize::Bytes(0);
-				
-				for (const auto& member: type.unionMembers()) {
-					const auto memberSize = typeInfo_.getTypeAllocSize(member.type());
-					size = std::max<DataSize>(size, memberSize);
-				}
-				
-				// Add any final padding.
-				return size.roundUpToAlign(typeInfo_.getTypeRequiredAlign(type));
-			}
-			case ArrayType:
-				// TODO: this is probably wrong...
-				return typeInfo_.getTypeRawSize(type.arrayElementType()) * type.arrayElementCount();
-			case VectorType:
-				// TODO: this is probably wrong...
-				return typeInfo_.getTypeRawSize(type.vectorElementType()) * type.vectorElementCount();
-		}
-		llvm_unreachable("Unknown ABI type.");
+	const ABITypeLayout& DefaultABITypeInfo::typeLayout() const {
+		return typeLayout_;
 	}
 	
-	DataSize
-	DefaultABITypeInfo::getDefaultTypeAllocSize(const Type type) const {
-		if (type.isFixedWidthInteger()) {
-			return type.integerWidth().roundUpToPowerOf2Bytes();
-		}
-		
-		return typeInfo_.getTypeRawSize(type).roundUpToAlign(DataSize::Bytes(1));
+	const TypeBuilder& DefaultABITypeInfo::typeBuilder() const {
+		return typeLayout_.typeBuilder();
 	}
 	
-	DataSize
-	DefaultABITypeInfo::getDefaultTypeStoreSize(const Type type) const {
-		return typeInfo_.getTypeRawSize(type).roundUpToAlign(DataSize::Bytes(1));
+	DataSize DefaultABITypeInfo::getTypeRawSize(const Type type) const {
+		return typeLayout_.getTypeRawSize(type);
 	}
 	
-	DataSize
-	DefaultABITypeInfo::getDefaultTypeRequiredAlign(const Type type) const {
-		switch (type.kind()) {
-			case VoidType:
-				return DataSize::Bytes(0);
-			case PointerType:
-				return delegate_.getPointerAlign();
-			case UnspecifiedWidthIntegerType: {
-				return delegate_.getIntAlign(type.integerKind());
-			}
-			case FixedWidthIntegerType: {
-				return type.integerWidth().roundUpToPowerOf2Bytes();
-			}
-			case FloatingPointType: {
-				return delegate_.getFloatAlign(type.floatingPointKind());
-			}
-			case ComplexType: {
-				return delegate_.getComplexAlign(type.complexKind());
-			}
-			case StructType: {
-				auto mostStrictAlign = DataSize::Bytes(1);
-				for (const auto& member: type.structMembers()) {
-					const auto align = typeInfo_.getTypeRequiredAlign(member.type());
-					mostStrictAlign = std::max<DataSize>(mostStrictAlign, align);
-				}
-				
-				return mostStrictAlign;
-			}
-			case UnionType: {
-				auto mostStrictAlign = DataSize::Bytes(1);
-				for (const auto& member: type.unionMembers()) {
-					const auto align = typeInfo_.getTypeRequiredAlign(member.type());
-					mostStrictAlign = std::max<DataSize>(mostStrictAlign, align);
-				}
-				
-				return mostStrictAlign;
-			}
-			case ArrayType: {
-				return delegate_.getArrayAlign(type);
-			}
-			case VectorType: {
-				return delegate_.getVectorAlign(type);
-			}
-		}
-		llvm_unreachable("Unknown type kind.");
+	DataSize DefaultABITypeInfo::getTypeAllocSize(const Type type) const {
+		return typeLayout_.getTypeAllocSize(type);
+	}
+	
+	DataSize DefaultABITypeInfo::getTypeStoreSize(const Type type) const {
+		return typeLayout_.getTypeStoreSize(type);
+	}
+	
+	DataSize DefaultABITypeInfo::getTypeRequiredAlign(const Type type) const {
+		return typeLayout_.getTypeRequiredAlign(type);
+	}
+	
+	DataSize DefaultABITypeInfo::getTypePreferredAlign(const Type type) const {
+		return typeLayout_.getTypePreferredAlign(type);
+	}
+	
+	llvm::Type* DefaultABITypeInfo::getLLVMType(const Type type) const {
+		return getDefaultLLVMType(type);
+	}
+	
+	llvm::SmallVector<DataSize, 8>
+	DefaultABITypeInfo::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+		return typeLayout_.calculateStructOffsets(structMembers);
+	}
+	
+	bool DefaultABITypeInfo::isLegalVectorType(const Type type) const {
+		return typeLayout_.isLegalVectorType(type);
+	}
+	
+	bool DefaultABITypeInfo::isBigEndian() const {
+		return typeLayout_.isBigEndian();
+	}
+	
+	bool DefaultABITypeInfo::isCharSigned() const {
+		return typeLayout_.isCharSigned();
+	}
+	
+	bool DefaultABITypeInfo::isHomogeneousAggregateBaseType(const Type type) const {
+		return typeLayout_.isHomogeneousAggregateBaseType(type);
 	}
 	
-	DataSize
-	DefaultABITypeInfo::getDefaultTypePreferredAlign(const Type type) const {
-		return typeInfo_.getTypeRequiredAlign(type);
+	bool DefaultABITypeInfo::isHomogeneousAggregateSmallEnough(const Type base,
+	                                                           const uint64_t members) const {
+		return typeLayout_.isHomogeneousAggregateSmallEnough(base, members);
 	}
 	
 	llvm::StructType*
@@ -164,7 +108,7 @@ namespace llvm_abi {
 			case UnspecifiedWidthIntegerType:
 			case FixedWidthIntegerType: {
 				return llvm::IntegerType::get(llvmContext_,
-				                              typeInfo_.getTypeRawSize(type).asBits());
+				                              typeLayout_.getTypeRawSize(type).asBits());
 			}
 			case FloatingPointType: {
 				switch (type.floatingPointKind()) {
@@ -182,12 +126,14 @@ namespace llvm_abi {
 				llvm_unreachable("Unknown Float type kind.");
 			}
 			case ComplexType: {
-				llvm_unreachable("TODO");
+				// The real and imaginary parts, as clang does.
+				const auto floatType = getLLVMType(type.complexFloatingPointType());
+				return llvm::StructType::get(llvmContext_, { floatType, floatType });
 			}
 			case StructType: {
 				llvm::SmallVector<llvm::Type*, 8> members;
 				for (const auto& structMember: type.structMembers()) {
-					members.push_back(typeInfo_.getLLVMType(structMember.type()));
+					members.push_back(getLLVMType(structMember.type()));
 				}
 				return getLLVMStructType(type.structName(), members);
 			}
@@ -195,10 +141,10 @@ namespace llvm_abi {
 				auto maxSize = DataSize::Bytes(0);
 				llvm::Type* maxSizeLLVMType = nullptr;
 				for (const auto& member: type.unionMembers()) {
-					const auto size = typeInfo_.getTypeAllocSize(member.type());
+					const auto size = typeLayout_.getTypeAllocSize(member.type());
 					if (size > maxSize) {
 						maxSize = size;
-						maxSizeLLVMType = typeInfo_.getLLVMType(member.type());
+						maxSizeLLVMType = getLLVMType(member.type());
 					}
 				}
 				llvm::SmallVector<llvm::Type*, 1> members;
@@ -208,11 +154,11 @@ namespace llvm_abi {
 				return getLLVMStructType(type.unionName(), members);
 			}
 			case ArrayType: {
-				return llvm::ArrayType::get(typeInfo_.getLLVMType(type.arrayElementType()),
+				return llvm::ArrayType::get(getLLVMType(type.arrayElementType()),
 				                            type.arrayElementCount());
 			}
 			case VectorType: {
-				return llvm::VectorType::get(typeInfo_.getLLVMType(type.vectorElementType()),
+				return llvm::VectorType::get(getLLVMType(type.vectorElementType()),
 				                             type.vectorElementCount());
 			}
 		}
@@ -220,27 +166,4 @@ namespace llvm_abi {
 		llvm_unreachable("Unknown type for creating IR type.");
 	}
 	
-	llvm::SmallVector<DataSize, 8>
-	DefaultABITypeInfo::calculateDefaultStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
-		llvm::SmallVector<DataSize, 8> offsets;
-		offsets.reserve(structMembers.size());
-		
-		auto offset = DataSize::Bytes(0);
-		for (const auto& member: structMembers) {
-			if (member.offset() < offset) {
-				// Add necessary padding before this member.
-				offset = offset.roundUpToAlign(typeInfo_.getTypeRequiredAlign(member.type()));
-			} else {
-				offset = member.offset();
-			}
-			
-			offsets.push_back(offset);
-			
-			// Add the member's size.
-			offset += typeInfo_.getTypeAllocSize(member.type());
-		}
-		
-		return offsets;
-	}
-
 }
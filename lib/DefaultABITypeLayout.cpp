@@ -0,0 +1,213 @@
+#include <algorithm>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Statistic.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumTypeSizesComputed, "Number of ABI type sizes computed");
+STATISTIC(NumTypeAlignsComputed, "Number of ABI type alignments computed");
+
+namespace llvm_abi {
+	
+	DefaultABITypeLayout::DefaultABITypeLayout(const ABITypeLayout& typeLayout,
+	                                           const DefaultABITypeLayoutDelegate& delegate,
+	                                           const ABICache* const cache)
+	: typeLayout_(typeLayout),
+	delegate_(delegate),
+	cache_(cache) { }
+	
+	DefaultABITypeLayout::~DefaultABITypeLayout() { }
+	
+	DataSize
+	DefaultABITypeLayout::getDefaultTypeRawSize(const Type type) const {
+		if (cache_ == nullptr) {
+			return computeDefaultTypeRawSize(type);
+		}
+		
+		auto size = DataSize::Bytes(0);
+		if (cache_->lookupTypeRawSize(type, size)) {
+			return size;
+		}
+		
+		size = computeDefaultTypeRawSize(type);
+		cache_->insertTypeRawSize(type, size);
+		return size;
+	}
+	
+	DataSize
+	DefaultABITypeLayout::computeDefaultTypeRawSize(const Type type) const {
+		ABITimeRegion timeRegion(TypeLayoutRegion);
+		++NumTypeSizesComputed;
+		
+		switch (type.kind()) {
+			case VoidType:
+				return DataSize::Bytes(0);
+			case PointerType:
+				return delegate_.getPointerSize();
+			case UnspecifiedWidthIntegerType:
+				return delegate_.getIntSize(type.integerKind());
+			case FixedWidthIntegerType:
+				return type.integerWidth();
+			case FloatingPointType:
+				return delegate_.getFloatSize(type.floatingPointKind());
+			case ComplexType:
+				return delegate_.getComplexSize(type.complexKind());
+			case StructType: {
+				auto size = DataSize::Bytes(0);
+				
+				for (const auto& member: type.structMembers()) {
+					if (member.offset() < size) {
+						// Add necessary padding before this member.
+						size = size.roundUpToAlign(typeLayout_.getTypeRequiredAlign(member.type()));
+					} else {
+						size = member.offset();
+					}
+					
+					// Add the member's size.
+					size += typeLayout_.getTypeAllocSize(member.type());
+				}
+				
+				// Add any final padding.
+				return size.roundUpToAlign(typeLayout_.getTypeRequiredAlign(type));
+			}
+			case UnionType: {
+				auto size = DataSize::Bytes(0);
+				
+				for (const auto& member: type.unionMembers()) {
+					const auto memberSize = typeLayout_.getTypeAllocSize(member.type());
+					size = std::max<DataSize>(size, memberSize);
+				}
+				
+				// Add any final padding.
+				return size.roundUpToAlign(typeLayout_.getTypeRequiredAlign(type));
+			}
+			case ArrayType:
+				// TODO: this is probably wrong...
+				return typeLayout_.getTypeRawSize(type.arrayElementType()) * type.arrayElementCount();
+			case VectorType:
+				// TODO: this is probably wrong...
+				return typeLayout_.getTypeRawSize(type.vectorElementType()) * type.vectorElementCount();
+		}
+		llvm_unreachable("Unknown ABI type.");
+	}
+	
+	DataSize
+	DefaultABITypeLayout::getDefaultTypeAllocSize(const Type type) const {
+		if (type.isFixedWidthInteger()) {
+			return type.integerWidth().roundUpToPowerOf2Bytes();
+		}
+		
+		return typeLayout_.getTypeRawSize(type).roundUpToAlign(DataSize::Bytes(1));
+	}
+	
+	DataSize
+	DefaultABITypeLayout::getDefaultTypeStoreSize(const Type type) const {
+		return typeLayout_.getTypeRawSize(type).roundUpToAlign(DataSize::Bytes(1));
+	}
+	
+	DataSize
+	DefaultABITypeLayout::getDefaultTypeRequiredAlign(const Type type) const {
+		if (cache_ == nullptr) {
+			return computeDefaultTypeRequiredAlign(type);
+		}
+		
+		auto align = DataSize::Bytes(0);
+		if (cache_->lookupTypeRequiredAlign(type, align)) {
+			return align;
+		}
+		
+		align = computeDefaultTypeRequiredAlign(type);
+		cache_->insertTypeRequiredAlign(type, align);
+		return align;
+	}
+	
+	DataSize
+	DefaultABITypeLayout::computeDefaultTypeRequiredAlign(const Type type) const {
+		ABITimeRegion timeRegion(TypeLayoutRegion);
+		++NumTypeAlignsComputed;
+		
+		switch (type.kind()) {
+			case VoidType:
+				return DataSize::Bytes(0);
+			case PointerType:
+				return delegate_.getPointerAlign();
+			case UnspecifiedWidthIntegerType: {
+				return delegate_.getIntAlign(type.integerKind());
+			}
+			case FixedWidthIntegerType: {
+				return type.integerWidth().roundUpToPowerOf2Bytes();
+			}
+			case FloatingPointType: {
+				return delegate_.getFloatAlign(type.floatingPointKind());
+			}
+			case ComplexType: {
+				return delegate_.getComplexAlign(type.complexKind());
+			}
+			case StructType: {
+				auto mostStrictAlign = DataSize::Bytes(1);
+				for (const auto& member: type.structMembers()) {
+					const auto align = typeLayout_.getTypeRequiredAlign(member.type());
+					mostStrictAlign = std::max<DataSize>(mostStrictAlign, align);
+				}
+				
+				return mostStrictAlign;
+			}
+			case UnionType: {
+				auto mostStrictAlign = DataSize::Bytes(1);
+				for (const auto& member: type.unionMembers()) {
+					const auto align = typeLayout_.getTypeRequiredAlign(member.type());
+					mostStrictAlign = std::max<DataSize>(mostStrictAlign, align);
+				}
+				
+				return mostStrictAlign;
+			}
+			case ArrayType: {
+				return delegate_.getArrayAlign(type);
+			}
+			case VectorType: {
+				return delegate_.getVectorAlign(type);
+			}
+		}
+		llvm_unreachable("Unknown type kind.");
+	}
+	
+	DataSize
+	DefaultABITypeLayout::getDefaultTypePreferredAlign(const Type type) const {
+		return typeLayout_.getTypeRequiredAlign(type);
+	}
+	
+	llvm::SmallVector<DataSize, 8>
+	DefaultABITypeLayout::calculateDefaultStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+		ABITimeRegion timeRegion(TypeLayoutRegion);
+		
+		llvm::SmallVector<DataSize, 8> offsets;
+		offsets.reserve(structMembers.size());
+		
+		auto offset = DataSize::Bytes(0);
+		for (const auto& member: structMembers) {
+			if (member.offset() < offset) {
+				// Add necessary padding before this member.
+				offset = offset.roundUpToAlign(typeLayout_.getTypeRequiredAlign(member.type()));
+			} else {
+				offset = member.offset();
+			}
+			
+			offsets.push_back(offset);
+			
+			// Add the member's size.
+			offset += typeLayout_.getTypeAllocSize(member.type());
+		}
+		
+		return offsets;
+	}
+
+}
@@ -0,0 +1,446 @@
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/TargetSelect.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/Builder.hpp>
+#include <llvm-abi/DynamicCaller.hpp>
+#include <llvm-abi/DynamicClosure.hpp>
+#include <llvm-abi/FunctionEncoder.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/LLVMUtils.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+#include <llvm-abi/TypedValue.hpp>
+
+namespace llvm_abi {
+	
+	namespace {
+		
+		/**
+		 * \brief Builder for thunks, which have a single block.
+		 */
+		class ThunkBuilder: public Builder {
+		public:
+			ThunkBuilder(llvm::Function& function)
+			: function_(function),
+			builder_(&(function.getEntryBlock())) { }
+			
+			IRBuilder& getEntryBuilder() {
+				if (!function_.getEntryBlock().empty()) {
+					builder_.SetInsertPoint(&(function_.getEntryBlock().front()));
+				}
+				return builder_;
+			}
+			
+			IRBuilder& getBuilder() {
+				builder_.SetInsertPoint(&(function_.getEntryBlock()));
+				return builder_;
+			}
+		
+		private:
+			llvm::Function& function_;
+			IRBuilder builder_;
+		
+		};
+		
+		std::vector<std::string> getHostFeatures() {
+			std::vector<std::string> features;
+			llvm::StringMap<bool> hostFeatures;
+			if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+				for (const auto& feature: hostFeatures) {
+					features.push_back((feature.getValue() ? "+" : "-") +
+					                   feature.getKey().str());
+				}
+			}
+			return features;
+		}
+		
+		/**
+		 * \brief Add a 'nest' parameter before a function's parameters.
+		 *
+		 * The nest parameter is passed in a register that isn't
+		 * otherwise used for arguments, so the other parameters
+		 * keep their ABI encoding.
+		 */
+		llvm::AttributeList addNestParameter(llvm::LLVMContext& context,
+		                                     const llvm::AttributeList& attributes,
+		                                     const unsigned numParams) {
+			llvm::SmallVector<llvm::AttributeSet, 8> paramAttributes;
+			paramAttributes.push_back(llvm::AttributeSet::get(context,
+			                                                  { llvm::Attribute::get(context,
+			                                                                         llvm::Attribute::Nest) }));
+			for (unsigned i = 0; i < numParams; i++) {
+				paramAttributes.push_back(attributes.getParamAttributes(i));
+			}
+			return llvm::AttributeList::get(context,
+			                                attributes.getFnAttributes(),
+			                                attributes.getRetAttributes(),
+			                                paramAttributes);
+		}
+		
+		bool hostSupportsTrampolines() {
+			const llvm::Triple triple(llvm::sys::getProcessTriple());
+			return triple.getArch() == llvm::Triple::x86 ||
+			       triple.getArch() == llvm::Triple::x86_64;
+		}
+		
+		std::shared_ptr<ABITarget> createHostTarget() {
+			llvm::InitializeNativeTarget();
+			llvm::InitializeNativeTargetAsmPrinter();
+			
+			// Use the host CPU so that the ABI (e.g. for AVX vectors)
+			// matches native code.
+			return createABITarget(llvm::Triple(llvm::sys::getProcessTriple()),
+			                       "native");
+		}
+	
+	}
+	
+	DynamicCaller::DynamicCaller()
+	: target_(createHostTarget()),
+	context_(new llvm::LLVMContext()) {
+		std::unique_ptr<llvm::Module> module(new llvm::Module("llvm-abi-thunks",
+		                                                      *context_));
+		module->setTargetTriple(llvm::sys::getProcessTriple());
+		
+		std::string error;
+		llvm::EngineBuilder engineBuilder(std::move(module));
+		engineBuilder.setEngineKind(llvm::EngineKind::JIT);
+		engineBuilder.setErrorStr(&error);
+		engineBuilder.setMCPU(llvm::sys::getHostCPUName());
+		engineBuilder.setMAttrs(getHostFeatures());
+		engine_.reset(engineBuilder.create());
+		if (engine_ == nullptr) {
+			throw std::runtime_error("Failed to create JIT: " + error);
+		}
+	}
+	
+	DynamicCaller::~DynamicCaller() { }
+	
+	const TypeBuilder& DynamicCaller::typeBuilder() const {
+		return target_->cache().typeBuilder();
+	}
+	
+	bool DynamicCaller::SignatureKey::operator<(const SignatureKey& other) const {
+		if (callingConvention != other.callingConvention) {
+			return callingConvention < other.callingConvention;
+		}
+		
+		if (isVarArg != other.isVarArg) {
+			return isVarArg < other.isVarArg;
+		}
+		
+		if (numFixedArguments != other.numFixedArguments) {
+			return numFixedArguments < other.numFixedArguments;
+		}
+		
+		return types < other.types;
+	}
+	
+	DynamicCaller::SignatureKey
+	DynamicCaller::getSignatureKey(const FunctionType& functionType,
+	                           llvm::ArrayRef<Type> argumentTypes) const {
+		SignatureKey key;
+		key.callingConvention = functionType.callingConvention();
+		key.isVarArg = functionType.isVarArg();
+		key.numFixedArguments = functionType.argumentTypes().size();
+		key.types.push_back(functionType.returnType());
+		key.types.append(argumentTypes.begin(), argumentTypes.end());
+		
+		// Aggregates are compared by address, which could be
+		// reused if their type builder were destroyed.
+		for (const auto& type: key.types) {
+			if (!type.isUniquedBy(typeBuilder())) {
+				throw std::runtime_error("Dynamic call type " + type.toString() +
+				                         " wasn't built with DynamicCaller::typeBuilder().");
+			}
+		}
+		
+		return key;
+	}
+	
+	DynamicCaller::Thunk DynamicCaller::getThunk(const FunctionType& functionType,
+	                                             llvm::ArrayRef<Type> argumentTypes) {
+		auto key = getSignatureKey(functionType, argumentTypes);
+		
+		std::lock_guard<std::mutex> lock(mutex_);
+		const auto iterator = thunks_.find(key);
+		if (iterator != thunks_.end()) {
+			return iterator->second;
+		}
+		
+		const auto thunk = compileThunk(functionType, argumentTypes);
+		thunks_.insert(std::make_pair(std::move(key), thunk));
+		return thunk;
+	}
+	
+	void DynamicCaller::call(const FunctionType& functionType,
+	                         llvm::ArrayRef<Type> argumentTypes,
+	                         void* const function, void* const returnValue,
+	                         void* const* const arguments) {
+		getThunk(functionType, argumentTypes)(function, returnValue, arguments);
+	}
+	
+	std::unique_ptr<DynamicClosure>
+	DynamicCaller::createClosure(const FunctionType& functionType,
+	                             const DynamicClosure::Handler handler,
+	                             void* const userData) {
+		if (!hostSupportsTrampolines()) {
+			throw std::runtime_error("Closures aren't supported on " +
+			                         llvm::sys::getProcessTriple() + ".");
+		}
+		
+		if (functionType.isVarArg()) {
+			throw std::runtime_error("Closures can't receive varargs.");
+		}
+		
+		auto key = getSignatureKey(functionType, functionType.argumentTypes());
+		
+		DynamicClosure::InitFunction initFunction;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			const auto iterator = closures_.find(key);
+			if (iterator != closures_.end()) {
+				initFunction = iterator->second;
+			} else {
+				initFunction = compileClosure(functionType);
+				closures_.insert(std::make_pair(std::move(key), initFunction));
+			}
+		}
+		
+		return std::unique_ptr<DynamicClosure>(new DynamicClosure(initFunction,
+		                                                          handler,
+		                                                          userData));
+	}
+	
+	size_t DynamicCaller::numThunks() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return thunks_.size();
+	}
+	
+	size_t DynamicCaller::numClosureSignatures() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return closures_.size();
+	}
+	
+	DynamicCaller::Thunk DynamicCaller::compileThunk(const FunctionType& functionType,
+	                                                 llvm::ArrayRef<Type> argumentTypes) {
+		const auto name = "llvm_abi_thunk" + std::to_string(thunks_.size());
+		std::unique_ptr<llvm::Module> module(new llvm::Module(name, *context_));
+		module->setTargetTriple(llvm::sys::getProcessTriple());
+		module->setDataLayout(engine_->getDataLayout());
+		
+		const auto abi = target_->createABI(*module);
+		const auto& typeInfo = abi->typeInfo();
+		
+		// void thunk(i8* function, i8* returnValue, i8** arguments)
+		const auto i8PtrType = llvm::Type::getInt8PtrTy(*context_);
+		const auto thunkType = llvm::FunctionType::get(llvm::Type::getVoidTy(*context_),
+		                                               { i8PtrType, i8PtrType,
+		                                                 i8PtrType->getPointerTo() },
+		                                               /*isVarArg=*/false);
+		const auto thunkFunction = llvm::Function::Create(thunkType,
+		                                                  llvm::Function::ExternalLinkage,
+		                                                  name, module.get());
+		(void) llvm::BasicBlock::Create(*context_, "", thunkFunction);
+		
+		auto it = thunkFunction->arg_begin();
+		const auto functionArg = &*(it++);
+		const auto returnValueArg = &*(it++);
+		const auto argumentsArg = &*(it++);
+		
+		ThunkBuilder builder(*thunkFunction);
+		
+		llvm::SmallVector<TypedValue, 8> arguments;
+		for (size_t i = 0; i < argumentTypes.size(); i++) {
+			auto& irBuilder = builder.getBuilder();
+			const auto argumentType = typeInfo.getLLVMType(argumentTypes[i]);
+			const auto argumentPtrPtr = irBuilder.CreateConstInBoundsGEP1_32(i8PtrType,
+			                                                                 argumentsArg, i);
+			const auto argumentPtr = irBuilder.CreatePointerCast(irBuilder.CreateLoad(i8PtrType,
+			                                                                          argumentPtrPtr),
+			                                                     argumentType->getPointerTo());
+			arguments.push_back(TypedValue(irBuilder.CreateLoad(argumentType, argumentPtr),
+			                               argumentTypes[i]));
+		}
+		
+		const auto calleeType = abi->getFunctionType(functionType);
+		const auto callee = builder.getBuilder().CreatePointerCast(functionArg,
+		                                                           calleeType->getPointerTo());
+		
+		const auto returnValue = abi->createCall(
+			builder,
+			functionType,
+			[&](llvm::ArrayRef<llvm::Value*> values) -> llvm::Value* {
+				const auto callInst = builder.getBuilder().CreateCall(calleeType, callee, values);
+				callInst->setAttributes(abi->getAttributes(functionType, argumentTypes));
+				callInst->setCallingConv(abi->getCallingConvention(functionType.callingConvention()));
+				return callInst;
+			},
+			arguments
+		);
+		
+		auto& irBuilder = builder.getBuilder();
+		if (!functionType.returnType().isVoid()) {
+			const auto returnType = typeInfo.getLLVMType(functionType.returnType());
+			irBuilder.CreateStore(returnValue,
+			                      irBuilder.CreatePointerCast(returnValueArg,
+			                                                  returnType->getPointerTo()));
+		}
+		irBuilder.CreateRetVoid();
+		
+		engine_->addModule(std::move(module));
+		const auto address = engine_->getFunctionAddress(name);
+		if (address == 0) {
+			throw std::runtime_error("Failed to compile dynamic call thunk for " +
+			                         functionType.toString() + ".");
+		}
+		
+		return reinterpret_cast<Thunk>(static_cast<uintptr_t>(address));
+	}
+	
+	DynamicClosure::InitFunction DynamicCaller::compileClosure(const FunctionType& functionType) {
+		const auto name = "llvm_abi_closure" + std::to_string(closures_.size());
+		std::unique_ptr<llvm::Module> module(new llvm::Module(name, *context_));
+		module->setTargetTriple(llvm::sys::getProcessTriple());
+		module->setDataLayout(engine_->getDataLayout());
+		
+		const auto abi = target_->createABI(*module);
+		const auto& typeInfo = abi->typeInfo();
+		const auto i8PtrType = llvm::Type::getInt8PtrTy(*context_);
+		
+		// The entry has the closure's signature, plus the closure's
+		// data as a 'nest' parameter, which trampolines bind.
+		const auto abiFunctionType = abi->getFunctionType(functionType);
+		llvm::SmallVector<llvm::Type*, 8> entryParamTypes;
+		entryParamTypes.push_back(i8PtrType);
+		entryParamTypes.append(abiFunctionType->param_begin(),
+		                       abiFunctionType->param_end());
+		const auto entryType = llvm::FunctionType::get(abiFunctionType->getReturnType(),
+		                                               entryParamTypes,
+		                                               /*isVarArg=*/false);
+		const auto entryFunction = llvm::Function::Create(entryType,
+		                                                  llvm::Function::InternalLinkage,
+		                                                  name + ".entry", module.get());
+		entryFunction->setAttributes(addNestParameter(*context_,
+		                                              abi->getAttributes(functionType,
+		                                                                 functionType.argumentTypes()),
+		                                              abiFunctionType->getNumParams()));
+		entryFunction->setCallingConv(abi->getCallingConvention(functionType.callingConvention()));
+		(void) llvm::BasicBlock::Create(*context_, "", entryFunction);
+		
+		auto it = entryFunction->arg_begin();
+		const auto dataArg = &*(it++);
+		llvm::SmallVector<llvm::Value*, 8> encodedArguments;
+		for (; it != entryFunction->arg_end(); ++it) {
+			encodedArguments.push_back(&*it);
+		}
+		
+		ThunkBuilder builder(*entryFunction);
+		auto functionEncoder = abi->createFunctionEncoder(builder, functionType,
+		                                                  encodedArguments);
+		
+		// Give the handler pointers to each argument.
+		const auto& argumentTypes = functionType.argumentTypes();
+		const auto argumentsType = llvm::ArrayType::get(i8PtrType, argumentTypes.size());
+		const auto argumentsPtr = builder.getEntryBuilder().CreateAlloca(argumentsType);
+		for (size_t i = 0; i < argumentTypes.size(); i++) {
+			const auto argumentPtr = createMemTemp(typeInfo, builder, argumentTypes[i]);
+			auto& irBuilder = builder.getBuilder();
+			irBuilder.CreateStore(functionEncoder->arguments()[i], argumentPtr);
+			irBuilder.CreateStore(irBuilder.CreatePointerCast(argumentPtr, i8PtrType),
+			                      irBuilder.CreateConstInBoundsGEP2_32(argumentsType,
+			                                                           argumentsPtr, 0, i));
+		}
+		
+		const auto& returnType = functionType.returnType();
+		llvm::Value* returnValuePtr = nullptr;
+		if (!returnType.isVoid()) {
+			returnValuePtr = createMemTemp(typeInfo, builder, returnType);
+		}
+		
+		// Call the handler with the closure's data (see
+		// DynamicClosure::Data).
+		auto& irBuilder = builder.getBuilder();
+		const auto handlerType = llvm::FunctionType::get(llvm::Type::getVoidTy(*context_),
+		                                                 { i8PtrType, i8PtrType->getPointerTo(),
+		                                                   i8PtrType },
+		                                                 /*isVarArg=*/false);
+		const auto dataType = llvm::StructType::get(handlerType->getPointerTo(), i8PtrType);
+		const auto dataPtr = irBuilder.CreatePointerCast(dataArg, dataType->getPointerTo());
+		const auto handler = irBuilder.CreateLoad(handlerType->getPointerTo(),
+		                                          irBuilder.CreateConstInBoundsGEP2_32(dataType,
+		                                                                               dataPtr, 0, 0));
+		const auto userData = irBuilder.CreateLoad(i8PtrType,
+		                                           irBuilder.CreateConstInBoundsGEP2_32(dataType,
+		                                                                                dataPtr, 0, 1));
+		llvm::Value* const handlerArgs[] = {
+			userData,
+			irBuilder.CreateConstInBoundsGEP2_32(argumentsType, argumentsPtr, 0, 0),
+			returnValuePtr != nullptr ?
+				irBuilder.CreatePointerCast(returnValuePtr, i8PtrType) :
+				llvm::ConstantPointerNull::get(i8PtrType)
+		};
+		irBuilder.CreateCall(handlerType, handler, handlerArgs);
+		
+		const auto returnLLVMType = typeInfo.getLLVMType(returnType);
+		if (returnValuePtr != nullptr) {
+			functionEncoder->returnValue(irBuilder.CreateLoad(returnLLVMType, returnValuePtr));
+		} else {
+			functionEncoder->returnValue(llvm::UndefValue::get(returnLLVMType));
+		}
+		
+		// i8* init(i8* trampoline, i8* data)
+		const auto initType = llvm::FunctionType::get(i8PtrType, { i8PtrType, i8PtrType },
+		                                              /*isVarArg=*/false);
+		const auto initFunction = llvm::Function::Create(initType,
+		                                                 llvm::Function::ExternalLinkage,
+		                                                 name, module.get());
+		IRBuilder initBuilder(llvm::BasicBlock::Create(*context_, "", initFunction));
+		const auto trampolineArg = &*(initFunction->arg_begin());
+		const auto initDataArg = &*(std::next(initFunction->arg_begin()));
+		initBuilder.CreateCall(llvm::Intrinsic::getDeclaration(module.get(),
+		                                                       llvm::Intrinsic::init_trampoline),
+		                       { trampolineArg,
+		                         initBuilder.CreatePointerCast(entryFunction, i8PtrType),
+		                         initDataArg });
+		initBuilder.CreateRet(initBuilder.CreateCall(llvm::Intrinsic::getDeclaration(module.get(),
+		                                                                             llvm::Intrinsic::adjust_trampoline),
+		                                             { trampolineArg }));
+		
+		engine_->addModule(std::move(module));
+		const auto address = engine_->getFunctionAddress(name);
+		if (address == 0) {
+			throw std::runtime_error("Failed to compile closure for " +
+			                         functionType.toString() + ".");
+		}
+		
+		return reinterpret_cast<DynamicClosure::InitFunction>(static_cast<uintptr_t>(address));
+	}
+
+}
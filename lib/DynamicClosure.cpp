@@ -0,0 +1,69 @@
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <llvm/Support/Memory.h>
+
+#include <llvm-abi/DynamicClosure.hpp>
+
+namespace llvm_abi {
+	
+	namespace {
+		
+		// Large enough for the trampolines of supported hosts
+		// (e.g. 23 bytes on x86-64).
+		const size_t TrampolineSize = 64;
+	
+	}
+	
+	DynamicClosure::DynamicClosure(const InitFunction initFunction,
+	                               const Handler pHandler, void* const pUserData)
+	: function_(nullptr) {
+		data_.handler = pHandler;
+		data_.userData = pUserData;
+		
+		// Trampolines are written and then made executable, so
+		// that memory is never both writable and executable.
+		std::error_code error;
+		trampoline_ = llvm::sys::Memory::allocateMappedMemory(TrampolineSize, nullptr,
+		                                                      llvm::sys::Memory::MF_READ |
+		                                                      llvm::sys::Memory::MF_WRITE,
+		                                                      error);
+		if (error) {
+			throw std::runtime_error("Failed to allocate closure trampoline: " +
+			                         error.message());
+		}
+		
+		function_ = initFunction(trampoline_.base(), &data_);
+		
+		error = llvm::sys::Memory::protectMappedMemory(trampoline_,
+		                                               llvm::sys::Memory::MF_READ |
+		                                               llvm::sys::Memory::MF_EXEC);
+		if (error) {
+			(void) llvm::sys::Memory::releaseMappedMemory(trampoline_);
+			throw std::runtime_error("Failed to protect closure trampoline: " +
+			                         error.message());
+		}
+		
+		llvm::sys::Memory::InvalidateInstructionCache(trampoline_.base(),
+		                                              TrampolineSize);
+	}
+	
+	DynamicClosure::~DynamicClosure() {
+		(void) llvm::sys::Memory::releaseMappedMemory(trampoline_);
+	}
+	
+	void* DynamicClosure::function() const {
+		return function_;
+	}
+	
+	DynamicClosure::Handler DynamicClosure::handler() const {
+		return data_.handler;
+	}
+	
+	void* DynamicClosure::userData() const {
+		return data_.userData;
+	}
+
+}
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FastClassifier.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+namespace llvm_abi {
+	
+	static bool isAggregateTypeForABI(const Type type) {
+		return type.isAggregateType() || type.isComplex();
+	}
+	
+	// Unions and bitfields don't have a scalar field for each
+	// byte, so aggregates containing them can't be expanded.
+	static bool hasOverlappingFields(const Type type) {
+		if (type.isUnion()) {
+			return true;
+		}
+		
+		if (type.isStruct()) {
+			for (const auto& member: type.structMembers()) {
+				if (member.isBitField() ||
+				    hasOverlappingFields(member.type())) {
+					return true;
+				}
+			}
+			return false;
+		}
+		
+		if (type.isArray()) {
+			return hasOverlappingFields(type.arrayElementType());
+		}
+		
+		return false;
+	}
+	
+	FastClassifier::FastClassifier(const ABITypeLayout& typeLayout,
+	                               const llvm::Triple& targetTriple)
+	: typeLayout_(typeLayout),
+	registerSize_(DataSize::Bytes(targetTriple.isArch64Bit() ? 8 : 4)),
+	intRegs_(4), fpRegs_(0), returnIntRegs_(1), returnFPRegs_(0) {
+		// These are the registers LLVM's 'fastcc' uses for
+		// arguments and return values. Targets without separate
+		// floating point registers (or where we don't know that
+		// they're available) pass floating point values in
+		// integer registers.
+		switch (targetTriple.getArch()) {
+			case llvm::Triple::x86:
+				// ECX and EDX; returns in EAX, EDX and ECX.
+				intRegs_ = 2;
+				returnIntRegs_ = 3;
+				break;
+			case llvm::Triple::x86_64:
+				if (targetTriple.isOSWindows()) {
+					// RCX, RDX, R8 and R9 (shared with XMM0-3).
+					intRegs_ = 4;
+				} else {
+					intRegs_ = 6;
+					fpRegs_ = 8;
+					returnIntRegs_ = 4;
+					returnFPRegs_ = 2;
+				}
+				break;
+			case llvm::Triple::aarch64:
+			case llvm::Triple::aarch64_be:
+				intRegs_ = 8;
+				fpRegs_ = 8;
+				returnIntRegs_ = 8;
+				returnFPRegs_ = 8;
+				break;
+			case llvm::Triple::arm:
+			case llvm::Triple::armeb:
+			case llvm::Triple::thumb:
+			case llvm::Triple::thumbeb:
+				intRegs_ = 4;
+				returnIntRegs_ = 4;
+				if (targetTriple.getEnvironment() == llvm::Triple::GNUEABIHF ||
+				    targetTriple.getEnvironment() == llvm::Triple::MuslEABIHF ||
+				    targetTriple.getEnvironment() == llvm::Triple::EABIHF) {
+					fpRegs_ = 8;
+					returnFPRegs_ = 8;
+				}
+				break;
+			case llvm::Triple::ppc64:
+			case llvm::Triple::ppc64le:
+				intRegs_ = 8;
+				fpRegs_ = 13;
+				returnIntRegs_ = 8;
+				returnFPRegs_ = 8;
+				break;
+			case llvm::Triple::riscv32:
+			case llvm::Triple::riscv64:
+				intRegs_ = 8;
+				returnIntRegs_ = 2;
+				break;
+			case llvm::Triple::systemz:
+				intRegs_ = 5;
+				fpRegs_ = 4;
+				returnIntRegs_ = 4;
+				returnFPRegs_ = 4;
+				break;
+			case llvm::Triple::wasm32:
+			case llvm::Triple::wasm64:
+				// Arguments are just locals, but returning more
+				// than one value needs the multivalue feature.
+				intRegs_ = 16;
+				fpRegs_ = 16;
+				returnIntRegs_ = 1;
+				returnFPRegs_ = 1;
+				break;
+			default:
+				break;
+		}
+	}
+	
+	bool FastClassifier::countRegisters(const Type type,
+	                                    unsigned& neededInt,
+	                                    unsigned& neededFP) const {
+		if (type.isStruct()) {
+			if (type.hasFlexibleArrayMember()) {
+				return false;
+			}
+			
+			for (const auto& member: type.structMembers()) {
+				if (member.isBitField() ||
+				    !countRegisters(member.type(), neededInt, neededFP)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		
+		if (type.isArray()) {
+			unsigned elementInt = 0;
+			unsigned elementFP = 0;
+			if (!countRegisters(type.arrayElementType(), elementInt, elementFP)) {
+				return false;
+			}
+			neededInt += elementInt * type.arrayElementCount();
+			neededFP += elementFP * type.arrayElementCount();
+			return true;
+		}
+		
+		// Aggregates containing unions or bitfields are passed as
+		// integer chunks instead (see getIntegerChunks()).
+		if (type.isUnion()) {
+			return false;
+		}
+		
+		// Complex values are expanded into their real and
+		// imaginary parts.
+		if (type.isComplex()) {
+			const auto elementType = type.complexFloatingPointType();
+			unsigned elementInt = 0;
+			unsigned elementFP = 0;
+			(void) countRegisters(elementType, elementInt, elementFP);
+			neededInt += elementInt * 2;
+			neededFP += elementFP * 2;
+			return true;
+		}
+		
+		if ((type.isFloatingPoint() || type.isVector()) && fpRegs_ > 0) {
+			neededFP++;
+			return true;
+		}
+		
+		// Integers and pointers (and floating point values on
+		// targets without FP registers) use as many integer
+		// registers as they span.
+		const auto size = typeLayout_.getTypeAllocSize(type);
+		neededInt += std::max<uint64_t>(size.roundUpToAlign(registerSize_).asBytes() /
+		                                registerSize_.asBytes(), 1);
+		return true;
+	}
+	
+	Type FastClassifier::getIntegerChunks(const Type type,
+	                                      unsigned& neededInt) const {
+		const auto size = typeLayout_.getTypeAllocSize(type);
+		neededInt = std::max<uint64_t>(size.roundUpToAlign(registerSize_).asBytes() /
+		                               registerSize_.asBytes(), 1);
+		
+		const auto chunkType = Type::FixedWidthInteger(registerSize_,
+		                                               /*isSigned=*/false);
+		if (neededInt == 1) {
+			return chunkType;
+		}
+		
+		llvm::SmallVector<Type, 8> chunkTypes(neededInt, chunkType);
+		return typeLayout_.typeBuilder().getStructTy(chunkTypes);
+	}
+	
+	ArgInfo FastClassifier::classifyReturnType(const Type returnType,
+	                                           unsigned& freeIntRegs) const {
+		if (returnType.isVoid()) {
+			return ArgInfo::getIgnore();
+		}
+		
+		if (!isAggregateTypeForABI(returnType)) {
+			return returnType.isPromotableIntegerType() ?
+				ArgInfo::getExtend(returnType) :
+				ArgInfo::getDirect(returnType);
+		}
+		
+		if (returnType.isEmptyRecord(/*allowArrays=*/true)) {
+			return ArgInfo::getIgnore();
+		}
+		
+		// Return aggregates as multiple values if they fit in the
+		// return registers.
+		unsigned neededInt = 0;
+		unsigned neededFP = 0;
+		if (hasOverlappingFields(returnType)) {
+			if (!returnType.hasFlexibleArrayMember()) {
+				const auto coerceType = getIntegerChunks(returnType, neededInt);
+				if (neededInt <= returnIntRegs_) {
+					return ArgInfo::getDirect(coerceType);
+				}
+			}
+		} else if (countRegisters(returnType, neededInt, neededFP) &&
+		           neededInt <= returnIntRegs_ && neededFP <= returnFPRegs_) {
+			return ArgInfo::getDirect(returnType);
+		}
+		
+		// Otherwise the hidden sret pointer uses an integer
+		// register.
+		if (freeIntRegs > 0) {
+			freeIntRegs--;
+		}
+		return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+	}
+	
+	ArgInfo FastClassifier::classifyArgumentType(const Type argumentType,
+	                                             unsigned& freeIntRegs,
+	                                             unsigned& freeFPRegs) const {
+		unsigned neededInt = 0;
+		unsigned neededFP = 0;
+		
+		if (!isAggregateTypeForABI(argumentType)) {
+			(void) countRegisters(argumentType, neededInt, neededFP);
+			freeIntRegs -= std::min(freeIntRegs, neededInt);
+			freeFPRegs -= std::min(freeFPRegs, neededFP);
+			return argumentType.isPromotableIntegerType() ?
+				ArgInfo::getExtend(argumentType) :
+				ArgInfo::getDirect(argumentType);
+		}
+		
+		if (argumentType.isEmptyRecord(/*allowArrays=*/true)) {
+			return ArgInfo::getIgnore();
+		}
+		
+		// Flatten aggregates into their scalar fields (or integer
+		// chunks) if they fit in the remaining registers.
+		if (hasOverlappingFields(argumentType)) {
+			if (!argumentType.hasFlexibleArrayMember()) {
+				const auto coerceType = getIntegerChunks(argumentType, neededInt);
+				if (neededInt <= freeIntRegs) {
+					freeIntRegs -= neededInt;
+					return ArgInfo::getDirect(coerceType, /*offset=*/0,
+					                          /*padding=*/VoidTy,
+					                          /*canBeFlattened=*/true);
+				}
+			}
+		} else if (countRegisters(argumentType, neededInt, neededFP) &&
+		           neededInt <= freeIntRegs && neededFP <= freeFPRegs) {
+			freeIntRegs -= neededInt;
+			freeFPRegs -= neededFP;
+			return ArgInfo::getExpand(argumentType);
+		}
+		
+		// Otherwise pass a pointer to a copy made by the caller.
+		if (freeIntRegs > 0) {
+			freeIntRegs--;
+		}
+		const auto align = typeLayout_.getTypeRequiredAlign(argumentType);
+		return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+	}
+	
+	llvm::SmallVector<ArgInfo, 8>
+	FastClassifier::classifyFunctionType(const FunctionType& functionType,
+	                                     llvm::ArrayRef<Type> argumentTypes) const {
+		ABITimeRegion timeRegion(ClassificationRegion);
+		
+		// Like LLVM's 'fastcc', this requires callers to match the
+		// prototype exactly.
+		if (functionType.isVarArg()) {
+			throw std::runtime_error("The fast calling convention doesn't support variadic functions.");
+		}
+		
+		llvm::SmallVector<ArgInfo, 8> argInfoArray;
+		
+		unsigned freeIntRegs = intRegs_;
+		unsigned freeFPRegs = fpRegs_;
+		
+		argInfoArray.push_back(classifyReturnType(functionType.returnType(),
+		                                          freeIntRegs));
+		
+		for (const auto& argumentType: argumentTypes) {
+			argInfoArray.push_back(classifyArgumentType(argumentType,
+			                                            freeIntRegs,
+			                                            freeFPRegs));
+		}
+		
+		return argInfoArray;
+	}
+
+}
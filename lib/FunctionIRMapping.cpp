@@ -1,26 +1,33 @@
 #include <algorithm>
 #include <cstddef>
 
+#include <llvm/ADT/Statistic.h>
 #include <llvm/IR/Attributes.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/Support/ErrorHandling.h>
 
+#include <llvm-abi/ABITimeRegion.hpp>
 #include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/ArgInfo.hpp>
 #include <llvm-abi/FunctionIRMapping.hpp>
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/Type.hpp>
 #include <llvm-abi/TypeBuilder.hpp>
 
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumIRMappings, "Number of ABI IR mappings computed");
+
 namespace llvm_abi {
 	
-	static size_t getExpansionSize(const ABITypeInfo& typeInfo, const Type type) {
+	static size_t getExpansionSize(const ABITypeLayout& typeLayout, const Type type) {
 		assert(type != VoidTy);
 		
 		if (type.isArray()) {
 			return type.arrayElementCount() *
-			       getExpansionSize(typeInfo, type.arrayElementType());
+			       getExpansionSize(typeLayout, type.arrayElementType());
 		}
 		
 		if (type.isStruct()) {
@@ -36,7 +43,7 @@ namespace llvm_abi {
 				}
 				assert(!field.isBitField() &&
  				       "Cannot expand structure with bit-field members.");
-				result += getExpansionSize(typeInfo, field.type());
+				result += getExpansionSize(typeLayout, field.type());
 			}
 			return result;
 		}
@@ -55,7 +62,7 @@ namespace llvm_abi {
 				}
 				assert(!field.isBitField() &&
 				       "Cannot expand structure with bit-field members.");
-				const auto fieldSize = typeInfo.getTypeAllocSize(field.type());
+				const auto fieldSize = typeLayout.getTypeAllocSize(field.type());
 				if (largestSize < fieldSize) {
 					largestSize = fieldSize;
 					largestType = field.type();
@@ -66,7 +73,7 @@ namespace llvm_abi {
 				return 0;
 			}
 			
-			return getExpansionSize(typeInfo, largestType);
+			return getExpansionSize(typeLayout, largestType);
 		}
 		
 		if (type.isComplex()) {
@@ -139,8 +146,11 @@ namespace llvm_abi {
 	}
 	
 	FunctionIRMapping
-	getFunctionIRMapping(const ABITypeInfo& typeInfo,
+	getFunctionIRMapping(const ABITypeLayout& typeLayout,
 	                     llvm::ArrayRef<ArgInfo> argInfoArray) {
+		ABITimeRegion timeRegion(IRMappingRegion);
+		++NumIRMappings;
+		
 		FunctionIRMapping functionIRMapping;
 		
 		size_t irArgumentNumber = 0;
@@ -188,9 +198,13 @@ namespace llvm_abi {
 					break;
 				case ArgInfo::Expand: {
 					argumentIRMapping.numberOfIRArgs =
-						getExpansionSize(typeInfo, argInfo.getExpandType());
+						getExpansionSize(typeLayout, argInfo.getExpandType());
 					break;
 				}
+				case ArgInfo::CoerceAndExpand:
+					argumentIRMapping.numberOfIRArgs =
+						argInfo.getCoerceAndExpandTypeSequence().size();
+					break;
 			}
 			
 			if (argumentIRMapping.numberOfIRArgs > 0) {
@@ -216,6 +230,26 @@ namespace llvm_abi {
 		return functionIRMapping;
 	}
 	
+	bool isTrivialCoercion(const ABITypeLayout& typeLayout,
+	                       const Type type,
+	                       const ArgInfo& argInfo) {
+		const auto coerceType = argInfo.getCoerceToType();
+		if (coerceType.isStruct() || argInfo.getDirectOffset() != 0) {
+			return false;
+		}
+		
+		if (coerceType == type) {
+			return true;
+		}
+		
+		// Extended integers may be coerced to an integer of the same
+		// width but different signedness (e.g. for RV64), which has
+		// the same IR type.
+		return argInfo.isExtend() &&
+		       coerceType.isInteger() && type.isInteger() &&
+		       typeLayout.getTypeRawSize(coerceType) == typeLayout.getTypeRawSize(type);
+	}
+	
 	llvm::FunctionType *
 	getFunctionType(llvm::LLVMContext& context,
 	                const ABITypeInfo& typeInfo,
@@ -233,6 +267,10 @@ namespace llvm_abi {
 				resultType = typeInfo.getLLVMType(returnArgInfo.getCoerceToType());
 				break;
 			
+			case ArgInfo::CoerceAndExpand:
+				resultType = typeInfo.getLLVMType(returnArgInfo.getUnpaddedCoerceAndExpandType());
+				break;
+			
 			case ArgInfo::InAlloca: {
 				if (returnArgInfo.getInAllocaSRet()) {
 					// sret things on win32 aren't void, they return the sret pointer.
@@ -323,13 +361,23 @@ namespace llvm_abi {
 					break;
 				}
 
-				case ArgInfo::Expand:
+				case ArgInfo::Expand: {
 					auto argumentTypesIter = argumentTypes.begin() + firstIRArg;
 					getExpandedTypes(typeInfo,
 					                 argInfo.getExpandType(),
 					                 argumentTypesIter);
 					assert(argumentTypesIter == argumentTypes.begin() + firstIRArg + numIRArgs);
 					break;
+				}
+				
+				case ArgInfo::CoerceAndExpand: {
+					const auto typeSequence = argInfo.getCoerceAndExpandTypeSequence();
+					assert(numIRArgs == typeSequence.size());
+					for (size_t i = 0; i < typeSequence.size(); i++) {
+						argumentTypes[firstIRArg + i] = typeInfo.getLLVMType(typeSequence[i]);
+					}
+					break;
+				}
 			}
 		}
 		
@@ -363,6 +411,7 @@ namespace llvm_abi {
 				}
 				break;
 			case ArgInfo::Ignore:
+			case ArgInfo::CoerceAndExpand:
 				break;
 			case ArgInfo::InAlloca:
 			case ArgInfo::Indirect: {
@@ -437,16 +486,20 @@ namespace llvm_abi {
 					
 					if (argInfo.getIndirectByVal()) {
 						attrs.addAttribute(llvm::Attribute::ByVal);
+						
+						// The alignment matters for byval since LLVM may
+						// create a new stack object; without byval the
+						// object already exists so (like clang) we omit it.
+						attrs.addAlignmentAttr(argInfo.getIndirectAlign());
 					}
 					
-					attrs.addAlignmentAttr(argInfo.getIndirectAlign());
-					
 					// byval disables readnone and readonly.
 					functionAttrs.removeAttribute(llvm::Attribute::ReadOnly);
 					functionAttrs.removeAttribute(llvm::Attribute::ReadNone);
 					break;
 				case ArgInfo::Ignore:
 				case ArgInfo::Expand:
+				case ArgInfo::CoerceAndExpand:
 					continue;
 				case ArgInfo::InAlloca:
 					// inalloca disables readnone and readonly.
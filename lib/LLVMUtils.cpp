@@ -1,13 +1,26 @@
+#include <string>
+
+#include <llvm/ADT/Statistic.h>
+#include <llvm/Analysis/OptimizationRemarkEmitter.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include <llvm/IR/DiagnosticInfo.h>
+
 #include <llvm-abi/ABITypeInfo.hpp>
 #include <llvm-abi/Builder.hpp>
+#include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/LLVMUtils.hpp>
 
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumTemporaries, "Number of ABI temporaries (allocas) emitted");
+
 namespace llvm_abi {
 	
 	llvm::AllocaInst* createTempAlloca(const ABITypeInfo& typeInfo,
 	                                   Builder& builder,
 	                                   const Type type,
 	                                   const llvm::Twine& name) {
+		++NumTemporaries;
 		const auto allocaInst = builder.getEntryBuilder().CreateAlloca(typeInfo.getLLVMType(type));
 		allocaInst->setName(name);
 		return allocaInst;
@@ -51,4 +64,62 @@ namespace llvm_abi {
 		                                            name);
 	}
 	
+	void emitMemoryRemark(Builder& builder,
+	                      const llvm::StringRef remarkName,
+	                      const int argumentNumber,
+	                      const Type type,
+	                      const llvm::StringRef reason,
+	                      const DataSize bytes) {
+		const auto block = builder.getBuilder().GetInsertBlock();
+		if (block == nullptr || block->getParent() == nullptr) {
+			return;
+		}
+		
+		// The remark is only built if remarks are enabled.
+		llvm::OptimizationRemarkEmitter emitter(block->getParent(),
+		                                        /*BFI=*/nullptr);
+		emitter.emit([&]() {
+			llvm::OptimizationRemarkMissed remark("llvm-abi", remarkName,
+			                                      builder.getBuilder().getCurrentDebugLocation(),
+			                                      block);
+			if (argumentNumber < 0) {
+				remark << "return value";
+			} else {
+				remark << "argument " << llvm::ore::NV("ArgNo", argumentNumber);
+			}
+			remark << " of type " << llvm::ore::NV("Type", type.toString())
+			       << " is passed through memory ("
+			       << llvm::ore::NV("Reason", reason) << "): "
+			       << llvm::ore::NV("Bytes", bytes.asBytes()) << " bytes";
+			return remark;
+		});
+	}
+	
+	std::string getProfileSiteName(Builder& builder,
+	                               const llvm::StringRef kind,
+	                               const FunctionType& functionType) {
+		auto& irBuilder = builder.getBuilder();
+		
+		std::string name;
+		const auto block = irBuilder.GetInsertBlock();
+		if (block != nullptr && block->getParent() != nullptr) {
+			name += block->getParent()->getName();
+			name += " ";
+		}
+		
+		name += kind;
+		name += " ";
+		name += functionType.toString();
+		
+		const auto& debugLoc = irBuilder.getCurrentDebugLocation();
+		if (debugLoc) {
+			name += " at ";
+			name += debugLoc->getFilename();
+			name += ":" + std::to_string(debugLoc.getLine());
+			name += ":" + std::to_string(debugLoc.getCol());
+		}
+		
+		return name;
+	}
+
 }
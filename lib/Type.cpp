@@ -6,7 +6,7 @@
 
 #include <llvm/Support/ErrorHandling.h>
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/Type.hpp>
 #include <llvm-abi/TypeBuilder.hpp>
 
@@ -383,7 +383,7 @@ namespace llvm_abi {
 		       *this == UShortTy;
 	}
 	
-	Type Type::getStructSingleElement(const ABITypeInfo& typeInfo) const {
+	Type Type::getStructSingleElement(const ABITypeLayout& typeLayout) const {
 		if (!isRecordType()) {
 			return VoidTy;
 		}
@@ -421,7 +421,7 @@ namespace llvm_abi {
 			if (!fieldType.isRecordType()) {
 				foundType = fieldType;
 			} else {
-				foundType = fieldType.getStructSingleElement(typeInfo);
+				foundType = fieldType.getStructSingleElement(typeLayout);
 				if (foundType.isVoid()) {
 					return VoidTy;
 				}
@@ -431,7 +431,7 @@ namespace llvm_abi {
 		// We don't consider a struct a single-element struct
 		// if it has padding beyond the element type.
 		if (!foundType.isVoid() &&
-		    typeInfo.getTypeAllocSize(foundType) != typeInfo.getTypeAllocSize(*this)) {
+		    typeLayout.getTypeAllocSize(foundType) != typeLayout.getTypeAllocSize(*this)) {
 			return VoidTy;
 		}
 		
@@ -456,7 +456,7 @@ namespace llvm_abi {
 		return true;
 	}
 	
-	bool Type::bitsContainNoUserData(const ABITypeInfo& typeInfo,
+	bool Type::bitsContainNoUserData(const ABITypeLayout& typeLayout,
 	                                 const size_t startBit,
 	                                 const size_t endBit) const {
 		assert(startBit <= endBit);
@@ -464,12 +464,12 @@ namespace llvm_abi {
 		// If the bytes being queried are off the end of the type, there is no user
 		// data hiding here. This handles analysis of builtins, vectors and other
 		// types that don't contain interesting padding.
-		if (typeInfo.getTypeAllocSize(*this).asBits() <= startBit) {
+		if (typeLayout.getTypeAllocSize(*this).asBits() <= startBit) {
 			return true;
 		}
 		
 		if (isArray()) {
-			const auto elementSize = typeInfo.getTypeAllocSize(arrayElementType());
+			const auto elementSize = typeLayout.getTypeAllocSize(arrayElementType());
 			const auto elementCount = arrayElementCount();
 			
 			for (size_t i = 0; i < elementCount; i++) {
@@ -481,7 +481,7 @@ namespace llvm_abi {
 				
 				const size_t elementStart = (elementOffset.asBits() < startBit) ? (startBit - elementOffset.asBits()) : 0;
 				
-				if (!arrayElementType().bitsContainNoUserData(typeInfo,
+				if (!arrayElementType().bitsContainNoUserData(typeLayout,
 				                                              elementStart,
 				                                              endBit - elementOffset.asBits())) {
 					return false;
@@ -494,7 +494,7 @@ namespace llvm_abi {
 		}
 		
 		if (isStruct()) {
-			const auto structOffsets = typeInfo.calculateStructOffsets(structMembers());
+			const auto structOffsets = typeLayout.calculateStructOffsets(structMembers());
 			
 			// Verify that no field has data that overlaps the region of interest. Yes
 			// this could be sped up a lot by being smarter about queried fields,
@@ -510,7 +510,7 @@ namespace llvm_abi {
 				}
 				
 				const auto fieldStart = (fieldOffset.asBits() < startBit) ? (startBit - fieldOffset.asBits()) : 0;
-				if (!structMember.type().bitsContainNoUserData(typeInfo,
+				if (!structMember.type().bitsContainNoUserData(typeLayout,
 				                                               fieldStart,
 				                                               endBit - fieldOffset.asBits())) {
 					return false;
@@ -525,14 +525,14 @@ namespace llvm_abi {
 		return false;
 	}
 	
-	bool Type::isHomogeneousAggregate(const ABITypeInfo& typeInfo,
+	bool Type::isHomogeneousAggregate(const ABITypeLayout& typeLayout,
 	                                  Type& base,
 	                                  uint64_t& members) const {
 		if (isArray()) {
 			if (arrayElementCount() == 0) {
 				return false;
 			}
-			if (!arrayElementType().isHomogeneousAggregate(typeInfo,
+			if (!arrayElementType().isHomogeneousAggregate(typeLayout,
 			                                               base,
 			                                               members)) {
 				return false;
@@ -565,7 +565,7 @@ namespace llvm_abi {
 // 					continue;
 				
 				uint64_t fieldMembers;
-				if (!field.type().isHomogeneousAggregate(typeInfo,
+				if (!field.type().isHomogeneousAggregate(typeLayout,
 				                                         base,
 				                                         fieldMembers)) {
 					return false;
@@ -581,8 +581,8 @@ namespace llvm_abi {
 			}
 			
 			// Ensure there is no padding.
-			if ((typeInfo.getTypeAllocSize(base) * members) !=
-			    typeInfo.getTypeAllocSize(*this)) {
+			if ((typeLayout.getTypeAllocSize(base) * members) !=
+			    typeLayout.getTypeAllocSize(*this)) {
 				return false;
 			}
 		} else {
@@ -596,7 +596,7 @@ namespace llvm_abi {
 			}
 			
 			// Most ABIs only support float, double, and some vector type widths.
-			if (!typeInfo.isHomogeneousAggregateBaseType(useType)) {
+			if (!typeLayout.isHomogeneousAggregateBaseType(useType)) {
 				return false;
 			}
 			
@@ -608,15 +608,15 @@ namespace llvm_abi {
 			}
 			
 			if (base.isVector() != useType.isVector() ||
-			    typeInfo.getTypeAllocSize(base) != typeInfo.getTypeAllocSize(useType)) {
+			    typeLayout.getTypeAllocSize(base) != typeLayout.getTypeAllocSize(useType)) {
 				return false;
 			}
 		}
 		
-		return members > 0 && typeInfo.isHomogeneousAggregateSmallEnough(base, members);
+		return members > 0 && typeLayout.isHomogeneousAggregateSmallEnough(base, members);
 	}
 	
-	bool Type::hasUnalignedFields(const ABITypeInfo& typeInfo) const {
+	bool Type::hasUnalignedFields(const ABITypeLayout& typeLayout) const {
 		if (!isStruct()) {
 			return false;
 		}
@@ -625,23 +625,23 @@ namespace llvm_abi {
 		
 		for (const auto& member: structMembers()) {
 			// Add necessary padding before this member.
-			offset = offset.roundUpToAlign(typeInfo.getTypeRequiredAlign(member.type()));
+			offset = offset.roundUpToAlign(typeLayout.getTypeRequiredAlign(member.type()));
 			
 			const auto memberOffset = member.offset().asBits() == 0 ? offset : member.offset();
 			
 			if (memberOffset != offset ||
-			    member.type().hasUnalignedFields(typeInfo)) {
+			    member.type().hasUnalignedFields(typeLayout)) {
 				return true;
 			}
 			
 			// Add the member's size.
-			offset += typeInfo.getTypeAllocSize(member.type());
+			offset += typeLayout.getTypeAllocSize(member.type());
 		}
 		
 		return false;
 	}
 	
-	bool Type::hasSignedIntegerRepresentation(const ABITypeInfo& typeInfo) const {
+	bool Type::hasSignedIntegerRepresentation(const ABITypeLayout& typeLayout) const {
 		switch (kind()) {
 			case VoidType:
 			case PointerType:
@@ -656,7 +656,7 @@ namespace llvm_abi {
 					case Bool:
 						return false;
 					case Char:
-						return typeInfo.isCharSigned();
+						return typeLayout.isCharSigned();
 					case SChar:
 					case Short:
 					case Int:
@@ -685,7 +685,7 @@ namespace llvm_abi {
 		llvm_unreachable("Unknown ABI Type kind in hasSignedIntegerRepresentation().");
 	}
 			
-	bool Type::hasUnsignedIntegerRepresentation(const ABITypeInfo& typeInfo) const {
+	bool Type::hasUnsignedIntegerRepresentation(const ABITypeLayout& typeLayout) const {
 		switch (kind()) {
 			case VoidType:
 			case PointerType:
@@ -700,7 +700,7 @@ namespace llvm_abi {
 					case Bool:
 						return false;
 					case Char:
-						return !typeInfo.isCharSigned();
+						return !typeLayout.isCharSigned();
 					case SChar:
 					case Short:
 					case Int:
@@ -757,6 +757,25 @@ namespace llvm_abi {
 		llvm_unreachable("Unknown ABI Type kind in hash().");
 	}
 	
+	bool Type::isUniquedBy(const TypeBuilder& typeBuilder) const {
+		switch (kind()) {
+			case VoidType:
+			case PointerType:
+			case UnspecifiedWidthIntegerType:
+			case FixedWidthIntegerType:
+			case FloatingPointType:
+			case ComplexType:
+				return true;
+			case StructType:
+			case UnionType:
+			case ArrayType:
+			case VectorType:
+				return subKind_.uniquedPointer->builder == &typeBuilder;
+		}
+		
+		llvm_unreachable("Unknown ABI Type kind in isUniquedBy().");
+	}
+	
 	static std::string intKindToString(IntegerKind kind) {
 		switch (kind) {
 			case Bool:
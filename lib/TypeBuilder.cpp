@@ -1,14 +1,49 @@
+#include <mutex>
 #include <set>
 
+#include <llvm/ADT/Hashing.h>
+#include <llvm/ADT/Statistic.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
 #include <llvm-abi/Type.hpp>
 #include <llvm-abi/TypeBuilder.hpp>
 
+#define DEBUG_TYPE "llvm-abi"
+
+STATISTIC(NumTypeLookups, "Number of ABI types looked up for interning");
+STATISTIC(NumTypesInterned, "Number of unique ABI types created");
+
 namespace llvm_abi {
 	
+	// Consistent with TypeData::operator<(); the member and
+	// element types are already uniqued, so their hashes are
+	// cheap.
+	static size_t hashTypeData(const Type::TypeData& typeData) {
+		auto hash = llvm::hash_combine(typeData.recordType.name,
+		                               typeData.arrayType.elementCount,
+		                               typeData.arrayType.elementType.hash(),
+		                               typeData.vectorType.elementCount,
+		                               typeData.vectorType.elementType.hash());
+		for (const auto& member: typeData.recordType.members) {
+			hash = llvm::hash_combine(hash, member.type().hash());
+		}
+		return hash;
+	}
+	
 	TypeBuilder::TypeBuilder() { }
 	
 	const Type::TypeData* TypeBuilder::getUniquedTypeData(Type::TypeData typeData) const {
-		auto result = typeDataSet_.insert(std::move(typeData));
+		ABITimeRegion timeRegion(TypeInterningRegion);
+		++NumTypeLookups;
+		
+		typeData.builder = this;
+		
+		auto& shard = shards_[hashTypeData(typeData) % NumShards];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto result = shard.typeDataSet.insert(std::move(typeData));
+		if (result.second) {
+			++NumTypesInterned;
+		}
 		return &(*(result.first));
 	}
 	
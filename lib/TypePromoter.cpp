@@ -1,4 +1,5 @@
 #include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/Builder.hpp>
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/Type.hpp>
@@ -7,8 +8,19 @@
 
 namespace llvm_abi {
 	
+	TypePromoter::TypePromoter(const ABITypeLayout& typeLayout)
+	: typeLayout_(typeLayout),
+	typeInfo_(nullptr) { }
+	
 	TypePromoter::TypePromoter(const ABITypeInfo& typeInfo)
-	: typeInfo_(typeInfo) { }
+	: typeLayout_(typeInfo),
+	typeInfo_(&typeInfo) { }
+	
+	const ABITypeInfo& TypePromoter::typeInfo() const {
+		assert(typeInfo_ != nullptr &&
+		       "Promoting values requires ABI type information.");
+		return *typeInfo_;
+	}
 	
 	TypedValue TypePromoter::promoteValue(Builder& builder,
 	                                      const TypedValue value,
@@ -20,18 +32,18 @@ namespace llvm_abi {
 		
 		assert(type.isInteger() || type.isFloatingPoint());
 		if (type.isInteger()) {
-			if (type.hasSignedIntegerRepresentation(typeInfo_)) {
+			if (type.hasSignedIntegerRepresentation(typeLayout_)) {
 				const auto extValue = builder.getBuilder().CreateSExt(value.llvmValue(),
-				                                                      typeInfo_.getLLVMType(type));
+				                                                      typeInfo().getLLVMType(type));
 				return TypedValue(extValue, type);
 			} else {
 				const auto extValue = builder.getBuilder().CreateZExt(value.llvmValue(),
-				                                                      typeInfo_.getLLVMType(type));
+				                                                      typeInfo().getLLVMType(type));
 				return TypedValue(extValue, type);
 			}
 		} else {
 			const auto extValue = builder.getBuilder().CreateFPExt(value.llvmValue(),
-			                                                       typeInfo_.getLLVMType(type));
+			                                                       typeInfo().getLLVMType(type));
 			return TypedValue(extValue, type);
 		}
 	}
@@ -40,7 +52,7 @@ namespace llvm_abi {
 		if (type.isUnspecifiedWidthInteger()) {
 			switch (type.integerKind()) {
 				case Char:
-					return typeInfo_.isCharSigned() ?
+					return typeLayout_.isCharSigned() ?
 						IntTy : UIntTy;
 				case Bool:
 				case SChar:
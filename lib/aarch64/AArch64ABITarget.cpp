@@ -0,0 +1,70 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/aarch64/AArch64ABITarget.hpp>
+#include <llvm-abi/aarch64/AArch64ABITypeLayout.hpp>
+#include <llvm-abi/aarch64/AArch64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace aarch64 {
+		
+		AArch64ABITarget::AArch64ABITarget(const llvm::Triple& targetTriple)
+		: ABITarget(targetTriple),
+		typeLayout_(targetTriple, &(cache())) { }
+		
+		AArch64ABITarget::~AArch64ABITarget() { }
+		
+		std::string AArch64ABITarget::name() const {
+			return "AArch64";
+		}
+		
+		llvm::Type* AArch64ABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			if (typeLayout_.isDarwinPCS()) {
+				return llvm::Type::getDoubleTy(llvmContext);
+			} else {
+				return llvm::Type::getFP128Ty(llvmContext);
+			}
+		}
+		
+		const AArch64ABITypeLayout& AArch64ABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		AArch64ABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                           llvm::ArrayRef<Type> argumentTypes) const {
+			AArch64Classifier classifier(typeLayout_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		AArch64ABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// X0-X7 and V0-V7; the struct return pointer is
+			// passed in X8.
+			ABIRegisterFile registerFile(/*intRegisters=*/8,
+			                             /*fpRegisters=*/8,
+			                             DataSize::Bytes(8));
+			registerFile.hasStructRetRegister = true;
+			return registerFile;
+		}
+		
+	}
+	
+}
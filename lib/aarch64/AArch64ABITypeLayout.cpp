@@ -0,0 +1,185 @@
+#include <algorithm>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/aarch64/AArch64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace aarch64 {
+		
+		AArch64ABITypeLayout::AArch64ABITypeLayout(const llvm::Triple& targetTriple,
+		                                           const ABICache* const cache)
+		: isDarwinPCS_(targetTriple.isOSDarwin()),
+		isBigEndian_(targetTriple.getArch() == llvm::Triple::aarch64_be),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		bool AArch64ABITypeLayout::isDarwinPCS() const {
+			return isDarwinPCS_;
+		}
+		
+		const TypeBuilder& AArch64ABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize AArch64ABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize AArch64ABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize AArch64ABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize AArch64ABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize AArch64ABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		AArch64ABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool AArch64ABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// Only the 64-bit (D) and 128-bit (Q) short vectors with a
+			// power of 2 number of elements map onto NEON registers.
+			const auto size = getTypeAllocSize(type);
+			if (!llvm::isPowerOf2_64(type.vectorElementCount())) {
+				return false;
+			}
+			return size.asBits() == 64 ||
+			       (size.asBits() == 128 && type.vectorElementCount() != 1);
+		}
+		
+		bool AArch64ABITypeLayout::isBigEndian() const {
+			return isBigEndian_;
+		}
+		
+		bool AArch64ABITypeLayout::isCharSigned() const {
+			return isDarwinPCS();
+		}
+		
+		bool AArch64ABITypeLayout::isHomogeneousAggregateBaseType(const Type type) const {
+			// Homogeneous aggregates for AAPCS64 must have base types of a
+			// floating point type or a short-vector type.
+			if (type.isFloatingPoint()) {
+				return true;
+			}
+			
+			if (type.isVector()) {
+				const auto size = getTypeAllocSize(type);
+				return size.asBits() == 64 || size.asBits() == 128;
+			}
+			
+			return false;
+		}
+		
+		bool AArch64ABITypeLayout::isHomogeneousAggregateSmallEnough(const Type /*base*/,
+		                                                             const uint64_t members) const {
+			// Up to four members are passed in consecutive V registers.
+			return members <= 4;
+		}
+		
+		DataSize AArch64ABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(8);
+		}
+		
+		DataSize AArch64ABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize AArch64ABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize AArch64ABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize AArch64ABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(isDarwinPCS() ? 8 : 16);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize AArch64ABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return getFloatSize(kind);
+		}
+		
+		DataSize AArch64ABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize AArch64ABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize AArch64ABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize AArch64ABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned, up to 16 bytes (clang's
+			// MaxVectorAlign for AArch64).
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			return std::min<DataSize>(std::max<DataSize>(elementAlign, vectorAlign),
+			                          DataSize::Bytes(16));
+		}
+		
+	}
+	
+}
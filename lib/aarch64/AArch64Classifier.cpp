@@ -0,0 +1,192 @@
+#include <algorithm>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/aarch64/AArch64ABITypeLayout.hpp>
+#include <llvm-abi/aarch64/AArch64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace aarch64 {
+		
+		static bool isAggregateTypeForABI(const Type type) {
+			// Complex values are passed like a struct of two elements.
+			return type.isAggregateType() || type.isComplex();
+		}
+		
+		AArch64Classifier::AArch64Classifier(const AArch64ABITypeLayout& typeLayout)
+		: typeLayout_(typeLayout) { }
+		
+		ArgInfo AArch64Classifier::getNaturalAlignIndirect(const Type type,
+		                                                   const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer (in X8); the
+				// alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			// The caller makes a copy and passes a pointer to it.
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+		}
+		
+		ArgInfo AArch64Classifier::classifyReturnType(const Type returnType) const {
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// Large vector types should be returned via memory.
+			if (returnType.isVector() &&
+			    typeLayout_.getTypeAllocSize(returnType).asBits() > 128) {
+				return getNaturalAlignIndirect(returnType,
+				                               /*isReturnType=*/true);
+			}
+			
+			if (!isAggregateTypeForABI(returnType)) {
+				// DarwinPCS requires the caller to extend small
+				// integers to 32 bits; AAPCS64 leaves them undefined.
+				return returnType.isPromotableIntegerType() &&
+				       typeLayout_.isDarwinPCS() ?
+					ArgInfo::getExtend(returnType) :
+					ArgInfo::getDirect(returnType);
+			}
+			
+			const auto size = typeLayout_.getTypeAllocSize(returnType);
+			if (returnType.isEmptyRecord(/*allowArrays=*/true) ||
+			    size.asBits() == 0) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// Homogeneous aggregates are returned directly in V0-V3.
+			Type base = VoidTy;
+			uint64_t members = 0;
+			if (returnType.isHomogeneousAggregate(typeLayout_, base, members)) {
+				return ArgInfo::getDirect(returnType);
+			}
+			
+			// Aggregates <= 16 bytes are returned directly in X0-X1.
+			if (size.asBits() <= 128) {
+				const auto align = typeLayout_.getTypeRequiredAlign(returnType);
+				const auto roundedSize = size.roundUpToAlign(DataSize::Bits(64));
+				
+				// We use a pair of i64 for 16-byte aggregate with
+				// 8-byte alignment. For aggregates with 16-byte
+				// alignment, we use i128.
+				if (align.asBits() < 128 && roundedSize.asBits() == 128) {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(2, Int64Ty));
+				}
+				
+				return ArgInfo::getDirect(Type::FixedWidthInteger(roundedSize,
+				                                                  /*isSigned=*/false));
+			}
+			
+			return getNaturalAlignIndirect(returnType,
+			                               /*isReturnType=*/true);
+		}
+		
+		ArgInfo AArch64Classifier::classifyArgumentType(const Type argumentType) const {
+			// Handle illegal vector types here.
+			if (argumentType.isVector() &&
+			    !typeLayout_.isLegalVectorType(argumentType)) {
+				const auto size = typeLayout_.getTypeAllocSize(argumentType);
+				if (size.asBits() <= 32) {
+					return ArgInfo::getDirect(Int32Ty);
+				}
+				
+				if (size.asBits() == 64) {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getVectorTy(2, Int32Ty));
+				}
+				
+				if (size.asBits() == 128) {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getVectorTy(4, Int32Ty));
+				}
+				
+				return getNaturalAlignIndirect(argumentType);
+			}
+			
+			if (!isAggregateTypeForABI(argumentType)) {
+				return argumentType.isPromotableIntegerType() &&
+				       typeLayout_.isDarwinPCS() ?
+					ArgInfo::getExtend(argumentType) :
+					ArgInfo::getDirect(argumentType);
+			}
+			
+			// Empty records are ignored in C.
+			const auto size = typeLayout_.getTypeAllocSize(argumentType);
+			if (argumentType.isEmptyRecord(/*allowArrays=*/true) ||
+			    size.asBits() == 0) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// Homogeneous aggregates are passed in consecutive V
+			// registers (or entirely on the stack), so coerce them
+			// to an array of their base type.
+			Type base = VoidTy;
+			uint64_t members = 0;
+			if (argumentType.isHomogeneousAggregate(typeLayout_, base, members)) {
+				return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(members,
+				                                                               base));
+			}
+			
+			// Aggregates <= 16 bytes are passed directly in registers or
+			// on the stack.
+			if (size.asBits() <= 128) {
+				auto align = typeLayout_.getTypeRequiredAlign(argumentType);
+				if (typeLayout_.isDarwinPCS()) {
+					align = std::max<DataSize>(align,
+					                           typeLayout_.getPointerSize());
+				} else {
+					align = align.asBits() < 128 ?
+						DataSize::Bits(64) : DataSize::Bits(128);
+				}
+				
+				const auto roundedSize = size.roundUpToAlign(align);
+				
+				// We use a pair of i64 for 16-byte aggregate with
+				// 8-byte alignment. For aggregates with 16-byte
+				// alignment, we use i128.
+				const auto baseType = Type::FixedWidthInteger(align,
+				                                              /*isSigned=*/false);
+				if (roundedSize == align) {
+					return ArgInfo::getDirect(baseType);
+				}
+				
+				const auto count = roundedSize.asBits() / align.asBits();
+				return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(count,
+				                                                               baseType));
+			}
+			
+			return getNaturalAlignIndirect(argumentType);
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		AArch64Classifier::classifyFunctionType(const FunctionType& functionType,
+		                                        llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			argInfoArray.push_back(classifyReturnType(functionType.returnType()));
+			
+			// Variadic arguments are classified like any other. The
+			// differences for DarwinPCS (where anonymous arguments are
+			// always passed on the stack) are handled by the backend,
+			// based on the callee's IR function type.
+			for (const auto& argumentType: argumentTypes) {
+				argInfoArray.push_back(classifyArgumentType(argumentType));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
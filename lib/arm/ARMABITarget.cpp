@@ -0,0 +1,124 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/arm/ARMABITarget.hpp>
+#include <llvm-abi/arm/ARMABITypeLayout.hpp>
+#include <llvm-abi/arm/ARMClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace arm {
+		
+		ARMABIKind getDefaultARMABIKind(const llvm::Triple& targetTriple) {
+			switch (targetTriple.getEnvironment()) {
+				case llvm::Triple::GNUEABIHF:
+				case llvm::Triple::MuslEABIHF:
+				case llvm::Triple::EABIHF:
+					return AAPCS_VFP;
+				default:
+					return AAPCS;
+			}
+		}
+		
+		ARMABITarget::ARMABITarget(const llvm::Triple& targetTriple)
+		: ARMABITarget(targetTriple, getDefaultARMABIKind(targetTriple)) { }
+		
+		ARMABITarget::ARMABITarget(const llvm::Triple& targetTriple,
+		                           const ARMABIKind abiKind)
+		: ABITarget(targetTriple),
+		abiKind_(abiKind),
+		typeLayout_(targetTriple, &(cache())) { }
+		
+		ARMABITarget::~ARMABITarget() { }
+		
+		ARMABIKind ARMABITarget::abiKind() const {
+			return abiKind_;
+		}
+		
+		std::string ARMABITarget::name() const {
+			return "ARM";
+		}
+		
+		llvm::Type* ARMABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getDoubleTy(llvmContext);
+		}
+		
+		static llvm::CallingConv::ID getLLVMDefaultCC(const llvm::Triple& targetTriple) {
+			switch (targetTriple.getEnvironment()) {
+				case llvm::Triple::GNUEABIHF:
+				case llvm::Triple::MuslEABIHF:
+				case llvm::Triple::EABIHF:
+					return llvm::CallingConv::ARM_AAPCS_VFP;
+				case llvm::Triple::Android:
+				case llvm::Triple::GNUEABI:
+				case llvm::Triple::MuslEABI:
+				case llvm::Triple::EABI:
+					return llvm::CallingConv::ARM_AAPCS;
+				default:
+					return llvm::CallingConv::ARM_APCS;
+			}
+		}
+		
+		llvm::CallingConv::ID ARMABITarget::getCallingConvention(const CallingConvention callingConvention) const {
+			switch (callingConvention) {
+				case CC_CDefault:
+				case CC_CppDefault:
+				case CC_CDecl: {
+					// The backend picks its default convention from
+					// the triple, so only name the convention when the
+					// ABI kind doesn't match that default.
+					const auto abiCC = abiKind() == AAPCS_VFP ?
+						llvm::CallingConv::ARM_AAPCS_VFP :
+						llvm::CallingConv::ARM_AAPCS;
+					if (abiCC != getLLVMDefaultCC(targetTriple())) {
+						return abiCC;
+					}
+					return llvm::CallingConv::C;
+				}
+				case CC_Fast:
+					return llvm::CallingConv::Fast;
+				default:
+					llvm_unreachable("Invalid calling convention for ABI.");
+			}
+		}
+		
+		const ARMABITypeLayout& ARMABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		ARMABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                       llvm::ArrayRef<Type> argumentTypes) const {
+			ARMClassifier classifier(typeLayout_, abiKind_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		ARMABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// R0-R3, and D0-D7 for AAPCS-VFP.
+			return ABIRegisterFile(/*intRegisters=*/4,
+			                       /*fpRegisters=*/abiKind_ == AAPCS_VFP ? 8 : 0,
+			                       DataSize::Bytes(4));
+		}
+		
+	}
+	
+}
@@ -0,0 +1,185 @@
+#include <algorithm>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/arm/ARMABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace arm {
+		
+		ARMABITypeLayout::ARMABITypeLayout(const llvm::Triple& targetTriple,
+		                                   const ABICache* const cache)
+		: isBigEndian_(targetTriple.getArch() == llvm::Triple::armeb ||
+		               targetTriple.getArch() == llvm::Triple::thumbeb),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		const TypeBuilder& ARMABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize ARMABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize ARMABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize ARMABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize ARMABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize ARMABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		ARMABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool ARMABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// Half precision isn't a legal type without the full
+			// FP16 extension, so vectors of it are passed as
+			// integer vectors to keep the ABI independent of the
+			// hardware.
+			if (type.vectorElementType() == HalfFloatTy) {
+				return false;
+			}
+			
+			// Vectors must have a power of 2 number of elements
+			// and be larger than 32 bits.
+			return llvm::isPowerOf2_64(type.vectorElementCount()) &&
+			       getTypeAllocSize(type).asBits() > 32;
+		}
+		
+		bool ARMABITypeLayout::isBigEndian() const {
+			return isBigEndian_;
+		}
+		
+		bool ARMABITypeLayout::isCharSigned() const {
+			return false;
+		}
+		
+		bool ARMABITypeLayout::isHomogeneousAggregateBaseType(const Type type) const {
+			// Homogeneous aggregates for AAPCS-VFP must have base
+			// types of float, double or 64-bit or 128-bit vectors.
+			if (type.isFloat() || type.isDouble() || type.isLongDouble()) {
+				return true;
+			}
+			
+			if (type.isVector()) {
+				const auto size = getTypeAllocSize(type);
+				return size.asBits() == 64 || size.asBits() == 128;
+			}
+			
+			return false;
+		}
+		
+		bool ARMABITypeLayout::isHomogeneousAggregateSmallEnough(const Type /*base*/,
+		                                                         const uint64_t members) const {
+			// Up to four members are passed in consecutive S, D or
+			// Q registers.
+			return members <= 4;
+		}
+		
+		DataSize ARMABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(4);
+		}
+		
+		DataSize ARMABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize ARMABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+					return DataSize::Bytes(4);
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize ARMABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize ARMABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(8);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize ARMABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return std::min<DataSize>(getFloatSize(kind), DataSize::Bytes(8));
+		}
+		
+		DataSize ARMABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize ARMABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize ARMABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize ARMABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned, up to 8 bytes.
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			return std::min<DataSize>(std::max<DataSize>(elementAlign, vectorAlign),
+			                          DataSize::Bytes(8));
+		}
+		
+	}
+	
+}
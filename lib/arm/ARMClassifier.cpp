@@ -0,0 +1,229 @@
+#include <algorithm>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/arm/ARMABITypeLayout.hpp>
+#include <llvm-abi/arm/ARMClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace arm {
+		
+		static bool isAggregateTypeForABI(const Type type) {
+			// Complex values are passed like a struct of two elements.
+			return type.isAggregateType() || type.isComplex();
+		}
+		
+		static bool isHalfVector(const Type type) {
+			return type.isVector() &&
+			       type.vectorElementType() == HalfFloatTy;
+		}
+		
+		ARMClassifier::ARMClassifier(const ARMABITypeLayout& typeLayout,
+		                             const ARMABIKind abiKind)
+		: typeLayout_(typeLayout), abiKind_(abiKind) { }
+		
+		ArgInfo ARMClassifier::getNaturalAlignIndirect(const Type type,
+		                                               const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer (in R0); the
+				// alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+		}
+		
+		ArgInfo ARMClassifier::coerceIllegalVector(const Type type) const {
+			const auto size = typeLayout_.getTypeAllocSize(type);
+			if (size.asBits() <= 32) {
+				return ArgInfo::getDirect(Int32Ty);
+			}
+			
+			if (size.asBits() == 64 || size.asBits() == 128) {
+				return ArgInfo::getDirect(typeLayout_.typeBuilder().getVectorTy(size.asBits() / 32,
+				                                                                Int32Ty));
+			}
+			
+			return getNaturalAlignIndirect(type);
+		}
+		
+		ArgInfo ARMClassifier::classifyReturnType(const Type returnType,
+		                                          const bool isVariadic) const {
+			const bool isEffectivelyVFP = abiKind_ == AAPCS_VFP && !isVariadic;
+			
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			if (returnType.isVector()) {
+				// Large vector types should be returned via memory.
+				if (typeLayout_.getTypeAllocSize(returnType).asBits() > 128) {
+					return getNaturalAlignIndirect(returnType,
+					                               /*isReturnType=*/true);
+				}
+				
+				if (isHalfVector(returnType)) {
+					return coerceIllegalVector(returnType);
+				}
+			}
+			
+			// Half precision values are returned as if they were a
+			// float or an int, with the top 16 bits unspecified.
+			if (returnType == HalfFloatTy) {
+				return ArgInfo::getDirect(isEffectivelyVFP ? FloatTy : Int32Ty);
+			}
+			
+			if (!isAggregateTypeForABI(returnType)) {
+				return returnType.isPromotableIntegerType() ?
+					ArgInfo::getExtend(returnType) :
+					ArgInfo::getDirect(returnType);
+			}
+			
+			if (returnType.isEmptyRecord(/*allowArrays=*/true)) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// Homogeneous aggregates are returned directly in
+			// S0-S3/D0-D3 with AAPCS-VFP.
+			if (isEffectivelyVFP) {
+				Type base = VoidTy;
+				uint64_t members = 0;
+				if (returnType.isHomogeneousAggregate(typeLayout_, base, members)) {
+					return ArgInfo::getDirect(returnType, /*offset=*/0,
+					                          /*padding=*/VoidTy,
+					                          /*canBeFlattened=*/false);
+				}
+			}
+			
+			// Aggregates <= 4 bytes are returned in R0; other
+			// aggregates are returned indirectly.
+			const auto size = typeLayout_.getTypeAllocSize(returnType);
+			if (size.asBits() <= 32) {
+				// Return in a 32 bit integer type (as if loaded by
+				// LDR, AAPCS 5.4) on big endian targets.
+				if (typeLayout_.isBigEndian()) {
+					return ArgInfo::getDirect(Int32Ty);
+				}
+				
+				// Otherwise return in the smallest viable integer type.
+				if (size.asBits() <= 8) {
+					return ArgInfo::getDirect(Int8Ty);
+				}
+				
+				if (size.asBits() <= 16) {
+					return ArgInfo::getDirect(Int16Ty);
+				}
+				
+				return ArgInfo::getDirect(Int32Ty);
+			}
+			
+			return getNaturalAlignIndirect(returnType,
+			                               /*isReturnType=*/true);
+		}
+		
+		ArgInfo ARMClassifier::classifyArgumentType(const Type argumentType,
+		                                            const bool isVariadic) const {
+			const bool isEffectivelyVFP = abiKind_ == AAPCS_VFP && !isVariadic;
+			
+			// Handle illegal vector types here.
+			if (argumentType.isVector() &&
+			    !typeLayout_.isLegalVectorType(argumentType)) {
+				return coerceIllegalVector(argumentType);
+			}
+			
+			// Half precision values are passed as if they were a
+			// float or an int, with the top 16 bits unspecified.
+			if (argumentType == HalfFloatTy) {
+				return ArgInfo::getDirect(isEffectivelyVFP ? FloatTy : Int32Ty);
+			}
+			
+			if (!isAggregateTypeForABI(argumentType)) {
+				return argumentType.isPromotableIntegerType() ?
+					ArgInfo::getExtend(argumentType) :
+					ArgInfo::getDirect(argumentType);
+			}
+			
+			// Empty records are ignored in C.
+			if (argumentType.isEmptyRecord(/*allowArrays=*/true)) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// Homogeneous aggregates are passed as first class
+			// aggregates, so that the backend can allocate them to
+			// consecutive VFP registers (back-filling any registers
+			// skipped by earlier arguments) or to the stack.
+			if (isEffectivelyVFP) {
+				Type base = VoidTy;
+				uint64_t members = 0;
+				if (argumentType.isHomogeneousAggregate(typeLayout_, base, members)) {
+					return ArgInfo::getDirect(argumentType, /*offset=*/0,
+					                          /*padding=*/VoidTy,
+					                          /*canBeFlattened=*/false);
+				}
+			}
+			
+			// The ABI alignment of an aggregate is at least 4 bytes
+			// and at most 8 bytes; larger aggregates passed by value
+			// are realigned by the callee.
+			const auto typeAlign = typeLayout_.getTypeRequiredAlign(argumentType);
+			const auto abiAlign = std::min<DataSize>(std::max<DataSize>(typeAlign,
+			                                                            DataSize::Bytes(4)),
+			                                         DataSize::Bytes(8));
+			
+			const auto size = typeLayout_.getTypeAllocSize(argumentType);
+			if (size.asBytes() > 64) {
+				return ArgInfo::getIndirect(abiAlign.asBytes(),
+				                            /*byVal=*/true,
+				                            /*realign=*/typeAlign > abiAlign);
+			}
+			
+			// Otherwise coerce to an array of core registers. 8-byte
+			// aligned aggregates use i64 elements, which the backend
+			// allocates to an even numbered register pair (or an
+			// 8-byte aligned stack slot).
+			if (typeAlign.asBytes() <= 4) {
+				const auto count = (size.asBits() + 31) / 32;
+				return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(count,
+				                                                               Int32Ty));
+			} else {
+				const auto count = (size.asBits() + 63) / 64;
+				return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(count,
+				                                                               Int64Ty));
+			}
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		ARMClassifier::classifyFunctionType(const FunctionType& functionType,
+		                                    llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			// Variadic functions use the base AAPCS for all
+			// arguments and the return value (AAPCS 6.1.2.2).
+			const bool isVariadic = functionType.isVarArg();
+			
+			argInfoArray.push_back(classifyReturnType(functionType.returnType(),
+			                                          isVariadic));
+			
+			for (const auto& argumentType: argumentTypes) {
+				argInfoArray.push_back(classifyArgumentType(argumentType,
+				                                            isVariadic));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
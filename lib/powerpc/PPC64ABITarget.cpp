@@ -0,0 +1,92 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/powerpc/PPC64ABITarget.hpp>
+#include <llvm-abi/powerpc/PPC64ABITypeLayout.hpp>
+#include <llvm-abi/powerpc/PPC64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace powerpc {
+		
+		PPC64ABIKind getDefaultPPC64ABIKind(const llvm::Triple& targetTriple) {
+			if (targetTriple.getArch() == llvm::Triple::ppc64le ||
+			    targetTriple.isMusl()) {
+				return ELFv2;
+			}
+			return ELFv1;
+		}
+		
+		PPC64ABITarget::PPC64ABITarget(const llvm::Triple& targetTriple)
+		: PPC64ABITarget(targetTriple,
+		                 getDefaultPPC64ABIKind(targetTriple),
+		                 getDefaultLongDoubleFormat(targetTriple)) { }
+		
+		PPC64ABITarget::PPC64ABITarget(const llvm::Triple& targetTriple,
+		                               const PPC64ABIKind abiKind,
+		                               const LongDoubleFormat longDoubleFormat)
+		: ABITarget(targetTriple),
+		abiKind_(abiKind),
+		typeLayout_(targetTriple, longDoubleFormat, &(cache())) { }
+		
+		PPC64ABITarget::~PPC64ABITarget() { }
+		
+		PPC64ABIKind PPC64ABITarget::abiKind() const {
+			return abiKind_;
+		}
+		
+		std::string PPC64ABITarget::name() const {
+			return "PPC64";
+		}
+		
+		llvm::Type* PPC64ABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			switch (typeLayout_.longDoubleFormat()) {
+				case LongDoubleIBM128:
+					return llvm::Type::getPPC_FP128Ty(llvmContext);
+				case LongDoubleIEEEQuad:
+					return llvm::Type::getFP128Ty(llvmContext);
+				case LongDoubleIEEEDouble:
+					return llvm::Type::getDoubleTy(llvmContext);
+			}
+			llvm_unreachable("Unknown long double format.");
+		}
+		
+		const PPC64ABITypeLayout& PPC64ABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		PPC64ABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                         llvm::ArrayRef<Type> argumentTypes) const {
+			PPC64Classifier classifier(typeLayout_, abiKind_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		PPC64ABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// R3-R10 and F1-F13.
+			return ABIRegisterFile(/*intRegisters=*/8,
+			                       /*fpRegisters=*/13,
+			                       DataSize::Bytes(8));
+		}
+		
+	}
+	
+}
@@ -0,0 +1,193 @@
+#include <algorithm>
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/powerpc/PPC64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace powerpc {
+		
+		LongDoubleFormat getDefaultLongDoubleFormat(const llvm::Triple& targetTriple) {
+			if (targetTriple.isOSFreeBSD() || targetTriple.isMusl()) {
+				return LongDoubleIEEEDouble;
+			}
+			return LongDoubleIBM128;
+		}
+		
+		PPC64ABITypeLayout::PPC64ABITypeLayout(const llvm::Triple& targetTriple,
+		                                       const LongDoubleFormat longDoubleFormat,
+		                                       const ABICache* const cache)
+		: longDoubleFormat_(longDoubleFormat),
+		isBigEndian_(targetTriple.getArch() == llvm::Triple::ppc64),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		LongDoubleFormat PPC64ABITypeLayout::longDoubleFormat() const {
+			return longDoubleFormat_;
+		}
+		
+		const TypeBuilder& PPC64ABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize PPC64ABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize PPC64ABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize PPC64ABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize PPC64ABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize PPC64ABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		PPC64ABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool PPC64ABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// Only 128-bit vectors map onto AltiVec/VSX registers.
+			return getTypeAllocSize(type).asBits() == 128;
+		}
+		
+		bool PPC64ABITypeLayout::isBigEndian() const {
+			return isBigEndian_;
+		}
+		
+		bool PPC64ABITypeLayout::isCharSigned() const {
+			return false;
+		}
+		
+		bool PPC64ABITypeLayout::isHomogeneousAggregateBaseType(const Type type) const {
+			// Homogeneous aggregates for ELFv2 must have base types of
+			// float, double, long double, or 128-bit vectors.
+			if (type.isFloatingPoint()) {
+				return type.floatingPointKind() != HalfFloat;
+			}
+			
+			if (type.isVector()) {
+				return getTypeAllocSize(type).asBits() == 128;
+			}
+			
+			return false;
+		}
+		
+		bool PPC64ABITypeLayout::isHomogeneousAggregateSmallEnough(const Type base,
+		                                                           const uint64_t members) const {
+			// Vector and IEEE quad types require one register, other
+			// floating point types require one or two registers
+			// depending on their size.
+			const bool isQuad = base.isFloatingPoint() &&
+			                    (base.floatingPointKind() == Float128 ||
+			                     (base.isLongDouble() &&
+			                      longDoubleFormat() == LongDoubleIEEEQuad));
+			const uint64_t numRegs = (isQuad || base.isVector()) ? 1 :
+				(getTypeAllocSize(base).asBits() + 63) / 64;
+				
+			// Homogeneous aggregates may occupy at most 8 registers.
+			return members * numRegs <= 8;
+		}
+		
+		DataSize PPC64ABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(8);
+		}
+		
+		DataSize PPC64ABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize PPC64ABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize PPC64ABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize PPC64ABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(longDoubleFormat() == LongDoubleIEEEDouble ? 8 : 16);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize PPC64ABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return getFloatSize(kind);
+		}
+		
+		DataSize PPC64ABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize PPC64ABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize PPC64ABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize PPC64ABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned.
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			return std::max<DataSize>(elementAlign, vectorAlign);
+		}
+		
+	}
+	
+}
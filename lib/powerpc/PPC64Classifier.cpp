@@ -0,0 +1,250 @@
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/powerpc/PPC64ABITypeLayout.hpp>
+#include <llvm-abi/powerpc/PPC64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace powerpc {
+		
+		// The size of a GPR (and parameter save area doubleword).
+		static const uint64_t GPRBits = 64;
+		
+		static bool isAggregateTypeForABI(const Type type) {
+			// Complex values are passed like a struct of two elements.
+			return type.isAggregateType() || type.isComplex();
+		}
+		
+		static bool isPromotableTypeForABI(const PPC64ABITypeLayout& typeLayout,
+		                                   const Type type) {
+			// Integers narrower than a GPR (including 'int' and
+			// 'unsigned int') are extended to 64 bits.
+			return type.isInteger() &&
+			       typeLayout.getTypeAllocSize(type).asBits() < GPRBits;
+		}
+		
+		// Get the element of a single-element struct, if it must be
+		// passed in an FPR or VR.
+		static Type getSingleFloatOrVectorElement(const PPC64ABITypeLayout& typeLayout,
+		                                          const Type type) {
+			const auto elementType = type.getStructSingleElement(typeLayout);
+			if (elementType.isFloatingPoint() ||
+			    (elementType.isVector() &&
+			     typeLayout.getTypeAllocSize(elementType).asBits() == 128)) {
+				return elementType;
+			}
+			return VoidTy;
+		}
+		
+		PPC64Classifier::PPC64Classifier(const PPC64ABITypeLayout& typeLayout,
+		                                 const PPC64ABIKind abiKind)
+		: typeLayout_(typeLayout),
+		abiKind_(abiKind) { }
+		
+		DataSize PPC64Classifier::getParamTypeAlignment(Type type) const {
+			// Complex types are passed just like their elements.
+			if (type.isComplex()) {
+				type = type.complexFloatingPointType();
+			}
+			
+			// Only vector types of size 16 bytes need alignment (larger
+			// types are passed via reference, smaller types are not
+			// aligned).
+			if (type.isVector()) {
+				return DataSize::Bytes(typeLayout_.getTypeAllocSize(type).asBits() == 128 ? 16 : 8);
+			}
+			
+			// For single-element float/vector structs, we consider the
+			// whole type to have the same alignment requirements as its
+			// single element.
+			auto alignAsType = getSingleFloatOrVectorElement(typeLayout_, type);
+			
+			// Likewise for ELFv2 homogeneous aggregates.
+			Type base = VoidTy;
+			uint64_t members = 0;
+			if (alignAsType.isVoid() && abiKind_ == ELFv2 &&
+			    isAggregateTypeForABI(type) &&
+			    type.isHomogeneousAggregate(typeLayout_, base, members)) {
+				alignAsType = base;
+			}
+			
+			// With special case aggregates, only vector base types need
+			// alignment.
+			if (!alignAsType.isVoid()) {
+				return DataSize::Bytes(alignAsType.isVector() ? 16 : 8);
+			}
+			
+			// Otherwise, we only need alignment for any aggregate type
+			// that has an alignment requirement of >= 16 bytes.
+			if (isAggregateTypeForABI(type) &&
+			    typeLayout_.getTypeRequiredAlign(type).asBytes() >= 16) {
+				return DataSize::Bytes(16);
+			}
+			
+			return DataSize::Bytes(8);
+		}
+		
+		ArgInfo PPC64Classifier::classifyReturnType(const Type returnType) const {
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			if (returnType.isComplex()) {
+				return ArgInfo::getDirect(returnType);
+			}
+			
+			// Non-AltiVec vector types are returned in GPRs (smaller
+			// than 16 bytes) or via reference (larger than 16 bytes).
+			if (returnType.isVector()) {
+				const auto size = typeLayout_.getTypeAllocSize(returnType);
+				if (size.asBits() > 128) {
+					// Returned via a hidden sret pointer; the
+					// alignment is unused.
+					return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+				} else if (size.asBits() < 128) {
+					return ArgInfo::getDirect(Type::FixedWidthInteger(size,
+					                                                  /*isSigned=*/false));
+				}
+			}
+			
+			if (isAggregateTypeForABI(returnType)) {
+				// ELFv2 homogeneous aggregates are returned as array
+				// types.
+				Type base = VoidTy;
+				uint64_t members = 0;
+				if (abiKind_ == ELFv2 &&
+				    returnType.isHomogeneousAggregate(typeLayout_, base, members)) {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(members,
+					                                                               base));
+				}
+				
+				// ELFv2 small aggregates are returned in up to two
+				// registers.
+				const auto size = typeLayout_.getTypeAllocSize(returnType);
+				if (abiKind_ == ELFv2 && size.asBits() <= 2 * GPRBits) {
+					if (size.asBits() == 0) {
+						return ArgInfo::getIgnore();
+					}
+					
+					if (size.asBits() > GPRBits) {
+						return ArgInfo::getDirect(typeLayout_.typeBuilder().getStructTy({ UInt64Ty,
+						                                                                  UInt64Ty }));
+					}
+					
+					return ArgInfo::getDirect(Type::FixedWidthInteger(size.roundUpToAlign(DataSize::Bits(8)),
+					                                                  /*isSigned=*/false));
+				}
+				
+				// All other aggregates are returned indirectly.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			return isPromotableTypeForABI(typeLayout_, returnType) ?
+				ArgInfo::getExtend(returnType) :
+				ArgInfo::getDirect(returnType);
+		}
+		
+		ArgInfo PPC64Classifier::classifyArgumentType(const Type argumentType) const {
+			if (argumentType.isComplex()) {
+				return ArgInfo::getDirect(argumentType);
+			}
+			
+			// Non-AltiVec vector types are passed in GPRs (smaller than
+			// 16 bytes) or via reference (larger than 16 bytes).
+			if (argumentType.isVector()) {
+				const auto size = typeLayout_.getTypeAllocSize(argumentType);
+				if (size.asBits() > 128) {
+					const auto align = typeLayout_.getTypeRequiredAlign(argumentType);
+					return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+				} else if (size.asBits() < 128) {
+					return ArgInfo::getDirect(Type::FixedWidthInteger(size,
+					                                                  /*isSigned=*/false));
+				}
+			}
+			
+			if (isAggregateTypeForABI(argumentType)) {
+				const auto abiAlign = getParamTypeAlignment(argumentType);
+				const auto typeAlign = typeLayout_.getTypeRequiredAlign(argumentType);
+				
+				// ELFv2 homogeneous aggregates are passed as array
+				// types.
+				Type base = VoidTy;
+				uint64_t members = 0;
+				if (abiKind_ == ELFv2 &&
+				    argumentType.isHomogeneousAggregate(typeLayout_, base, members)) {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(members,
+					                                                               base));
+				}
+				
+				// If an aggregate may end up fully in registers, we do
+				// not use the ByVal method, but pass the aggregate as
+				// array. This is usually beneficial since we avoid
+				// forcing the back-end to store the argument to memory.
+				const auto size = typeLayout_.getTypeAllocSize(argumentType);
+				if (size.asBits() > 0 && size.asBits() <= 8 * GPRBits) {
+					// Types up to 8 bytes are passed as integer type
+					// (which will be properly aligned in the argument
+					// save area doubleword).
+					if (size.asBits() <= GPRBits) {
+						return ArgInfo::getDirect(Type::FixedWidthInteger(size.roundUpToAlign(DataSize::Bits(8)),
+						                                                  /*isSigned=*/false));
+					}
+					
+					// Larger types are passed as arrays, with the base
+					// type selected according to the required alignment
+					// in the save area.
+					const auto registerType = Type::FixedWidthInteger(abiAlign,
+					                                                  /*isSigned=*/false);
+					const auto count = size.roundUpToAlign(abiAlign) / abiAlign;
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(count,
+					                                                               registerType));
+				}
+				
+				// All other aggregates are passed ByVal.
+				return ArgInfo::getIndirect(abiAlign.asBytes(),
+				                            /*byVal=*/true,
+				                            /*realign=*/typeAlign > abiAlign);
+			}
+			
+			return isPromotableTypeForABI(typeLayout_, argumentType) ?
+				ArgInfo::getExtend(argumentType) :
+				ArgInfo::getDirect(argumentType);
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		PPC64Classifier::classifyFunctionType(const FunctionType& functionType,
+		                                      llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			argInfoArray.push_back(classifyReturnType(functionType.returnType()));
+			
+			for (const auto& argumentType: argumentTypes) {
+				// An aggregate containing a single floating-point or
+				// vector item must be passed in a register if one is
+				// available.
+				const auto elementType = getSingleFloatOrVectorElement(typeLayout_,
+				                                                       argumentType);
+				if (!elementType.isVoid()) {
+					argInfoArray.push_back(ArgInfo::getDirectInReg(elementType));
+					continue;
+				}
+				
+				argInfoArray.push_back(classifyArgumentType(argumentType));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
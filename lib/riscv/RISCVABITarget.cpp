@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/riscv/RISCVABITarget.hpp>
+#include <llvm-abi/riscv/RISCVABITypeLayout.hpp>
+#include <llvm-abi/riscv/RISCVClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace riscv {
+		
+		static unsigned getXLen(const llvm::Triple& targetTriple) {
+			return targetTriple.isArch64Bit() ? 64 : 32;
+		}
+		
+		static std::string getDefaultABIName(const llvm::Triple& targetTriple,
+		                                     const std::string& isaString) {
+			const std::string prefix = targetTriple.isArch64Bit() ? "lp64" : "ilp32";
+			
+			if (isaString.compare(0, 2, "rv") != 0) {
+				// Linux distributions target RV*GC, with the
+				// hardware double precision ABI.
+				return targetTriple.isOSLinux() ? prefix + "d" : prefix;
+			}
+			
+			// The single letter extensions follow "rv32"/"rv64" and
+			// end at the first multi-letter ('s', 'x' or 'z') one.
+			const auto start = isaString.find_first_not_of("rv0123456789");
+			const auto end = isaString.find_first_of("_sxz", start);
+			const auto extensions = isaString.substr(std::min(start, isaString.size()),
+			                                         end - start);
+			
+			// 'g' is shorthand for "imafd".
+			if (extensions.find_first_of("gd") != std::string::npos) {
+				return prefix + "d";
+			} else if (extensions.find('f') != std::string::npos) {
+				return prefix + "f";
+			} else {
+				return prefix;
+			}
+		}
+		
+		static unsigned getFLen(const llvm::Triple& targetTriple,
+		                        const std::string& abiName) {
+			const std::string prefix = targetTriple.isArch64Bit() ? "lp64" : "ilp32";
+			if (abiName == prefix) {
+				return 0;
+			} else if (abiName == prefix + "f") {
+				return 32;
+			} else if (abiName == prefix + "d") {
+				return 64;
+			}
+			
+			std::string errorString = "Invalid RISC-V ABI name '";
+			errorString += abiName;
+			errorString += "' for triple: ";
+			errorString += targetTriple.str();
+			throw std::runtime_error(errorString);
+		}
+		
+		RISCVABITarget::RISCVABITarget(const llvm::Triple& targetTriple,
+		                               const std::string& cpuName,
+		                               const std::string& abiName)
+		: ABITarget(targetTriple),
+		abiName_(!abiName.empty() ? abiName :
+		         getDefaultABIName(targetTriple, cpuName)),
+		fLen_(getFLen(targetTriple, abiName_)),
+		typeLayout_(getXLen(targetTriple), &(cache())) { }
+		
+		RISCVABITarget::~RISCVABITarget() { }
+		
+		const std::string& RISCVABITarget::abiName() const {
+			return abiName_;
+		}
+		
+		unsigned RISCVABITarget::fLen() const {
+			return fLen_;
+		}
+		
+		std::string RISCVABITarget::name() const {
+			return "RISCV";
+		}
+		
+		llvm::Type* RISCVABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getFP128Ty(llvmContext);
+		}
+		
+		const RISCVABITypeLayout& RISCVABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		RISCVABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                         llvm::ArrayRef<Type> argumentTypes) const {
+			RISCVClassifier classifier(typeLayout_, fLen_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		RISCVABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// A0-A7, and FA0-FA7 for hardware floating point ABIs.
+			return ABIRegisterFile(/*intRegisters=*/8,
+			                       /*fpRegisters=*/fLen_ != 0 ? 8 : 0,
+			                       DataSize::Bytes(targetTriple().isArch64Bit() ? 8 : 4));
+		}
+		
+	}
+	
+}
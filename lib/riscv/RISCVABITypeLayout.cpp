@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/riscv/RISCVABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace riscv {
+		
+		RISCVABITypeLayout::RISCVABITypeLayout(const unsigned xLen,
+		                                       const ABICache* const cache)
+		: xLen_(xLen),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{
+			assert(xLen == 32 || xLen == 64);
+		}
+		
+		unsigned RISCVABITypeLayout::xLen() const {
+			return xLen_;
+		}
+		
+		const TypeBuilder& RISCVABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize RISCVABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize RISCVABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize RISCVABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize RISCVABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize RISCVABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		RISCVABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool RISCVABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// There are no vector registers in the standard calling
+			// convention; vectors are passed like aggregates.
+			return false;
+		}
+		
+		bool RISCVABITypeLayout::isBigEndian() const {
+			return false;
+		}
+		
+		bool RISCVABITypeLayout::isCharSigned() const {
+			return false;
+		}
+		
+		DataSize RISCVABITypeLayout::getPointerSize() const {
+			return DataSize::Bits(xLen());
+		}
+		
+		DataSize RISCVABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize RISCVABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+					return DataSize::Bits(xLen());
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize RISCVABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize RISCVABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize RISCVABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return getFloatSize(kind);
+		}
+		
+		DataSize RISCVABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize RISCVABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize RISCVABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize RISCVABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned.
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			return std::max<DataSize>(elementAlign, vectorAlign);
+		}
+		
+	}
+	
+}
@@ -0,0 +1,458 @@
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/riscv/RISCVABITypeLayout.hpp>
+#include <llvm-abi/riscv/RISCVClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace riscv {
+		
+		// The number of integer and floating point argument registers
+		// (a0-a7 and fa0-fa7).
+		static const int NumArgGPRs = 8;
+		static const int NumArgFPRs = 8;
+		
+		static bool isAggregateTypeForABI(const Type type) {
+			// Complex values are passed like a struct of two elements.
+			return type.isAggregateType() || type.isComplex();
+		}
+		
+		RISCVClassifier::RISCVClassifier(const RISCVABITypeLayout& typeLayout,
+		                                 const unsigned fLen)
+		: typeLayout_(typeLayout),
+		xLen_(typeLayout.xLen()),
+		fLen_(fLen) { }
+		
+		ArgInfo RISCVClassifier::getNaturalAlignIndirect(const Type type,
+		                                                 const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer (in a0); the
+				// alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			// The caller makes a copy and passes a pointer to it.
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+		}
+		
+		bool
+		RISCVClassifier::detectFPCCEligibleStructHelper(const Type type,
+		                                                const DataSize currentOffset,
+		                                                Type& field1Type,
+		                                                DataSize& field1Offset,
+		                                                Type& field2Type,
+		                                                DataSize& field2Offset) const {
+			const bool isInt = type.isInteger();
+			const bool isFloat = type.isFloatingPoint();
+			
+			if (isInt || isFloat) {
+				const auto size = typeLayout_.getTypeAllocSize(type);
+				if (isInt && size.asBits() > xLen_) {
+					return false;
+				}
+				
+				// Can't be eligible if larger than the FP registers.
+				// Half precision isn't supported by the ABI, so use
+				// the integer rules for it.
+				if (isFloat && (size.asBits() > fLen_ || size.asBits() < 32)) {
+					return false;
+				}
+				
+				// int+int pairs are not eligible.
+				if (isInt && field1Type.isInteger()) {
+					return false;
+				}
+				
+				if (field1Type.isVoid()) {
+					field1Type = type;
+					field1Offset = currentOffset;
+					return true;
+				}
+				
+				if (field2Type.isVoid()) {
+					field2Type = type;
+					field2Offset = currentOffset;
+					return true;
+				}
+				
+				return false;
+			}
+			
+			if (type.isComplex()) {
+				if (!field1Type.isVoid()) {
+					return false;
+				}
+				
+				const auto elementType = type.complexFloatingPointType();
+				const auto elementSize = typeLayout_.getTypeAllocSize(elementType);
+				if (elementSize.asBits() > fLen_) {
+					return false;
+				}
+				
+				field1Type = elementType;
+				field1Offset = currentOffset;
+				field2Type = elementType;
+				field2Offset = currentOffset + elementSize;
+				return true;
+			}
+			
+			if (type.isArray()) {
+				const auto elementType = type.arrayElementType();
+				const auto elementSize = typeLayout_.getTypeAllocSize(elementType);
+				
+				auto offset = currentOffset;
+				for (size_t i = 0; i < type.arrayElementCount(); i++) {
+					if (!detectFPCCEligibleStructHelper(elementType, offset,
+					                                    field1Type, field1Offset,
+					                                    field2Type, field2Offset)) {
+						return false;
+					}
+					offset += elementSize;
+				}
+				return true;
+			}
+			
+			if (type.isRecordType()) {
+				if (type.isEmptyRecord(/*allowArrays=*/true)) {
+					return true;
+				}
+				
+				// Unions aren't eligible unless they're empty.
+				if (type.isUnion()) {
+					return false;
+				}
+				
+				const auto& members = type.structMembers();
+				const auto offsets = typeLayout_.calculateStructOffsets(members);
+				
+				size_t zeroWidthBitFieldCount = 0;
+				for (size_t i = 0; i < members.size(); i++) {
+					auto memberType = members[i].type();
+					if (members[i].isBitField()) {
+						const auto width = members[i].bitFieldWidth();
+						
+						// Allow a bitfield with a type greater than
+						// XLen as long as its width is XLen or less.
+						if (typeLayout_.getTypeAllocSize(memberType).asBits() > xLen_ &&
+						    width.asBits() <= xLen_) {
+							memberType = Type::FixedWidthInteger(DataSize::Bits(xLen_),
+							                                     /*isSigned=*/false);
+						}
+						
+						if (width.asBits() == 0) {
+							zeroWidthBitFieldCount++;
+							continue;
+						}
+					}
+					
+					if (!detectFPCCEligibleStructHelper(memberType,
+					                                    currentOffset + offsets[i],
+					                                    field1Type, field1Offset,
+					                                    field2Type, field2Offset)) {
+						return false;
+					}
+					
+					// As a quirk of the ABI, zero-width bitfields aren't
+					// ignored for fp+fp or int+fp structs, but are ignored
+					// for a struct with an fp field and any number of
+					// zero-width bitfields.
+					if (!field2Type.isVoid() && zeroWidthBitFieldCount > 0) {
+						return false;
+					}
+				}
+				
+				return !field1Type.isVoid();
+			}
+			
+			return false;
+		}
+		
+		bool
+		RISCVClassifier::detectFPCCEligibleStruct(const Type type,
+		                                          Type& field1Type,
+		                                          DataSize& field1Offset,
+		                                          Type& field2Type,
+		                                          DataSize& field2Offset,
+		                                          int& neededArgGPRs,
+		                                          int& neededArgFPRs) const {
+			field1Type = VoidTy;
+			field2Type = VoidTy;
+			neededArgGPRs = 0;
+			neededArgFPRs = 0;
+			
+			if (!detectFPCCEligibleStructHelper(type, DataSize::Bytes(0),
+			                                    field1Type, field1Offset,
+			                                    field2Type, field2Offset)) {
+				return false;
+			}
+			
+			// Not really a candidate if we have a single int but no
+			// float.
+			if (!field1Type.isFloatingPoint() && field2Type.isVoid()) {
+				return false;
+			}
+			
+			if (field1Type.isFloatingPoint()) {
+				neededArgFPRs++;
+			} else {
+				neededArgGPRs++;
+			}
+			
+			if (field2Type.isFloatingPoint()) {
+				neededArgFPRs++;
+			} else if (!field2Type.isVoid()) {
+				neededArgGPRs++;
+			}
+			
+			return true;
+		}
+		
+		ArgInfo
+		RISCVClassifier::coerceFPCCEligibleStruct(const Type field1Type,
+		                                          const DataSize field1Offset,
+		                                          const Type field2Type,
+		                                          const DataSize field2Offset) const {
+			const auto& typeBuilder = typeLayout_.typeBuilder();
+			
+			const auto field1Size = typeLayout_.getTypeStoreSize(field1Type);
+			const auto field2Align = field2Type.isVoid() ? DataSize::Bytes(1) :
+			                         typeLayout_.getTypeRequiredAlign(field2Type);
+			
+			if (field1Offset.asBytes() == 0) {
+				if (field2Type.isVoid()) {
+					return ArgInfo::getDirect(field1Type);
+				}
+				
+				if (field2Offset == field1Size.roundUpToAlign(field2Align)) {
+					// The struct is flattened so that each field is
+					// passed as a separate argument.
+					const auto coerceType = typeBuilder.getStructTy({ field1Type,
+					                                                 field2Type });
+					return ArgInfo::getDirect(coerceType, /*offset=*/0,
+					                          /*padding=*/VoidTy,
+					                          /*canBeFlattened=*/true);
+				}
+			}
+			
+			// There's padding before or between the fields (e.g. from
+			// a zero-length array), so coerce to a struct with explicit
+			// padding that keeps the fields at their offsets; only the
+			// fields themselves are passed.
+			llvm::SmallVector<Type, 4> coerceTypes;
+			llvm::SmallVector<Type, 2> unpaddedTypes;
+			
+			if (field1Offset.asBytes() != 0) {
+				coerceTypes.push_back(typeBuilder.getArrayTy(field1Offset.asBytes(),
+				                                             Int8Ty));
+			}
+			
+			coerceTypes.push_back(field1Type);
+			unpaddedTypes.push_back(field1Type);
+			
+			if (field2Type.isVoid()) {
+				return ArgInfo::getCoerceAndExpand(typeBuilder.getStructTy(coerceTypes),
+				                                   field1Type);
+			}
+			
+			const auto field2OffsetNoPadding = (field1Offset + field1Size).roundUpToAlign(field2Align);
+			if (field2Offset > field2OffsetNoPadding) {
+				const auto padding = field2Offset - field2OffsetNoPadding;
+				coerceTypes.push_back(typeBuilder.getArrayTy(padding.asBytes(),
+				                                             Int8Ty));
+			}
+			
+			coerceTypes.push_back(field2Type);
+			unpaddedTypes.push_back(field2Type);
+			
+			return ArgInfo::getCoerceAndExpand(typeBuilder.getStructTy(coerceTypes),
+			                                   typeBuilder.getStructTy(unpaddedTypes));
+		}
+		
+		ArgInfo RISCVClassifier::extendType(const Type type) const {
+			// RV64 requires unsigned 32-bit integers to be sign
+			// extended.
+			if (xLen_ == 64 &&
+			    typeLayout_.getTypeAllocSize(type).asBits() == 32 &&
+			    type.hasUnsignedIntegerRepresentation(typeLayout_)) {
+				return ArgInfo::getExtend(Int32Ty);
+			}
+			return ArgInfo::getExtend(type);
+		}
+		
+		ArgInfo RISCVClassifier::classifyReturnType(const Type returnType) const {
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			// The rules for return and argument types are the same,
+			// using the two return registers of each kind.
+			int argGPRsLeft = 2;
+			int argFPRsLeft = fLen_ != 0 ? 2 : 0;
+			
+			return classifyArgumentType(returnType,
+			                            /*isFixed=*/true,
+			                            argGPRsLeft,
+			                            argFPRsLeft,
+			                            /*isReturnType=*/true);
+		}
+		
+		ArgInfo RISCVClassifier::classifyArgumentType(const Type argumentType,
+		                                              const bool isFixed,
+		                                              int& argGPRsLeft,
+		                                              int& argFPRsLeft,
+		                                              const bool isReturnType) const {
+			// Ignore empty structs/unions.
+			if (argumentType.isEmptyRecord(/*allowArrays=*/true)) {
+				return ArgInfo::getIgnore();
+			}
+			
+			const auto size = typeLayout_.getTypeAllocSize(argumentType);
+			
+			// Pass floating point values via FPRs if possible.
+			if (isFixed && argumentType.isFloatingPoint() &&
+			    fLen_ >= size.asBits() && argFPRsLeft > 0) {
+				argFPRsLeft--;
+				return ArgInfo::getDirect(argumentType);
+			}
+			
+			// Complex types for the hard float ABI are passed in a
+			// pair of FPRs.
+			if (isFixed && argumentType.isComplex() && fLen_ != 0 &&
+			    argFPRsLeft >= 2) {
+				const auto elementType = argumentType.complexFloatingPointType();
+				if (typeLayout_.getTypeAllocSize(elementType).asBits() <= fLen_) {
+					argFPRsLeft -= 2;
+					return ArgInfo::getDirect(argumentType);
+				}
+			}
+			
+			if (isFixed && fLen_ != 0 && argumentType.isStruct()) {
+				Type field1Type = VoidTy;
+				Type field2Type = VoidTy;
+				DataSize field1Offset = DataSize::Bytes(0);
+				DataSize field2Offset = DataSize::Bytes(0);
+				int neededArgGPRs = 0;
+				int neededArgFPRs = 0;
+				const bool isCandidate =
+					detectFPCCEligibleStruct(argumentType,
+					                         field1Type, field1Offset,
+					                         field2Type, field2Offset,
+					                         neededArgGPRs, neededArgFPRs);
+				if (isCandidate && neededArgGPRs <= argGPRsLeft &&
+				    neededArgFPRs <= argFPRsLeft) {
+					argGPRsLeft -= neededArgGPRs;
+					argFPRsLeft -= neededArgFPRs;
+					return coerceFPCCEligibleStruct(field1Type, field1Offset,
+					                                field2Type, field2Offset);
+				}
+			}
+			
+			const auto neededAlign = typeLayout_.getTypeRequiredAlign(argumentType);
+			
+			// Determine the number of GPRs needed to pass the current
+			// argument. 2*XLen-aligned varargs are passed in "aligned"
+			// register pairs, so may consume 3 registers.
+			bool mustUseStack = false;
+			int neededArgGPRs = 1;
+			if (!isFixed && neededAlign.asBits() == 2 * xLen_) {
+				neededArgGPRs = 2 + (argGPRsLeft % 2);
+			} else if (size.asBits() > xLen_ && size.asBits() <= 2 * xLen_) {
+				neededArgGPRs = 2;
+			}
+			
+			if (neededArgGPRs > argGPRsLeft) {
+				mustUseStack = true;
+				neededArgGPRs = argGPRsLeft;
+			}
+			
+			argGPRsLeft -= neededArgGPRs;
+			
+			if (!isAggregateTypeForABI(argumentType) && !argumentType.isVector()) {
+				// All integral types are promoted to XLen width, unless
+				// passed on the stack.
+				if (size.asBits() < xLen_ && argumentType.isInteger() &&
+				    !mustUseStack) {
+					return extendType(argumentType);
+				}
+				
+				return ArgInfo::getDirect(argumentType);
+			}
+			
+			// Aggregates which are <= 2*XLen will be passed in
+			// registers if possible, so coerce to integers.
+			if (size.asBits() <= 2 * xLen_) {
+				const auto xLenType = Type::FixedWidthInteger(DataSize::Bits(xLen_),
+				                                              /*isSigned=*/false);
+				
+				// Use a single XLen int if possible, 2*XLen if 2*XLen
+				// alignment is required, and a 2-element XLen array if
+				// only XLen alignment is required.
+				if (size.asBits() <= xLen_) {
+					return ArgInfo::getDirect(xLenType);
+				} else if (neededAlign.asBits() == 2 * xLen_) {
+					return ArgInfo::getDirect(Type::FixedWidthInteger(DataSize::Bits(2 * xLen_),
+					                                                  /*isSigned=*/false));
+				} else {
+					return ArgInfo::getDirect(typeLayout_.typeBuilder().getArrayTy(2, xLenType));
+				}
+			}
+			
+			return getNaturalAlignIndirect(argumentType, isReturnType);
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		RISCVClassifier::classifyFunctionType(const FunctionType& functionType,
+		                                      llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			const auto returnType = functionType.returnType();
+			argInfoArray.push_back(classifyReturnType(returnType));
+			
+			// A scalar return value larger than 2*XLen (e.g. 'long
+			// double' on RV32) is passed directly in the IR, but the
+			// backend returns it via a hidden pointer argument.
+			bool isReturnIndirect = argInfoArray[0].isIndirect();
+			if (!isReturnIndirect && !returnType.isVoid() &&
+			    !returnType.isAggregateType() &&
+			    typeLayout_.getTypeAllocSize(returnType).asBits() > 2 * xLen_) {
+				if (returnType.isComplex() && fLen_ != 0) {
+					const auto elementType = returnType.complexFloatingPointType();
+					isReturnIndirect = typeLayout_.getTypeAllocSize(elementType).asBits() > fLen_;
+				} else {
+					isReturnIndirect = true;
+				}
+			}
+			
+			// Integer scalars passed in registers are sign/zero
+			// extended, but not those passed on the stack, so track
+			// register usage. Variadic arguments are never passed in
+			// FPRs.
+			int argGPRsLeft = isReturnIndirect ? NumArgGPRs - 1 : NumArgGPRs;
+			int argFPRsLeft = fLen_ != 0 ? NumArgFPRs : 0;
+			const auto numFixedArgs = functionType.argumentTypes().size();
+			
+			for (size_t i = 0; i < argumentTypes.size(); i++) {
+				const bool isFixed = i < numFixedArgs;
+				argInfoArray.push_back(classifyArgumentType(argumentTypes[i],
+				                                            isFixed,
+				                                            argGPRsLeft,
+				                                            argFPRsLeft));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
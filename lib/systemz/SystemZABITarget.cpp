@@ -0,0 +1,75 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/systemz/SystemZABITarget.hpp>
+#include <llvm-abi/systemz/SystemZABITypeLayout.hpp>
+#include <llvm-abi/systemz/SystemZClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace systemz {
+		
+		static bool cpuHasVector(const std::string& cpuName) {
+			// The vector facility was introduced with z13.
+			return cpuName == "z13" || cpuName == "arch11" ||
+			       cpuName == "z14" || cpuName == "arch12" ||
+			       cpuName == "z15" || cpuName == "arch13";
+		}
+		
+		SystemZABITarget::SystemZABITarget(const llvm::Triple& targetTriple,
+		                                   const std::string& cpuName)
+		: ABITarget(targetTriple),
+		typeLayout_(cpuHasVector(cpuName), &(cache())) { }
+		
+		SystemZABITarget::~SystemZABITarget() { }
+		
+		bool SystemZABITarget::hasVector() const {
+			return typeLayout_.hasVector();
+		}
+		
+		std::string SystemZABITarget::name() const {
+			return "SystemZ";
+		}
+		
+		llvm::Type* SystemZABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getFP128Ty(llvmContext);
+		}
+		
+		const SystemZABITypeLayout& SystemZABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		SystemZABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                           llvm::ArrayRef<Type> argumentTypes) const {
+			SystemZClassifier classifier(typeLayout_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		SystemZABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// R2-R6 and F0, F2, F4 and F6.
+			return ABIRegisterFile(/*intRegisters=*/5,
+			                       /*fpRegisters=*/4,
+			                       DataSize::Bytes(8));
+		}
+		
+	}
+	
+}
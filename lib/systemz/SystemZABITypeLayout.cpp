@@ -0,0 +1,157 @@
+#include <algorithm>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/systemz/SystemZABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace systemz {
+		
+		SystemZABITypeLayout::SystemZABITypeLayout(const bool hasVector,
+		                                           const ABICache* const cache)
+		: hasVector_(hasVector),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		bool SystemZABITypeLayout::hasVector() const {
+			return hasVector_;
+		}
+		
+		const TypeBuilder& SystemZABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize SystemZABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize SystemZABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize SystemZABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize SystemZABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize SystemZABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		SystemZABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool SystemZABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// The vector ABI passes vectors of up to 16 bytes in
+			// vector registers.
+			return hasVector() && getTypeAllocSize(type).asBits() <= 128;
+		}
+		
+		bool SystemZABITypeLayout::isBigEndian() const {
+			return true;
+		}
+		
+		bool SystemZABITypeLayout::isCharSigned() const {
+			return false;
+		}
+		
+		DataSize SystemZABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(8);
+		}
+		
+		DataSize SystemZABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize SystemZABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize SystemZABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize SystemZABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize SystemZABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			// 128-bit floating point types are only 8-byte aligned.
+			return std::min<DataSize>(getFloatSize(kind), DataSize::Bytes(8));
+		}
+		
+		DataSize SystemZABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize SystemZABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize SystemZABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize SystemZABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned, except that the vector
+			// ABI caps their alignment at 8 bytes.
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			const auto naturalAlign = std::max<DataSize>(elementAlign, vectorAlign);
+			return hasVector() ?
+				std::min<DataSize>(naturalAlign, DataSize::Bytes(8)) :
+				naturalAlign;
+		}
+		
+	}
+	
+}
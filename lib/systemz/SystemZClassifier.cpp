@@ -0,0 +1,163 @@
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/systemz/SystemZABITypeLayout.hpp>
+#include <llvm-abi/systemz/SystemZClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace systemz {
+		
+		static bool isPromotableIntegerType(const Type type) {
+			// 32-bit values must also be extended to the full
+			// register width.
+			return type.isPromotableIntegerType() ||
+			       type == IntTy ||
+			       type == UIntTy;
+		}
+		
+		static bool isCompoundType(const Type type) {
+			return type.isComplex() ||
+			       type.isVector() ||
+			       type.isAggregateType();
+		}
+		
+		static bool isFPArgumentType(const Type type) {
+			return type.isFloat() || type.isDouble();
+		}
+		
+		/**
+		 * \brief Get the single element of a struct.
+		 * 
+		 * Unlike Type::getStructSingleElement(), empty struct and
+		 * array fields count as elements, arrays are never
+		 * unwrapped and trailing padding is allowed (so an 8-byte
+		 * aligned 'struct { float f; }' is passed as a double).
+		 * 
+		 * \return The single element's type, or the type itself
+		 *         if it isn't a single element struct.
+		 */
+		static Type getSingleElementType(const Type type) {
+			if (!type.isStruct() || type.structMembers().size() != 1) {
+				return type;
+			}
+			
+			return getSingleElementType(type.structMembers().front().type());
+		}
+		
+		SystemZClassifier::SystemZClassifier(const SystemZABITypeLayout& typeLayout)
+		: typeLayout_(typeLayout) { }
+		
+		bool SystemZClassifier::isVectorArgumentType(const Type type) const {
+			return type.isVector() && typeLayout_.isLegalVectorType(type);
+		}
+		
+		ArgInfo SystemZClassifier::getNaturalAlignIndirect(const Type type,
+		                                                   const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer (in R2); the
+				// alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			// The caller makes a copy and passes a pointer to it.
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+		}
+		
+		ArgInfo SystemZClassifier::classifyReturnType(const Type returnType) const {
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			if (isVectorArgumentType(returnType)) {
+				return ArgInfo::getDirect(returnType);
+			}
+			
+			if (isCompoundType(returnType) ||
+			    typeLayout_.getTypeAllocSize(returnType).asBits() > 64) {
+				return getNaturalAlignIndirect(returnType,
+				                               /*isReturnType=*/true);
+			}
+			
+			return isPromotableIntegerType(returnType) ?
+				ArgInfo::getExtend(returnType) :
+				ArgInfo::getDirect(returnType);
+		}
+		
+		ArgInfo SystemZClassifier::classifyArgumentType(const Type argumentType) const {
+			// Integers are extended to full register width.
+			if (isPromotableIntegerType(argumentType)) {
+				return ArgInfo::getExtend(argumentType);
+			}
+			
+			// Handle vector types and vector-like structure types.
+			// As opposed to float-like structure types, no padding
+			// is allowed for vector-like structures, so the sizes
+			// must match.
+			const auto size = typeLayout_.getTypeAllocSize(argumentType);
+			const auto singleElementType = getSingleElementType(argumentType);
+			if (isVectorArgumentType(singleElementType) &&
+			    typeLayout_.getTypeAllocSize(singleElementType) == size) {
+				return ArgInfo::getDirect(singleElementType);
+			}
+			
+			// Values that are not 1, 2, 4 or 8 bytes in size are
+			// passed indirectly.
+			if (size.asBits() != 8 && size.asBits() != 16 &&
+			    size.asBits() != 32 && size.asBits() != 64) {
+				return getNaturalAlignIndirect(argumentType);
+			}
+			
+			// Handle small structures.
+			if (argumentType.isRecordType()) {
+				// Structures with flexible arrays have variable
+				// length, so really fail the size test above.
+				if (argumentType.hasFlexibleArrayMember()) {
+					return getNaturalAlignIndirect(argumentType);
+				}
+				
+				// The structure is passed right-justified in a
+				// GPR as an unextended integer, or in an FPR as a
+				// float or double.
+				if (isFPArgumentType(singleElementType)) {
+					return ArgInfo::getDirect(size.asBits() == 32 ? FloatTy : DoubleTy);
+				}
+				
+				return ArgInfo::getDirect(Type::FixedWidthInteger(size,
+				                                                  /*isSigned=*/false));
+			}
+			
+			// Non-structure compounds are passed indirectly.
+			if (isCompoundType(argumentType)) {
+				return getNaturalAlignIndirect(argumentType);
+			}
+			
+			return ArgInfo::getDirect(argumentType);
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		SystemZClassifier::classifyFunctionType(const FunctionType& functionType,
+		                                        llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			argInfoArray.push_back(classifyReturnType(functionType.returnType()));
+			
+			// Variadic arguments are classified like any other.
+			for (const auto& argumentType: argumentTypes) {
+				argInfoArray.push_back(classifyArgumentType(argumentType));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
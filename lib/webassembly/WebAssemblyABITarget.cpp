@@ -0,0 +1,87 @@
+#include <climits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/webassembly/WebAssemblyABITarget.hpp>
+#include <llvm-abi/webassembly/WebAssemblyABITypeLayout.hpp>
+#include <llvm-abi/webassembly/WebAssemblyClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace webassembly {
+		
+		static WebAssemblyABIKind getABIKind(const llvm::Triple& targetTriple,
+		                                     const std::string& abiName) {
+			if (abiName.empty() || abiName == "mvp") {
+				return MVP;
+			} else if (abiName == "experimental-mv") {
+				return ExperimentalMV;
+			}
+			
+			std::string errorString = "Invalid WebAssembly ABI name '";
+			errorString += abiName;
+			errorString += "' for triple: ";
+			errorString += targetTriple.str();
+			throw std::runtime_error(errorString);
+		}
+		
+		WebAssemblyABITarget::WebAssemblyABITarget(const llvm::Triple& targetTriple,
+		                                           const std::string& abiName)
+		: ABITarget(targetTriple),
+		abiKind_(getABIKind(targetTriple, abiName)),
+		typeLayout_(targetTriple, &(cache())) { }
+		
+		WebAssemblyABITarget::~WebAssemblyABITarget() { }
+		
+		WebAssemblyABIKind WebAssemblyABITarget::abiKind() const {
+			return abiKind_;
+		}
+		
+		std::string WebAssemblyABITarget::name() const {
+			return "WebAssembly";
+		}
+		
+		llvm::Type* WebAssemblyABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getFP128Ty(llvmContext);
+		}
+		
+		const WebAssemblyABITypeLayout& WebAssemblyABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		WebAssemblyABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                               llvm::ArrayRef<Type> argumentTypes) const {
+			WebAssemblyClassifier classifier(typeLayout_, abiKind_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		WebAssemblyABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// Arguments are locals of the callee, so they're
+			// never passed on a stack.
+			return ABIRegisterFile(/*intRegisters=*/UINT_MAX,
+			                       /*fpRegisters=*/UINT_MAX,
+			                       DataSize::Bytes(targetTriple().isArch64Bit() ? 8 : 4));
+		}
+		
+	}
+	
+}
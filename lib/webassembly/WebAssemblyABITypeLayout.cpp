@@ -0,0 +1,150 @@
+#include <algorithm>
+
+#include <llvm/ADT/Triple.h>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/webassembly/WebAssemblyABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace webassembly {
+		
+		WebAssemblyABITypeLayout::WebAssemblyABITypeLayout(const llvm::Triple& targetTriple,
+		                                                   const ABICache* const cache)
+		: is64Bit_(targetTriple.isArch64Bit()),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		const TypeBuilder& WebAssemblyABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		WebAssemblyABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool WebAssemblyABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			// SIMD128 provides a single 128-bit vector type.
+			return getTypeAllocSize(type).asBits() == 128;
+		}
+		
+		bool WebAssemblyABITypeLayout::isBigEndian() const {
+			return false;
+		}
+		
+		bool WebAssemblyABITypeLayout::isCharSigned() const {
+			return true;
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(is64Bit_ ? 8 : 4);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+					return getPointerSize();
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					return DataSize::Bytes(2);
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return getFloatSize(kind);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize WebAssemblyABITypeLayout::getVectorAlign(const Type type) const {
+			// Vectors are naturally aligned.
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto vectorAlign = getTypeAllocSize(type).roundUpToPowerOf2Bytes();
+			return std::max<DataSize>(elementAlign, vectorAlign);
+		}
+		
+	}
+	
+}
@@ -0,0 +1,130 @@
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/webassembly/WebAssemblyABITypeLayout.hpp>
+#include <llvm-abi/webassembly/WebAssemblyClassifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace webassembly {
+		
+		static bool isAggregateTypeForABI(const Type type) {
+			return type.isAggregateType() || type.isComplex();
+		}
+		
+		static bool canExpand(const Type type) {
+			if (!type.isRecordType() || type.hasFlexibleArrayMember()) {
+				return false;
+			}
+			
+			for (const auto& member: type.recordMembers()) {
+				if (member.isBitField()) {
+					return false;
+				}
+			}
+			return true;
+		}
+		
+		WebAssemblyClassifier::WebAssemblyClassifier(const WebAssemblyABITypeLayout& typeLayout,
+		                                             const WebAssemblyABIKind abiKind)
+		: typeLayout_(typeLayout), abiKind_(abiKind) { }
+		
+		ArgInfo WebAssemblyClassifier::getNaturalAlignIndirect(const Type type,
+		                                                       const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer into linear
+				// memory; the alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/true);
+		}
+		
+		ArgInfo WebAssemblyClassifier::classifyReturnType(const Type returnType) const {
+			if (returnType.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			if (isAggregateTypeForABI(returnType)) {
+				// Ignore empty structs/unions.
+				if (returnType.isEmptyRecord(/*allowArrays=*/true)) {
+					return ArgInfo::getIgnore();
+				}
+				
+				// Lower single-element structs to just return a
+				// regular value.
+				const auto singleElementType = returnType.getStructSingleElement(typeLayout_);
+				if (!singleElementType.isVoid()) {
+					return ArgInfo::getDirect(singleElementType);
+				}
+				
+				// The multivalue ABI returns all other aggregates
+				// as multiple values, which avoids a store to and
+				// a load from linear memory.
+				if (abiKind_ == ExperimentalMV && returnType.isRecordType()) {
+					return ArgInfo::getDirect(returnType);
+				}
+				
+				return getNaturalAlignIndirect(returnType,
+				                               /*isReturnType=*/true);
+			}
+			
+			return returnType.isPromotableIntegerType() ?
+				ArgInfo::getExtend(returnType) :
+				ArgInfo::getDirect(returnType);
+		}
+		
+		ArgInfo WebAssemblyClassifier::classifyArgumentType(const Type argumentType) const {
+			if (isAggregateTypeForABI(argumentType)) {
+				// Ignore empty structs/unions.
+				if (argumentType.isEmptyRecord(/*allowArrays=*/true)) {
+					return ArgInfo::getIgnore();
+				}
+				
+				// Lower single-element structs to just pass a
+				// regular value.
+				const auto singleElementType = argumentType.getStructSingleElement(typeLayout_);
+				if (!singleElementType.isVoid()) {
+					return ArgInfo::getDirect(singleElementType);
+				}
+				
+				// The multivalue ABI fully expands all other
+				// records, unless they contain bit-fields.
+				if (abiKind_ == ExperimentalMV && canExpand(argumentType)) {
+					return ArgInfo::getExpand(argumentType);
+				}
+				
+				return getNaturalAlignIndirect(argumentType);
+			}
+			
+			return argumentType.isPromotableIntegerType() ?
+				ArgInfo::getExtend(argumentType) :
+				ArgInfo::getDirect(argumentType);
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		WebAssemblyClassifier::classifyFunctionType(const FunctionType& functionType,
+		                                            llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			argInfoArray.push_back(classifyReturnType(functionType.returnType()));
+			
+			// Variadic arguments are classified like any other.
+			for (const auto& argumentType: argumentTypes) {
+				argInfoArray.push_back(classifyArgumentType(argumentType));
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
@@ -1,8 +1,9 @@
-#include <set>
-#include <string>
+#include <cstddef>
 
-#include <llvm/ADT/StringSwitch.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/Triple.h>
+#include <llvm/Support/Host.h>
 
 #include <llvm-abi/x86/CPUFeatures.hpp>
 #include <llvm-abi/x86/CPUKind.hpp>
@@ -11,226 +12,203 @@ namespace llvm_abi {
 	
 	namespace x86 {
 		
-		CPUFeatures::CPUFeatures()
-		: sseLevel_(NoSSE) { }
+		static const char* const FEATURE_NAMES[] = {
+#define X86_FEATURE(ENUM, NAME) NAME,
+#include <llvm-abi/x86/CPUFeatures.def>
+		};
 		
-		void CPUFeatures::add(const std::string& feature) {
-			(void) features_.insert(feature);
+		static_assert(sizeof(FEATURE_NAMES) / sizeof(FEATURE_NAMES[0]) == FEATURE_COUNT,
+		              "Feature name table doesn't match CPUFeature.");
+		
+		static CPUFeature getFeatureFromName(const llvm::StringRef name) {
+			// Legacy alias.
+			if (name == "sse4") {
+				return FEATURE_SSE42;
+			}
+			
+			for (size_t i = 0; i < FEATURE_COUNT; i++) {
+				if (name == FEATURE_NAMES[i]) {
+					return static_cast<CPUFeature>(i);
+				}
+			}
 			
-			const auto level = llvm::StringSwitch<SSELevel>(feature)
-				.Case("avx512f", AVX512F)
-				.Case("avx512cd", AVX512F)
-				.Case("avx512er", AVX512F)
-				.Case("avx512pf", AVX512F)
-				.Case("avx512dq", AVX512F)
-				.Case("avx512bw", AVX512F)
-				.Case("avx512vl", AVX512F)
-				.Case("avx2", AVX2)
-				.Case("fma", AVX)
-				.Case("avx", AVX)
-				.Case("sse4", SSE42)
-				.Case("sse4.2", SSE42)
-				.Case("sse4.1", SSE41)
-				.Case("ssse3", SSSE3)
-				.Case("sse3", SSE3)
-				.Case("aes", SSE2)
-				.Case("pclmul", SSE2)
-				.Case("sse2", SSE2)
-				.Case("sse", SSE1)
-				.Default(NoSSE);
-			sseLevel_ = std::max(sseLevel_, level);
+			return FEATURE_COUNT;
+		}
+		
+		constexpr CPUFeatureMask makeFeatureMask() {
+			return 0;
+		}
+		
+		template <typename... Features>
+		constexpr CPUFeatureMask makeFeatureMask(const CPUFeature feature,
+		                                         const Features... features) {
+			return getFeatureMask(feature) | makeFeatureMask(features...);
+		}
+		
+		struct CPUFeatureTableEntry {
+			CPUKind kind;
+			CPUKind base;
+			CPUFeatureMask features;
+		};
+		
+		static constexpr CPUFeatureTableEntry CPU_FEATURE_TABLE[] = {
+#define X86_CPU(KIND, BASE, FEATURES) { KIND, BASE, makeFeatureMask FEATURES },
+#include <llvm-abi/x86/CPUFeatures.def>
+		};
+		
+		static constexpr size_t CPU_FEATURE_TABLE_SIZE =
+			sizeof(CPU_FEATURE_TABLE) / sizeof(CPU_FEATURE_TABLE[0]);
+		
+		constexpr bool isCPUFeatureTableOrdered(const size_t index) {
+			return index == CPU_FEATURE_TABLE_SIZE ||
+			       (CPU_FEATURE_TABLE[index].kind == static_cast<CPUKind>(index) &&
+			        isCPUFeatureTableOrdered(index + 1));
+		}
+		
+		static_assert(CPU_FEATURE_TABLE_SIZE == CK_Geode + 1,
+		              "CPU feature table doesn't cover every CPUKind.");
+		static_assert(isCPUFeatureTableOrdered(0),
+		              "CPU feature table isn't in CPUKind order.");
+		
+		/**
+		 * \brief Get the features of a CPU, including those of its base.
+		 */
+		constexpr CPUFeatureMask getCPUFeatureMask(const CPUKind cpu) {
+			return CPU_FEATURE_TABLE[cpu].features |
+			       (CPU_FEATURE_TABLE[cpu].base != cpu ?
+			        getCPUFeatureMask(CPU_FEATURE_TABLE[cpu].base) : 0);
+		}
+		
+		static_assert((getCPUFeatureMask(CK_SkylakeServer) &
+		               getFeatureMask(FEATURE_AVX)) != 0,
+		              "Skylake Server should inherit AVX from Sandy Bridge.");
+		
+		void CPUFeatures::add(const CPUFeature feature) {
+			features_ |= getFeatureMask(feature);
+		}
+		
+		void CPUFeatures::add(const llvm::StringRef feature) {
+			const auto featureValue = getFeatureFromName(feature);
+			if (featureValue != FEATURE_COUNT) {
+				add(featureValue);
+			}
+		}
+		
+		bool CPUFeatures::hasFeature(const CPUFeature feature) const {
+			return (features_ & getFeatureMask(feature)) != 0;
+		}
+		
+		bool CPUFeatures::hasFeature(const llvm::StringRef feature) const {
+			const auto featureValue = getFeatureFromName(feature);
+			return featureValue != FEATURE_COUNT && hasFeature(featureValue);
 		}
 		
 		bool CPUFeatures::hasAVX() const {
 			return sseLevel() >= AVX;
 		}
 		
+		bool CPUFeatures::hasAVX512F() const {
+			return sseLevel() >= AVX512F;
+		}
+		
 		SSELevel CPUFeatures::sseLevel() const {
-			return sseLevel_;
+			// Every AVX-512 extension implies AVX-512 Foundation.
+			const auto avx512Mask = makeFeatureMask(FEATURE_AVX512F,
+			                                        FEATURE_AVX512CD,
+			                                        FEATURE_AVX512ER,
+			                                        FEATURE_AVX512PF,
+			                                        FEATURE_AVX512DQ,
+			                                        FEATURE_AVX512BW,
+			                                        FEATURE_AVX512VL);
+			if ((features_ & avx512Mask) != 0) {
+				return AVX512F;
+			} else if (hasFeature(FEATURE_AVX2)) {
+				return AVX2;
+			} else if (hasFeature(FEATURE_AVX) || hasFeature(FEATURE_FMA)) {
+				return AVX;
+			} else if (hasFeature(FEATURE_SSE42)) {
+				return SSE42;
+			} else if (hasFeature(FEATURE_SSE41)) {
+				return SSE41;
+			} else if (hasFeature(FEATURE_SSSE3)) {
+				return SSSE3;
+			} else if (hasFeature(FEATURE_SSE3)) {
+				return SSE3;
+			} else if (hasFeature(FEATURE_SSE2) || hasFeature(FEATURE_AES) ||
+			           hasFeature(FEATURE_PCLMUL)) {
+				return SSE2;
+			} else if (hasFeature(FEATURE_SSE)) {
+				return SSE1;
+			} else {
+				return NoSSE;
+			}
 		}
 		
-		CPUFeatures getCPUFeatures(const llvm::Triple& targetTriple,
-		                           const CPUKind cpu) {
+		CPUFeatureMask CPUFeatures::mask() const {
+			return features_;
+		}
+		
+		static CPUFeatures computeHostCPUFeatures(const llvm::Triple& targetTriple) {
 			CPUFeatures features;
 			
 			// X86_64 always has SSE2.
 			if (targetTriple.getArch() == llvm::Triple::x86_64) {
-				features.add("sse2");
+				features.add(FEATURE_SSE2);
+			}
+			
+			llvm::StringMap<bool> hostFeatures;
+			if (!llvm::sys::getHostCPUFeatures(hostFeatures)) {
+				// Host features unavailable; fall back to the kind
+				// derived from the host CPU name.
+				return getCPUFeatures(targetTriple,
+				                      getCPUKind(targetTriple, "native"));
 			}
 			
-			switch (cpu) {
-				case CK_Generic:
-				case CK_i386:
-				case CK_i486:
-				case CK_i586:
-				case CK_Pentium:
-				case CK_i686:
-				case CK_PentiumPro:
-					break;
-				case CK_PentiumMMX:
-				case CK_Pentium2:
-				case CK_K6:
-				case CK_WinChipC6:
-					features.add("mmx");
-					break;
-				case CK_Pentium3:
-				case CK_Pentium3M:
-				case CK_C3_2:
-					features.add("sse");
-					break;
-				case CK_PentiumM:
-				case CK_Pentium4:
-				case CK_Pentium4M:
-				case CK_x86_64:
-					features.add("sse2");
-					break;
-				case CK_Yonah:
-				case CK_Prescott:
-				case CK_Nocona:
-					features.add("sse3");
-					features.add("cx16");
-					break;
-				case CK_Core2:
-				case CK_Bonnell:
-					features.add("ssse3");
-					features.add("cx16");
-					break;
-				case CK_Penryn:
-					features.add("sse4.1");
-					features.add("cx16");
-					break;
-				case CK_Skylake:
-					features.add("avx512f");
-					features.add("avx512cd");
-					features.add("avx512dq");
-					features.add("avx512bw");
-					features.add("avx512vl");
-					// FALLTHROUGH
-				case CK_Broadwell:
-					features.add("rdseed");
-					features.add("adx");
-					// FALLTHROUGH
-				case CK_Haswell:
-					features.add("avx2");
-					features.add("lzcnt");
-					features.add("bmi");
-					features.add("bmi2");
-					features.add("rtm");
-					features.add("fma");
-					// FALLTHROUGH
-				case CK_IvyBridge:
-					features.add("rdrnd");
-					features.add("f16c");
-					features.add("fsgsbase");
-					// FALLTHROUGH
-				case CK_SandyBridge:
-					features.add("avx");
-					// FALLTHROUGH
-				case CK_Westmere:
-				case CK_Silvermont:
-					features.add("aes");
-					features.add("pclmul");
-					// FALLTHROUGH
-				case CK_Nehalem:
-					features.add("sse4.2");
-					features.add("cx16");
-					break;
-				case CK_KNL:
-					features.add("avx512f");
-					features.add("avx512cd");
-					features.add("avx512er");
-					features.add("avx512pf");
-					features.add("rdseed");
-					features.add("adx");
-					features.add("lzcnt");
-					features.add("bmi");
-					features.add("bmi2");
-					features.add("rtm");
-					features.add("fma");
-					features.add("rdrnd");
-					features.add("f16c");
-					features.add("fsgsbase");
-					features.add("aes");
-					features.add("pclmul");
-					features.add("cx16");
-					break;
-				case CK_K6_2:
-				case CK_K6_3:
-				case CK_WinChip2:
-				case CK_C3:
-					features.add("3dnow");
-					break;
-				case CK_Athlon:
-				case CK_AthlonThunderbird:
-				case CK_Geode:
-					features.add("3dnowa");
-					break;
-				case CK_Athlon4:
-				case CK_AthlonXP:
-				case CK_AthlonMP:
-					features.add("sse");
-					features.add("3dnowa");
-					break;
-				case CK_K8:
-				case CK_Opteron:
-				case CK_Athlon64:
-				case CK_AthlonFX:
-					features.add("sse2");
-					features.add("3dnowa");
-					break;
-				case CK_AMDFAM10:
-					features.add("sse4a");
-					features.add("lzcnt");
-					features.add("popcnt");
-					// FALLTHROUGH
-				case CK_K8SSE3:
-				case CK_OpteronSSE3:
-				case CK_Athlon64SSE3:
-					features.add("sse3");
-					features.add("3dnowa");
-					break;
-				case CK_BTVER2:
-					features.add("avx");
-					features.add("aes");
-					features.add("pclmul");
-					features.add("bmi");
-					features.add("f16c");
-					// FALLTHROUGH
-				case CK_BTVER1:
-					features.add("ssse3");
-					features.add("sse4a");
-					features.add("lzcnt");
-					features.add("popcnt");
-					features.add("prfchw");
-					features.add("cx16");
-					break;
-				case CK_BDVER4:
-					features.add("avx2");
-					features.add("bmi2");
-					// FALLTHROUGH
-				case CK_BDVER3:
-					features.add("fsgsbase");
-					// FALLTHROUGH
-				case CK_BDVER2:
-					features.add("bmi");
-					features.add("fma");
-					features.add("f16c");
-					features.add("tbm");
-					// FALLTHROUGH
-				case CK_BDVER1:
-					// xop implies avx, sse4a and fma4.
-					features.add("xop");
-					features.add("lzcnt");
-					features.add("aes");
-					features.add("pclmul");
-					features.add("prfchw");
-					features.add("cx16");
-					break;
+			for (const auto& entry: hostFeatures) {
+				if (entry.getValue()) {
+					features.add(entry.getKey());
+				}
 			}
 			
 			return features;
 		}
 		
+		CPUFeatures getHostCPUFeatures(const llvm::Triple& targetTriple) {
+			// Host detection is relatively expensive, so compute the
+			// features once per process for each architecture.
+			if (targetTriple.getArch() == llvm::Triple::x86_64) {
+				static const CPUFeatures hostFeatures64 =
+					computeHostCPUFeatures(targetTriple);
+				return hostFeatures64;
+			} else {
+				static const CPUFeatures hostFeatures32 =
+					computeHostCPUFeatures(targetTriple);
+				return hostFeatures32;
+			}
+		}
+		
+		CPUFeatures getCPUFeatures(const llvm::Triple& targetTriple,
+		                           const std::string& cpuName,
+		                           const CPUKind cpu) {
+			if (isNativeCPUName(cpuName) && canUseHostCPU(targetTriple)) {
+				return getHostCPUFeatures(targetTriple);
+			}
+			
+			return getCPUFeatures(targetTriple, cpu);
+		}
+		
+		CPUFeatures getCPUFeatures(const llvm::Triple& targetTriple,
+		                           const CPUKind cpu) {
+			auto features = getCPUFeatureMask(cpu);
+			
+			// X86_64 always has SSE2.
+			if (targetTriple.getArch() == llvm::Triple::x86_64) {
+				features |= getFeatureMask(FEATURE_SSE2);
+			}
+			
+			return CPUFeatures(features);
+		}
+		
 	}
 	
 }
@@ -1,7 +1,9 @@
 #include <stdexcept>
 
+#include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/StringSwitch.h>
 #include <llvm/ADT/Triple.h>
+#include <llvm/Support/Host.h>
 
 #include <llvm-abi/x86/CPUKind.hpp>
 
@@ -9,17 +11,46 @@ namespace llvm_abi {
 	
 	namespace x86 {
 		
-		std::string selectCPUName(const llvm::Triple& /*targetTriple*/,
-		                          const std::string& cpu) {
-			// TODO!
-			return !cpu.empty() ? cpu : "x86-64";
+		bool isNativeCPUName(const std::string& cpu) {
+			return cpu == "native";
+		}
+		
+		bool canUseHostCPU(const llvm::Triple& targetTriple) {
+			// Host detection only makes sense if the code will run on
+			// the machine doing the compilation (e.g. JIT use).
+			static const auto hostArch = llvm::Triple(llvm::sys::getProcessTriple()).getArch();
+			const bool isHostX86 = hostArch == llvm::Triple::x86 ||
+			                       hostArch == llvm::Triple::x86_64;
+			const bool isTargetX86 = targetTriple.getArch() == llvm::Triple::x86 ||
+			                         targetTriple.getArch() == llvm::Triple::x86_64;
+			return isHostX86 && isTargetX86;
+		}
+		
+		const std::string& getHostCPUName() {
+			// Querying the host involves running CPUID, so do it once
+			// per process.
+			static const std::string hostCPUName = llvm::sys::getHostCPUName().str();
+			return hostCPUName;
+		}
+		
+		llvm::StringRef selectCPUName(const llvm::Triple& targetTriple,
+		                              const std::string& cpu) {
+			if (isNativeCPUName(cpu) && canUseHostCPU(targetTriple)) {
+				return getHostCPUName();
+			}
+			
+			if (cpu.empty() || isNativeCPUName(cpu)) {
+				return "x86-64";
+			}
+			
+			return cpu;
 		}
 		
 		CPUKind getCPUKind(const llvm::Triple& targetTriple,
 		                   const std::string& userCPUString) {
 			const auto cpuString = selectCPUName(targetTriple,
 			                                     userCPUString);
-			const auto cpu = llvm::StringSwitch<CPUKind>(cpuString)
+			auto cpu = llvm::StringSwitch<CPUKind>(cpuString)
 				.Case("i386", CK_i386)
 				.Case("i486", CK_i486)
 				.Case("winchip-c6", CK_WinChipC6)
@@ -56,8 +87,9 @@ namespace llvm_abi {
 				.Case("haswell", CK_Haswell)
 				.Case("core-avx2", CK_Haswell) // Legacy name.
 				.Case("broadwell", CK_Broadwell)
-				.Case("skylake", CK_Skylake)
-				.Case("skx", CK_Skylake) // Legacy name.
+				.Case("skylake", CK_SkylakeClient)
+				.Case("skylake-avx512", CK_SkylakeServer)
+				.Case("skx", CK_SkylakeServer) // Legacy name.
 				.Case("knl", CK_KNL)
 				.Case("k6", CK_K6)
 				.Case("k6-2", CK_K6_2)
@@ -86,6 +118,14 @@ namespace llvm_abi {
 				.Case("geode", CK_Geode)
 				.Default(CK_Generic);
 			
+			if (cpu == CK_Generic && isNativeCPUName(userCPUString)) {
+				// The host is newer than anything in the table above;
+				// its features are queried directly, so the baseline
+				// CPU for the architecture is good enough here.
+				cpu = targetTriple.getArch() == llvm::Triple::x86_64 ?
+				      CK_x86_64 : CK_i686;
+			}
+			
 			// Perform any per-CPU checks necessary to determine if
 			// this CPU is acceptable.
 			switch (cpu) {
@@ -137,7 +177,8 @@ namespace llvm_abi {
 				case CK_IvyBridge:
 				case CK_Haswell:
 				case CK_Broadwell:
-				case CK_Skylake:
+				case CK_SkylakeClient:
+				case CK_SkylakeServer:
 				case CK_KNL:
 				case CK_Athlon64:
 				case CK_Athlon64SSE3:
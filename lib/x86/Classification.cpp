@@ -2,7 +2,7 @@
 
 #include <llvm/Support/ErrorHandling.h>
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/Type.hpp>
 
 #include <llvm-abi/x86/ArgClass.hpp>
@@ -12,7 +12,8 @@ namespace llvm_abi {
 	
 	namespace x86 {
 		
-		Classification::Classification() {
+		Classification::Classification()
+		: memoryReason_(ArgInfo::ABIRequired) {
 			classes_[0] = NoClass;
 			classes_[1] = NoClass;
 		}
@@ -29,6 +30,19 @@ namespace llvm_abi {
 			return classes_[0] == Memory;
 		}
 		
+		ArgInfo::IndirectReason Classification::memoryReason() const {
+			return memoryReason_;
+		}
+		
+		void Classification::setMemory(const ArgInfo::IndirectReason reason) {
+			if (isMemory()) {
+				return;
+			}
+			
+			memoryReason_ = reason;
+			addField(0, Memory);
+		}
+		
 		void Classification::addField(const size_t offset, const ArgClass fieldClass) {
 			if (isMemory()) {
 				return;
@@ -50,7 +64,11 @@ namespace llvm_abi {
 			}
 		}
 		
-		void Classification::classifyType(const ABITypeInfo& typeInfo,
+		void Classification::setHigh(const ArgClass highClass) {
+			classes_[1] = highClass;
+		}
+		
+		void Classification::classifyType(const ABITypeLayout& typeLayout,
 		                                  const Type type,
 		                                  const size_t offset,
 		                                  const bool isNamedArg) {
@@ -92,24 +110,24 @@ namespace llvm_abi {
 					for (const auto& member: structMembers) {
 						if (member.offset() < structOffset) {
 							// Add necessary padding before this member.
-							structOffset = structOffset.roundUpToAlign(typeInfo.getTypeRequiredAlign(member.type()));
+							structOffset = structOffset.roundUpToAlign(typeLayout.getTypeRequiredAlign(member.type()));
 						} else {
 							structOffset = member.offset();
 						}
 						
-						classifyType(typeInfo,
+						classifyType(typeLayout,
 						             member.type(),
 						             offset + structOffset.asBytes(),
 						             isNamedArg);
 						
 						// Add the member's size.
-						structOffset += typeInfo.getTypeAllocSize(member.type());
+						structOffset += typeLayout.getTypeAllocSize(member.type());
 					}
 					return;
 				}
 				case UnionType: {
 					for (const auto& member: type.unionMembers()) {
-						classifyType(typeInfo,
+						classifyType(typeLayout,
 						             member.type(),
 						             offset,
 						             isNamedArg);
@@ -118,10 +136,10 @@ namespace llvm_abi {
 				}
 				case ArrayType: {
 					const auto& elementType = type.arrayElementType();
-					const auto elementSize = typeInfo.getTypeAllocSize(elementType);
+					const auto elementSize = typeLayout.getTypeAllocSize(elementType);
 					
 					for (size_t i = 0; i < type.arrayElementCount(); i++) {
-						classifyType(typeInfo,
+						classifyType(typeLayout,
 						             elementType,
 						             offset + i * elementSize.asBytes(),
 						             isNamedArg);
@@ -129,7 +147,7 @@ namespace llvm_abi {
 					return;
 				}
 				case VectorType: {
-					const auto size = typeInfo.getTypeAllocSize(type);
+					const auto size = typeLayout.getTypeAllocSize(type);
 					const auto elementType = type.vectorElementType();
 					
 					if (size.asBits() == 32) {
@@ -153,7 +171,9 @@ namespace llvm_abi {
 							addField(offset, Sse);
 						}
 					} else if (size.asBits() == 128 ||
-						   (isNamedArg && size.asBits() == 256 && typeInfo.isLegalVectorType(type))) {
+						   (isNamedArg &&
+						    (size.asBits() == 256 || size.asBits() == 512) &&
+						    typeLayout.isLegalVectorType(type))) {
 						// Arguments of 256-bits are split into four eightbyte chunks. The
 						// least significant one belongs to class SSE and all the others to class
 						// SSEUP. The original Lo and Hi design considers that types can't be
@@ -162,9 +182,12 @@ namespace llvm_abi {
 						// where the upper parts would need to be inspected, avoid adding
 						// complexity and just consider Hi to match the 64-256 part.
 						//
-						// Note that per 3.5.7 of AMD64-ABI, 256-bit args are only passed in
-						// registers if they are "named", i.e. not part of the "..." of a
-						// variadic function.
+						// 512-bit arguments (AVX-512) are split into eight eightbyte chunks
+						// in the same way and are passed in a ZMM register.
+						//
+						// Note that per 3.5.7 of AMD64-ABI, 256-bit and 512-bit args are only
+						// passed in registers if they are "named", i.e. not part of the "..."
+						// of a variadic function.
 						addField(offset, Sse);
 						addField(offset + 8, SseUp);
 					} else {
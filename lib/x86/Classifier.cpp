@@ -1,12 +1,15 @@
 #include <algorithm>
+#include <climits>
 #include <cstddef>
 
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/Support/ErrorHandling.h>
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/CallingConvention.hpp>
 #include <llvm-abi/DataSize.hpp>
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/Type.hpp>
@@ -50,7 +53,7 @@ namespace llvm_abi {
 			return ArgInfo::getIndirect(0);
 		}
 		
-		ArgInfo getIndirectResult(const ABITypeInfo& typeInfo,
+		ArgInfo getIndirectResult(const ABITypeLayout& typeLayout,
 		                          const Type type,
 		                          const unsigned freeIntRegs) {
 			// If this is a scalar LLVM value then assume LLVM will pass it in the right
@@ -62,14 +65,14 @@ namespace llvm_abi {
 			// but this code would be much safer if we could mark the argument with
 			// 'onstack'. See PR12193.
 			if (!type.isAggregateType() &&
-			    (!type.isVector() || typeInfo.isLegalVectorType(type))) {
+			    (!type.isVector() || typeLayout.isLegalVectorType(type))) {
 				return type.isPromotableIntegerType() ?
 					ArgInfo::getExtend(type) : ArgInfo::getDirect(type);
 			}
 			
 			// Compute the byval alignment. We specify the alignment of the byval in all
 			// cases so that the mid-level optimizer knows the alignment of the byval.
-			const auto align = std::max<DataSize>(typeInfo.getTypeRequiredAlign(type), DataSize::Bytes(8));
+			const auto align = std::max<DataSize>(typeLayout.getTypeRequiredAlign(type), DataSize::Bytes(8));
 			
 			// Attempt to avoid passing indirect results using byval when possible. This
 			// is important for good codegen.
@@ -93,7 +96,7 @@ namespace llvm_abi {
 			// We can revisit this if the backend grows support for 'onstack' parameter
 			// attributes. See PR12193.
 			if (freeIntRegs == 0) {
-				const auto size = typeInfo.getTypeAllocSize(type);
+				const auto size = typeLayout.getTypeAllocSize(type);
 				
 				// If this type fits in an eightbyte, coerce it into the matching integral
 				// type, which will end up on the stack (with alignment 8).
@@ -106,12 +109,12 @@ namespace llvm_abi {
 			return ArgInfo::getIndirect(align.asBytes());
 		}
 		
-		/// The ABI specifies that a value should be passed in a full vector XMM/YMM
+		/// The ABI specifies that a value should be passed in a full vector XMM/YMM/ZMM
 		/// register. Pick an LLVM IR type that will be passed as a vector register.
-		Type getByteVectorType(const ABITypeInfo& typeInfo, Type type) {
+		Type getByteVectorType(const ABITypeLayout& typeLayout, Type type) {
 			// Wrapper structs/arrays that only contain vectors are passed just like
 			// vectors; strip them off if present.
-			const auto singleElementType = type.getStructSingleElement(typeInfo);
+			const auto singleElementType = type.getStructSingleElement(typeLayout);
 			if (!singleElementType.isVoid()) {
 				type = singleElementType;
 			}
@@ -119,10 +122,10 @@ namespace llvm_abi {
 			// If the preferred type is a 16-byte vector, prefer
 			// to pass it.
 			if (type.isVector()) {
-				const auto width = typeInfo.getTypeRawSize(type);
+				const auto width = typeLayout.getTypeRawSize(type);
 				const auto elementType = type.vectorElementType();
-				const auto elementSize = typeInfo.getTypeRawSize(elementType);
-				if ((width.asBits() >= 128 && width.asBits() <= 256) &&
+				const auto elementSize = typeLayout.getTypeRawSize(elementType);
+				if ((width.asBits() >= 128 && width.asBits() <= 512) &&
 					(elementType.isFloat() || elementType.isDouble() ||
 					 (elementType.isInteger() &&
 					  (elementSize.asBits() == 8 ||
@@ -134,7 +137,7 @@ namespace llvm_abi {
 				}
 			}
 			
-			return typeInfo.typeBuilder().getVectorTy(2, DoubleTy);
+			return typeLayout.typeBuilder().getVectorTy(2, DoubleTy);
 		}
 		
 		/**
@@ -143,7 +146,7 @@ namespace llvm_abi {
 		 * float at offset 4.  It is conservatively correct for this
 		 * routine to return false.
 		 */
-		static bool containsFloatAtOffset(const ABITypeInfo& typeInfo,
+		static bool containsFloatAtOffset(const ABITypeLayout& typeLayout,
 		                                  const Type type,
 		                                  const DataSize offset) {
 			// Base case if we find a float.
@@ -153,11 +156,11 @@ namespace llvm_abi {
 			
 			// If this is a struct, recurse into the field at the specified offset.
 			if (type.isStruct()) {
-				const auto fieldOffsets = typeInfo.calculateStructOffsets(type.structMembers());
+				const auto fieldOffsets = typeLayout.calculateStructOffsets(type.structMembers());
 				const auto fieldIndex = getFieldContainingOffset(fieldOffsets, offset);
 				assert(fieldOffsets[fieldIndex] <= offset);
 				const auto relativeOffset = offset - fieldOffsets[fieldIndex];
-				return containsFloatAtOffset(typeInfo,
+				return containsFloatAtOffset(typeLayout,
 				                             type.structMembers()[fieldIndex].type(),
 				                             relativeOffset);
 			}
@@ -165,11 +168,11 @@ namespace llvm_abi {
 			// If this is an array, recurse into the field at the specified offset.
 			if (type.isArray()) {
 				const auto elementType = type.arrayElementType();
-				const auto elementSize = typeInfo.getTypeAllocSize(elementType);
+				const auto elementSize = typeLayout.getTypeAllocSize(elementType);
 				const auto elementOffset = elementSize * (offset / elementSize);
 				assert(elementOffset <= offset);
 				const auto relativeOffset = offset - elementOffset;
-				return containsFloatAtOffset(typeInfo,
+				return containsFloatAtOffset(typeLayout,
 				                             elementType,
 				                             relativeOffset);
 			}
@@ -184,7 +187,7 @@ namespace llvm_abi {
 		 * 8 bytes of an XMM register, corresponding to the Sse class.
 		 */
 		Type
-		getSseTypeAtOffset(const ABITypeInfo& typeInfo,
+		getSseTypeAtOffset(const ABITypeLayout& typeLayout,
 		                   const Type type,
 		                   const DataSize offset,
 		                   const Type sourceType,
@@ -195,7 +198,7 @@ namespace llvm_abi {
 			// The only three choices we have are either double,
 			// <2 x float>, or float.
 			
-			if (sourceType.bitsContainNoUserData(typeInfo,
+			if (sourceType.bitsContainNoUserData(typeLayout,
 			                                     sourceOffset.asBits() + 32,
 			                                     sourceOffset.asBits() + 64)) {
 				// We pass as float if the last 4 bytes is just
@@ -207,9 +210,9 @@ namespace llvm_abi {
 			// We want to pass as <2 x float> if the LLVM IR type
 			// contains a float at offset+0 and offset+4.  Walk
 			// the type to find out if this is the case.
-			if (containsFloatAtOffset(typeInfo, type, offset) &&
-			    containsFloatAtOffset(typeInfo, type, offset + DataSize::Bytes(4))) {
-				return typeInfo.typeBuilder().getVectorTy(2, FloatTy);
+			if (containsFloatAtOffset(typeLayout, type, offset) &&
+			    containsFloatAtOffset(typeLayout, type, offset + DataSize::Bytes(4))) {
+				return typeLayout.typeBuilder().getVectorTy(2, FloatTy);
 			}
 			
 			return DoubleTy;
@@ -236,7 +239,7 @@ namespace llvm_abi {
 		 * (which is always either 0 or 8).
 		 */
 		Type
-		getINTEGERTypeAtOffset(const ABITypeInfo& typeInfo,
+		getINTEGERTypeAtOffset(const ABITypeLayout& typeLayout,
 		                       const Type type,
 		                       const DataSize offset,
 		                       const Type sourceType,
@@ -248,7 +251,7 @@ namespace llvm_abi {
 			// it means that we're returning an 8-byte unit
 			// starting with it.  See if we can safely use it.
 			if (offset.asBytes() == 0) {
-				const auto typeSize = typeInfo.getTypeAllocSize(type);
+				const auto typeSize = typeLayout.getTypeAllocSize(type);
 				
 				// Pointers and int64's always fill the 8-byte unit.
 				if ((type.isPointer() || type.isInteger()) &&
@@ -266,7 +269,7 @@ namespace llvm_abi {
 				    (typeSize.asBytes() == 1 ||
 				     typeSize.asBytes() == 2 || 
 				     typeSize.asBytes() == 4)) {
-					if (sourceType.bitsContainNoUserData(typeInfo,
+					if (sourceType.bitsContainNoUserData(typeLayout,
 					                                     sourceOffset.asBits() + typeSize.asBits(),
 					                                     sourceOffset.asBits() + 64)) {
 						return type;
@@ -274,14 +277,14 @@ namespace llvm_abi {
 				}
 			}
 			
-			if (type.isStruct() && offset < typeInfo.getTypeAllocSize(type)) {
+			if (type.isStruct() && offset < typeLayout.getTypeAllocSize(type)) {
 				// If this is a struct, recurse into the field at the specified offset.
-				const auto fieldOffsets = typeInfo.calculateStructOffsets(type.structMembers());
+				const auto fieldOffsets = typeLayout.calculateStructOffsets(type.structMembers());
 				const auto fieldIndex = getFieldContainingOffset(fieldOffsets, offset);
 				assert(fieldOffsets[fieldIndex] <= offset);
 				const auto relativeOffset = offset - fieldOffsets[fieldIndex];
 				
-				return getINTEGERTypeAtOffset(typeInfo,
+				return getINTEGERTypeAtOffset(typeLayout,
 				                              type.structMembers()[fieldIndex].type(),
 				                              relativeOffset,
 				                              sourceType,
@@ -290,10 +293,10 @@ namespace llvm_abi {
 			
 			if (type.isArray()) {
 				const auto elementType = type.arrayElementType();
-				const auto elementSize = typeInfo.getTypeAllocSize(elementType);
+				const auto elementSize = typeLayout.getTypeAllocSize(elementType);
 				const auto elementOffset = elementSize * (offset / elementSize);
 				assert(elementOffset <= offset);
-				return getINTEGERTypeAtOffset(typeInfo,
+				return getINTEGERTypeAtOffset(typeLayout,
 				                              elementType,
 				                              offset - elementOffset,
 				                              sourceType,
@@ -302,7 +305,7 @@ namespace llvm_abi {
 			
 			// Okay, we don't have any better idea of what to pass, so we pass this in an
 			// integer register that isn't too big to fit the rest of the struct.
-			const auto typeSize = typeInfo.getTypeAllocSize(sourceType);
+			const auto typeSize = typeLayout.getTypeAllocSize(sourceType);
 			assert(typeSize != sourceOffset && "Empty field?");
 			
 			// It is always safe to classify this as an integer
@@ -322,7 +325,7 @@ namespace llvm_abi {
 		 * as float, return {i32*, float}.
 		 */
 		Type
-		getX86_64ByValArgumentPair(const ABITypeInfo& typeInfo,
+		getX86_64ByValArgumentPair(const ABITypeLayout& typeLayout,
 		                           Type lowType,
 		                           const Type highType) {
 			// In order to correctly satisfy the ABI, we need the
@@ -330,8 +333,8 @@ namespace llvm_abi {
 			// parts we inferred are both 4-byte types (e.g. i32 and
 			// i32) then the resultant struct type ({i32,i32}) won't
 			// have the second element at offset 8.  Check for this:
-			const auto lowSize = typeInfo.getTypeAllocSize(lowType);
-			const auto highAlign = typeInfo.getTypeRequiredAlign(highType);
+			const auto lowSize = typeLayout.getTypeAllocSize(lowType);
+			const auto highAlign = typeLayout.getTypeRequiredAlign(highType);
 			const auto highStart = lowSize.roundUpToAlign(highAlign);
 			
 			assert(highStart.asBytes() != 0 && highStart.asBytes() <= 8 &&
@@ -356,31 +359,37 @@ namespace llvm_abi {
 				}
 			}
 			
-			const auto resultType = typeInfo.typeBuilder().getStructTy({ lowType, highType });
+			const auto resultType = typeLayout.typeBuilder().getStructTy({ lowType, highType });
 			
 			// Verify that the second element is at an 8-byte offset.
-			assert(typeInfo.calculateStructOffsets(resultType.structMembers())[1].asBytes() == 8 &&
+			assert(typeLayout.calculateStructOffsets(resultType.structMembers())[1].asBytes() == 8 &&
 			       "Invalid x86-64 argument pair!");
 			
 			return resultType;
 		}
 		
-		Classifier::Classifier(const ABITypeInfo& typeInfo)
-		: typeInfo_(typeInfo) { }
+		Classifier::Classifier(const ABITypeLayout& typeLayout)
+		: typeLayout_(typeLayout) { }
 		
 		Classification Classifier::classify(const Type type,
 		                                    const bool isNamedArg) {
 			Classification classification;
 			
-			if (typeInfo_.getTypeAllocSize(type).asBytes() > 32 ||
-			    type.hasUnalignedFields(typeInfo_)) {
-				// If size exceeds "four eightbytes" or type
-				// has "unaligned fields", pass in memory.
-				classification.addField(0, Memory);
+			// If size exceeds "eight eightbytes" (the size of a
+			// ZMM register) or type has "unaligned fields", pass
+			// in memory. Anything over two eightbytes that isn't
+			// a legal vector is caught below.
+			if (typeLayout_.getTypeAllocSize(type).asBytes() > 64) {
+				classification.setMemory(ArgInfo::TooLarge);
 				return classification;
 			}
 			
-			classification.classifyType(typeInfo_,
+			if (type.hasUnalignedFields(typeLayout_)) {
+				classification.setMemory(ArgInfo::UnalignedFields);
+				return classification;
+			}
+			
+			classification.classifyType(typeLayout_,
 			                            type,
 			                            /*offset=*/0,
 			                            isNamedArg);
@@ -389,17 +398,25 @@ namespace llvm_abi {
 			// is passed in memory.
 			if (classification.high() == X87Up &&
 			    classification.low() != X87) {
-				classification.addField(0, Memory);
+				classification.setMemory(ArgInfo::X87UpWithoutX87);
 			}
 			
 			// If the size of the aggregate exceeds two eightbytes
 			// and the first eight-byte isn’t SSE or any other
 			// eightbyte isn’t SSEUP, the whole argument is passed
 			// in memory.
-			if (typeInfo_.getTypeAllocSize(type).asBytes() > 16 &&
+			if (typeLayout_.getTypeAllocSize(type).asBytes() > 16 &&
 			    (classification.low() != Sse ||
 			     classification.high() != SseUp)) {
-				classification.addField(0, Memory);
+				classification.setMemory(ArgInfo::TooLarge);
+			}
+			
+			// If SSEUP is not preceded by SSE or SSEUP, it is
+			// converted to SSE (e.g. a union of a 16-byte vector
+			// and an integer).
+			if (classification.high() == SseUp &&
+			    classification.low() != Sse) {
+				classification.setHigh(Sse);
 			}
 			
 			return classification;
@@ -451,13 +468,21 @@ namespace llvm_abi {
 					if (isArgument) {
 						// AMD64-ABI 3.2.3p3: Rule 1. If the class is MEMORY, pass the argument
 						// on the stack.
-						return getIndirectResult(typeInfo_,
-						                         type,
-						                         freeIntRegs);
+						auto argInfo = getIndirectResult(typeLayout_,
+						                                 type,
+						                                 freeIntRegs);
+						if (argInfo.isIndirect()) {
+							argInfo.setIndirectReason(classification.memoryReason());
+						}
+						return argInfo;
 					} else {
 						// AMD64-ABI 3.2.3p4: Rule 2. Types of class memory are returned via
 						// hidden argument.
-						return getIndirectReturnResult(type);
+						auto argInfo = getIndirectReturnResult(type);
+						if (argInfo.isIndirect()) {
+							argInfo.setIndirectReason(classification.memoryReason());
+						}
+						return argInfo;
 					}
 				}
 				
@@ -470,7 +495,7 @@ namespace llvm_abi {
 					++neededInt;
 					
 					// Pick an 8-byte type based on the preferred type.
-					resultType = getINTEGERTypeAtOffset(typeInfo_,
+					resultType = getINTEGERTypeAtOffset(typeLayout_,
 					                                    type, DataSize::Bytes(0),
 					                                    type, DataSize::Bytes(0));
 					
@@ -494,7 +519,7 @@ namespace llvm_abi {
 				// available Sse register of the sequence %xmm0, %xmm1 is used.
 				case Sse: {
 					++neededSse;
-					resultType = getSseTypeAtOffset(typeInfo_,
+					resultType = getSseTypeAtOffset(typeLayout_,
 					                                type, DataSize::Bytes(0),
 					                                type, DataSize::Bytes(0));
 					break;
@@ -503,9 +528,13 @@ namespace llvm_abi {
 					if (isArgument) {
 						// AMD64-ABI 3.2.3p3: Rule 5. If the class is X87, X87UP or
 						// COMPLEX_X87, it is passed in memory.
-						return getIndirectResult(typeInfo_,
-						                         type,
-						                         freeIntRegs);
+						auto argInfo = getIndirectResult(typeLayout_,
+						                                 type,
+						                                 freeIntRegs);
+						if (argInfo.isIndirect()) {
+							argInfo.setIndirectReason(ArgInfo::X87Value);
+						}
+						return argInfo;
 					} else {
 						// AMD64-ABI 3.2.3p4: Rule 6. If the class is X87, the value is
 						// returned on the X87 stack in %st0 as 80-bit x87 number.
@@ -518,14 +547,18 @@ namespace llvm_abi {
 					if (isArgument) {
 						// AMD64-ABI 3.2.3p3: Rule 5. If the class is X87, X87UP or
 						// COMPLEX_X87, it is passed in memory.
-						return getIndirectResult(typeInfo_,
-						                         type,
-						                         freeIntRegs);
+						auto argInfo = getIndirectResult(typeLayout_,
+						                                 type,
+						                                 freeIntRegs);
+						if (argInfo.isIndirect()) {
+							argInfo.setIndirectReason(ArgInfo::X87Value);
+						}
+						return argInfo;
 					} else {
 						// AMD64-ABI 3.2.3p4: Rule 8. If the class is COMPLEX_X87, the real
 						// part of the value is returned in %st0 and the imaginary part in
 						// %st1.
-						resultType = typeInfo_.typeBuilder().getStructTy({ LongDoubleTy, LongDoubleTy });
+						resultType = typeLayout_.typeBuilder().getStructTy({ LongDoubleTy, LongDoubleTy });
 					}
 					break;
 				}
@@ -549,7 +582,7 @@ namespace llvm_abi {
 				}
 				case Integer: {
 					++neededInt;
-					highPartType = getINTEGERTypeAtOffset(typeInfo_,
+					highPartType = getINTEGERTypeAtOffset(typeLayout_,
 					                                      type, DataSize::Bytes(8),
 					                                      type, DataSize::Bytes(8));
 					if (classification.low() == NoClass) {
@@ -559,7 +592,7 @@ namespace llvm_abi {
 					break;
 				}
 				case Sse: {
-					highPartType = getSseTypeAtOffset(typeInfo_,
+					highPartType = getSseTypeAtOffset(typeLayout_,
 					                                  type, DataSize::Bytes(8),
 					                                  type, DataSize::Bytes(8));
 					if (classification.low() == NoClass) {
@@ -578,7 +611,7 @@ namespace llvm_abi {
 				// used vector register.
 				case SseUp: {
 					assert(classification.low() == Sse);
-					resultType = getByteVectorType(typeInfo_,
+					resultType = getByteVectorType(typeLayout_,
 					                               type);
 					break;
 				}
@@ -588,7 +621,7 @@ namespace llvm_abi {
 				case X87Up: {
 					assert(!isArgument && "TODO");
 					if (classification.low() != X87) {
-						highPartType = getSseTypeAtOffset(typeInfo_,
+						highPartType = getSseTypeAtOffset(typeLayout_,
 						                                  type, DataSize::Bytes(8),
 						                                  type, DataSize::Bytes(8));
 						if (classification.low() == NoClass) {
@@ -605,7 +638,7 @@ namespace llvm_abi {
 			// known to pass in the high eightbyte of the result.  We do this by forming a
 			// first class struct aggregate with the high and low part: {low, high}
 			if (!highPartType.isVoid()) {
-				resultType = getX86_64ByValArgumentPair(typeInfo_,
+				resultType = getX86_64ByValArgumentPair(typeLayout_,
 				                                        resultType,
 				                                        highPartType);
 			}
@@ -631,17 +664,109 @@ namespace llvm_abi {
 			                    /*isNamedArg=*/true);
 		}
 		
+		bool Classifier::classifyRegCallStructTypeImpl(const Type type,
+		                                               unsigned &neededInt,
+		                                               unsigned &neededSse) {
+			assert(type.isStruct());
+			
+			if (type.hasFlexibleArrayMember()) {
+				return false;
+			}
+			
+			for (const auto& member: type.structMembers()) {
+				const auto memberType = member.type();
+				if (memberType.isStruct()) {
+					if (!classifyRegCallStructTypeImpl(memberType,
+					                                   neededInt,
+					                                   neededSse)) {
+						return false;
+					}
+					continue;
+				}
+				
+				unsigned localNeededInt = 0;
+				unsigned localNeededSse = 0;
+				const auto memberInfo = classifyType(memberType,
+				                                     /*isArgument=*/true,
+				                                     /*freeIntRegs=*/UINT_MAX,
+				                                     localNeededInt,
+				                                     localNeededSse,
+				                                     /*isNamedArg=*/true);
+				if (memberInfo.isIndirect()) {
+					return false;
+				}
+				
+				neededInt += localNeededInt;
+				neededSse += localNeededSse;
+			}
+			
+			return true;
+		}
+		
+		ArgInfo Classifier::classifyRegCallStructType(const Type type,
+		                                              const bool isArgument,
+		                                              unsigned &neededInt,
+		                                              unsigned &neededSse) {
+			neededInt = 0;
+			neededSse = 0;
+			
+			if (!classifyRegCallStructTypeImpl(type, neededInt, neededSse)) {
+				neededInt = 0;
+				neededSse = 0;
+				if (isArgument) {
+					const auto align = typeLayout_.getTypeRequiredAlign(type);
+					return ArgInfo::getIndirect(align.asBytes());
+				} else {
+					return getIndirectReturnResult(type);
+				}
+			}
+			
+			// Pass the struct directly, so that each field gets
+			// its own register(s).
+			return ArgInfo::getDirect(type);
+		}
+		
 		llvm::SmallVector<ArgInfo, 8>
 		Classifier::classifyFunctionType(const FunctionType& functionType,
 		                                 llvm::ArrayRef<Type> argumentTypes) {
-			ArgInfo returnInfo = classifyReturnType(functionType.returnType());
+			ABITimeRegion timeRegion(ClassificationRegion);
 			
-			llvm::SmallVector<ArgInfo, 8> argInfoArray;
-			argInfoArray.push_back(returnInfo);
+			// 'vectorcall' uses the normal classification on
+			// SysV targets (as clang does); only the LLVM calling
+			// convention differs. 'regcall' has more registers and
+			// splits structs into their fields.
+			const bool isRegCall =
+				functionType.callingConvention() == CC_RegCall;
 			
 			// Keep track of the number of assigned registers.
-			unsigned freeIntRegs = 6;
-			unsigned freeSseRegs = 8;
+			unsigned freeIntRegs = isRegCall ? 11 : 6;
+			unsigned freeSseRegs = isRegCall ? 16 : 8;
+			
+			const auto returnType = functionType.returnType();
+			ArgInfo returnInfo;
+			if (isRegCall && returnType.isStruct()) {
+				unsigned neededInt = 0;
+				unsigned neededSse = 0;
+				returnInfo = classifyRegCallStructType(returnType,
+				                                       /*isArgument=*/false,
+				                                       neededInt,
+				                                       neededSse);
+				if (freeIntRegs >= neededInt && freeSseRegs >= neededSse) {
+					freeIntRegs -= neededInt;
+					freeSseRegs -= neededSse;
+				} else {
+					returnInfo = getIndirectReturnResult(returnType);
+				}
+			} else if (isRegCall && returnType.isComplex() &&
+			           returnType.complexKind() == LongDouble) {
+				// Complex long double is returned in memory.
+				returnInfo = getIndirectReturnResult(returnType);
+			} else {
+				returnInfo = classifyReturnType(returnType);
+			}
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			argInfoArray.push_back(returnInfo);
 			
 			// If the return value is indirect, then the hidden argument
 			// is consuming one integer register.
@@ -667,12 +792,18 @@ namespace llvm_abi {
 				const bool isArgument = true;
 				unsigned neededInt = 0;
 				unsigned neededSse = 0;
-				ArgInfo argInfo = classifyType(argType,
-				                               isArgument,
-				                               freeIntRegs,
-				                               neededInt,
-				                               neededSse,
-				                               isNamedArg);
+				ArgInfo argInfo =
+					isRegCall && argType.isStruct() ?
+						classifyRegCallStructType(argType,
+						                          isArgument,
+						                          neededInt,
+						                          neededSse) :
+						classifyType(argType,
+						             isArgument,
+						             freeIntRegs,
+						             neededInt,
+						             neededSse,
+						             isNamedArg);
 				// AMD64-ABI 3.2.3p3: If there are no registers available for any
 				// eightbyte of an argument, the whole argument is passed on the
 				// stack. If registers have already been assigned for some
@@ -681,9 +812,12 @@ namespace llvm_abi {
 					freeIntRegs -= neededInt;
 					freeSseRegs -= neededSse;
 				} else {
-					argInfo = getIndirectResult(typeInfo_,
+					argInfo = getIndirectResult(typeLayout_,
 					                            argType,
 					                            freeIntRegs);
+					if (argInfo.isIndirect()) {
+						argInfo.setIndirectReason(ArgInfo::RegistersExhausted);
+					}
 				}
 				
 				argInfoArray.push_back(argInfo);
@@ -691,7 +825,7 @@ namespace llvm_abi {
 			
 			return argInfoArray;
 		}
-		
-	}
 	
+	}
+
 }
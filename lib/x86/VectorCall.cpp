@@ -0,0 +1,44 @@
+#include <cstdint>
+
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/VectorCall.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		bool isX86VectorTypeForVectorCall(const ABITypeLayout& typeLayout,
+		                                  const Type type) {
+			if (type.isFloatingPoint()) {
+				if (type == HalfFloatTy) {
+					return false;
+				}
+				
+				// An x87 'long double' can't be passed in SSE registers;
+				// only targets where it's the same as 'double' allow it.
+				if (type == LongDoubleTy) {
+					return typeLayout.getTypeAllocSize(type) ==
+					       typeLayout.getTypeAllocSize(DoubleTy);
+				}
+				
+				return true;
+			} else if (type.isVector()) {
+				// vectorcall can pass XMM, YMM, and ZMM vectors.
+				// We don't pass SSE1 MMX registers specially.
+				const auto size = typeLayout.getTypeAllocSize(type);
+				return size.asBits() == 128 ||
+				       size.asBits() == 256 ||
+				       size.asBits() == 512;
+			}
+			return false;
+		}
+		
+		bool isX86VectorCallAggregateSmallEnough(const uint64_t numMembers) {
+			return numMembers <= 4;
+		}
+		
+	}
+	
+}
@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/Win64ABITarget.hpp>
+#include <llvm-abi/x86/Win64ABITypeLayout.hpp>
+#include <llvm-abi/x86/Win64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		Win64ABITarget::Win64ABITarget(const llvm::Triple& targetTriple)
+		: ABITarget(targetTriple),
+		typeLayout_(targetTriple.isWindowsGNUEnvironment(), &(cache())) { }
+		
+		Win64ABITarget::~Win64ABITarget() { }
+		
+		std::string Win64ABITarget::name() const {
+			return "Win64";
+		}
+		
+		llvm::Type* Win64ABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			if (typeLayout_.isMinGW()) {
+				return llvm::Type::getX86_FP80Ty(llvmContext);
+			} else {
+				return llvm::Type::getDoubleTy(llvmContext);
+			}
+		}
+		
+		llvm::CallingConv::ID Win64ABITarget::getCallingConvention(const CallingConvention callingConvention) const {
+			switch (callingConvention) {
+				case CC_CDefault:
+				case CC_CppDefault:
+				case CC_CDecl:
+				// x64 has a single calling convention, so these are
+				// accepted but ignored (as MSVC does).
+				case CC_StdCall:
+				case CC_FastCall:
+				case CC_ThisCall:
+				case CC_Pascal:
+					return llvm::CallingConv::C;
+				case CC_VectorCall:
+					return llvm::CallingConv::X86_VectorCall;
+				case CC_Fast:
+					return llvm::CallingConv::Fast;
+				default:
+					llvm_unreachable("Invalid calling convention for ABI.");
+			}
+		}
+		
+		const Win64ABITypeLayout& Win64ABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		Win64ABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                         llvm::ArrayRef<Type> argumentTypes) const {
+			Win64Classifier classifier(typeLayout_,
+			                           typeLayout_.typeBuilder(),
+			                           typeLayout_.isMinGW());
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		Win64ABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// RCX, RDX, R8 and R9 or XMM0-XMM3, by position, and
+			// the caller allocates a 32 byte home area. (This
+			// ignores vectorcall's extra XMM4 and XMM5.)
+			ABIRegisterFile registerFile(/*intRegisters=*/4,
+			                             /*fpRegisters=*/4,
+			                             DataSize::Bytes(8));
+			registerFile.isPositional = true;
+			registerFile.reservedStackSize = DataSize::Bytes(32);
+			return registerFile;
+		}
+		
+	}
+	
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/x86/VectorCall.hpp>
+#include <llvm-abi/x86/Win64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		Win64ABITypeLayout::Win64ABITypeLayout(const bool isMinGW,
+		                                       const ABICache* const cache)
+		: isMinGW_(isMinGW),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		bool Win64ABITypeLayout::isMinGW() const {
+			return isMinGW_;
+		}
+		
+		const TypeBuilder& Win64ABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize Win64ABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize Win64ABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize Win64ABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize Win64ABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize Win64ABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		Win64ABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool Win64ABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			const auto size = getTypeAllocSize(type);
+			return size.asBits() > 64 && size.asBits() <= 128;
+		}
+		
+		bool Win64ABITypeLayout::isBigEndian() const {
+			return false;
+		}
+		
+		bool Win64ABITypeLayout::isCharSigned() const {
+			return true;
+		}
+		
+		bool Win64ABITypeLayout::isHomogeneousAggregateBaseType(const Type type) const {
+			// FIXME: Assumes vectorcall is in use.
+			return isX86VectorTypeForVectorCall(*this, type);
+		}
+		
+		bool Win64ABITypeLayout::isHomogeneousAggregateSmallEnough(const Type /*base*/,
+		                                                           const uint64_t members) const {
+			// FIXME: Assumes vectorcall is in use.
+			return isX86VectorCallAggregateSmallEnough(members);
+		}
+		
+		DataSize Win64ABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(8);
+		}
+		
+		DataSize Win64ABITypeLayout::getPointerAlign() const {
+			return DataSize::Bytes(8);
+		}
+		
+		DataSize Win64ABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+				case Long:
+				case ULong:
+					return DataSize::Bytes(4);
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize Win64ABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			return getIntSize(kind);
+		}
+		
+		DataSize Win64ABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					llvm_unreachable("TODO");
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(isMinGW() ? 16 : 8);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize Win64ABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			return getFloatSize(kind);
+		}
+		
+		DataSize Win64ABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			return getFloatSize(kind) * 2;
+		}
+		
+		DataSize Win64ABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			return getFloatAlign(kind);
+		}
+		
+		DataSize Win64ABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize Win64ABITypeLayout::getVectorAlign(const Type type) const {
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			const auto minAlign =
+				getTypeAllocSize(type).asBytes() >= 64 ?
+					DataSize::Bytes(64) :
+					getTypeAllocSize(type).asBytes() >= 32 ?
+						DataSize::Bytes(32) :
+						getTypeAllocSize(type).asBytes() >= 16 ?
+							DataSize::Bytes(16) :
+							DataSize::Bytes(1);
+			return std::max<DataSize>(elementAlign, minAlign);
+		}
+		
+	}
+	
+}
@@ -0,0 +1,184 @@
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <llvm-abi/ABITimeRegion.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/x86/Win64Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		/// Vectorcall in x64 only permits the first 6 arguments to be
+		/// passed in XMM/YMM registers.
+		static const size_t VectorCallMaxParamNumAsReg = 6;
+		
+		static bool isBuiltinType(const Type type) {
+			return type.isInteger() || type.isFloatingPoint();
+		}
+		
+		Win64Classifier::Win64Classifier(const ABITypeLayout& typeLayout,
+		                                 const TypeBuilder& typeBuilder,
+		                                 const bool isMinGW)
+		: typeLayout_(typeLayout),
+		typeBuilder_(typeBuilder),
+		isMinGW_(isMinGW) { }
+		
+		ArgInfo Win64Classifier::getNaturalAlignIndirect(const Type type,
+		                                                 const bool isReturnType) const {
+			if (isReturnType) {
+				// Returned via a hidden sret pointer; the alignment is unused.
+				return ArgInfo::getIndirect(/*Align=*/0, /*ByVal=*/false);
+			}
+			const auto align = typeLayout_.getTypeRequiredAlign(type);
+			return ArgInfo::getIndirect(align.asBytes(), /*byVal=*/false);
+		}
+		
+		ArgInfo Win64Classifier::classify(const Type type,
+		                                  unsigned& freeSSERegs,
+		                                  const bool isReturnType,
+		                                  const bool isVectorCall) const {
+			if (type.isVoid()) {
+				return ArgInfo::getIgnore();
+			}
+			
+			const auto width = typeLayout_.getTypeAllocSize(type);
+			
+			if (type.isRecordType() && type.hasFlexibleArrayMember()) {
+				return getNaturalAlignIndirect(type, isReturnType);
+			}
+			
+			// vectorcall adds the concept of a homogenous vector aggregate,
+			// similar to other targets.
+			Type base = VoidTy;
+			uint64_t numElements = 0;
+			if (isVectorCall &&
+			    type.isHomogeneousAggregate(typeLayout_, base, numElements)) {
+				const bool isScalarOrVector = isBuiltinType(type) || type.isVector();
+				if (freeSSERegs >= numElements &&
+				    (isReturnType || isScalarOrVector)) {
+					freeSSERegs -= numElements;
+					return ArgInfo::getDirect(type);
+				} else if (!isScalarOrVector && !isReturnType) {
+					// HVAs are delayed and reclassified in the 2nd step.
+					return getNaturalAlignIndirect(type);
+				}
+			}
+			
+			if (type.isAggregateType() || type.isComplex()) {
+				// MS x64 ABI requirement: "Any argument that doesn't fit in 8
+				// bytes, or is not 1, 2, 4, or 8 bytes, must be passed by
+				// reference."
+				if (width.asBits() > 64 || !llvm::isPowerOf2_64(width.asBits())) {
+					return getNaturalAlignIndirect(type, isReturnType);
+				}
+				
+				// Otherwise, coerce it to a small integer.
+				return ArgInfo::getDirect(Type::FixedWidthInteger(width,
+				                                                  /*isSigned=*/false));
+			}
+			
+			if (type == BoolTy) {
+				return ArgInfo::getExtend(type);
+			}
+			
+			if (type == LongDoubleTy && isMinGW_) {
+				// MinGW uses the x87 80 bit 'long double', which
+				// is passed indirectly through memory.
+				return getNaturalAlignIndirect(type, isReturnType);
+			}
+			
+			if (type.isInteger() && width.asBits() == 128) {
+				// The normal rule is that arguments larger than 8 bytes
+				// are passed indirectly.
+				if (!isReturnType) {
+					return getNaturalAlignIndirect(type);
+				}
+				
+				// MinGW returns i128 in XMM0, so coerce to <2 x i64>.
+				return ArgInfo::getDirect(typeBuilder_.getVectorTy(2, Int64Ty));
+			}
+			
+			return ArgInfo::getDirect(type);
+		}
+		
+		ArgInfo Win64Classifier::reclassifyHVAArgType(const Type type,
+		                                              unsigned& freeSSERegs,
+		                                              const ArgInfo& current) const {
+			Type base = VoidTy;
+			uint64_t numElements = 0;
+			if (!isBuiltinType(type) && !type.isVector() &&
+			    type.isHomogeneousAggregate(typeLayout_, base, numElements) &&
+			    freeSSERegs >= numElements) {
+				freeSSERegs -= numElements;
+				
+				// HVAs are passed whole (in consecutive registers)
+				// rather than being flattened into their elements.
+				auto argInfo = ArgInfo::getDirect(type,
+				                                  /*offset=*/0,
+				                                  /*padding=*/VoidTy,
+				                                  /*canBeFlattened=*/false);
+				argInfo.setInReg(true);
+				return argInfo;
+			}
+			return current;
+		}
+		
+		llvm::SmallVector<ArgInfo, 8>
+		Win64Classifier::classifyFunctionType(const FunctionType& functionType,
+		                                      llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
+			const bool isVectorCall =
+				functionType.callingConvention() == CC_VectorCall;
+			
+			llvm::SmallVector<ArgInfo, 8> argInfoArray;
+			
+			// We can use up to 4 SSE return registers with vectorcall.
+			unsigned freeSSERegs = isVectorCall ? 4 : 0;
+			argInfoArray.push_back(classify(functionType.returnType(),
+			                                freeSSERegs,
+			                                /*isReturnType=*/true,
+			                                isVectorCall));
+			
+			// We can use up to 6 SSE register parameters with vectorcall.
+			freeSSERegs = isVectorCall ? 6 : 0;
+			
+			for (size_t i = 0; i < argumentTypes.size(); i++) {
+				if (i < VectorCallMaxParamNumAsReg) {
+					argInfoArray.push_back(classify(argumentTypes[i],
+					                                freeSSERegs,
+					                                /*isReturnType=*/false,
+					                                isVectorCall));
+				} else {
+					// Since these cannot be passed in registers, pretend
+					// no registers are left.
+					unsigned zeroSSERegsAvailable = 0;
+					argInfoArray.push_back(classify(argumentTypes[i],
+					                                zeroSSERegsAvailable,
+					                                /*isReturnType=*/false,
+					                                isVectorCall));
+				}
+			}
+			
+			if (isVectorCall) {
+				for (size_t i = 0; i < argumentTypes.size(); i++) {
+					argInfoArray[i + 1] = reclassifyHVAArgType(argumentTypes[i],
+					                                           freeSSERegs,
+					                                           argInfoArray[i + 1]);
+				}
+			}
+			
+			return argInfoArray;
+		}
+		
+	}
+	
+}
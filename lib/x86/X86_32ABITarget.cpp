@@ -0,0 +1,91 @@
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/X86_32ABITarget.hpp>
+#include <llvm-abi/x86/X86_32ABITypeLayout.hpp>
+#include <llvm-abi/x86/X86_32Classifier.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		X86_32ABITarget::X86_32ABITarget(const llvm::Triple& targetTriple)
+		: ABITarget(targetTriple),
+		typeLayout_(&(cache())) { }
+		
+		X86_32ABITarget::~X86_32ABITarget() { }
+		
+		std::string X86_32ABITarget::name() const {
+			return "x86";
+		}
+		
+		llvm::Type* X86_32ABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getX86_FP80Ty(llvmContext);
+		}
+		
+		llvm::CallingConv::ID X86_32ABITarget::getCallingConvention(const CallingConvention callingConvention) const {
+			switch (callingConvention) {
+				case CC_CDefault:
+				case CC_CDecl:
+				case CC_CppDefault:
+					return llvm::CallingConv::C;
+				case CC_StdCall:
+					return llvm::CallingConv::X86_StdCall;
+				case CC_FastCall:
+					return llvm::CallingConv::X86_FastCall;
+				case CC_ThisCall:
+					return llvm::CallingConv::X86_ThisCall;
+				case CC_Pascal:
+					return llvm::CallingConv::X86_StdCall;
+				case CC_VectorCall:
+					return llvm::CallingConv::X86_VectorCall;
+				case CC_Fast:
+					return llvm::CallingConv::Fast;
+				default:
+					llvm_unreachable("Invalid calling convention for ABI.");
+			}
+		}
+		
+		const X86_32ABITypeLayout& X86_32ABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		X86_32ABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                          llvm::ArrayRef<Type> argumentTypes) const {
+			X86_32Classifier classifier(typeLayout_,
+			                            typeLayout_.typeBuilder(),
+			                            targetTriple());
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		X86_32ABITarget::argumentRegisterFile(const FunctionType& /*functionType*/) const {
+			// Everything is passed on the stack, other than
+			// arguments marked 'inreg' (e.g. for fastcall).
+			return ABIRegisterFile(/*intRegisters=*/0,
+			                       /*fpRegisters=*/0,
+			                       DataSize::Bytes(4));
+		}
+		
+	}
+	
+}
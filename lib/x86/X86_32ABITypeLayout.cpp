@@ -1,112 +1,86 @@
-#include <llvm/IR/DerivedTypes.h>
-#include <llvm/IR/Type.h>
-#include <llvm/IR/Value.h>
+#include <algorithm>
 
-#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
 #include <llvm-abi/DataSize.hpp>
-#include <llvm-abi/DefaultABITypeInfo.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
 #include <llvm-abi/Type.hpp>
 
-#include <llvm-abi/x86/X86_32ABITypeInfo.hpp>
+#include <llvm-abi/x86/VectorCall.hpp>
+#include <llvm-abi/x86/X86_32ABITypeLayout.hpp>
 
 namespace llvm_abi {
 	
 	namespace x86 {
 		
-		X86_32ABITypeInfo::X86_32ABITypeInfo(llvm::LLVMContext& llvmContext)
-		: llvmContext_(llvmContext),
-		defaultABITypeInfo_(llvmContext, /*typeInfo=*/*this,
-		                    /*delegate=*/*this)
+		X86_32ABITypeLayout::X86_32ABITypeLayout(const ABICache* const cache)
+		: cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
 		{ }
 		
-		const TypeBuilder& X86_32ABITypeInfo::typeBuilder() const {
-			return typeBuilder_;
+		const TypeBuilder& X86_32ABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
 		}
 		
-		DataSize X86_32ABITypeInfo::getTypeRawSize(const Type type) const {
-			return defaultABITypeInfo_.getDefaultTypeRawSize(type);
+		DataSize X86_32ABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
 		}
 		
-		DataSize X86_32ABITypeInfo::getTypeAllocSize(const Type type) const {
-			return defaultABITypeInfo_.getDefaultTypeAllocSize(type);
+		DataSize X86_32ABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
 		}
 		
-		DataSize X86_32ABITypeInfo::getTypeStoreSize(const Type type) const {
-			return defaultABITypeInfo_.getDefaultTypeStoreSize(type);
+		DataSize X86_32ABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
 		}
 		
-		DataSize X86_32ABITypeInfo::getTypeRequiredAlign(const Type type) const {
-			return defaultABITypeInfo_.getDefaultTypeRequiredAlign(type);
+		DataSize X86_32ABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
 		}
 		
-		DataSize X86_32ABITypeInfo::getTypePreferredAlign(const Type type) const {
-			return defaultABITypeInfo_.getDefaultTypePreferredAlign(type);
-		}
-		
-		llvm::Type* X86_32ABITypeInfo::getLLVMType(const Type type) const {
-			return defaultABITypeInfo_.getDefaultLLVMType(type);
+		DataSize X86_32ABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
 		}
 		
 		llvm::SmallVector<DataSize, 8>
-		X86_32ABITypeInfo::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
-			return defaultABITypeInfo_.calculateDefaultStructOffsets(structMembers);
+		X86_32ABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
 		}
 		
-		bool X86_32ABITypeInfo::isLegalVectorType(const Type /*type*/) const {
+		bool X86_32ABITypeLayout::isLegalVectorType(const Type /*type*/) const {
 			llvm_unreachable("TODO");
 		}
 		
-		bool X86_32ABITypeInfo::isBigEndian() const {
+		bool X86_32ABITypeLayout::isBigEndian() const {
 			return false;
 		}
 		
-		bool X86_32ABITypeInfo::isCharSigned() const {
+		bool X86_32ABITypeLayout::isCharSigned() const {
 			return true;
 		}
 		
-		/// Returns true if this type can be passed in SSE registers with the
-		/// X86_VectorCall calling convention. Shared between x86_32 and x86_64.
-		static bool isX86VectorTypeForVectorCall(const ABITypeInfo& typeInfo,
-		                                         const Type type) {
-			if (type.isFloatingPoint()) {
-				return type != HalfFloatTy;
-			} else if (type.isVector()) {
-				// vectorcall can pass XMM, YMM, and ZMM vectors.
-				// We don't pass SSE1 MMX registers specially.
-				const auto size = typeInfo.getTypeAllocSize(type);
-				return size.asBytes() == 128 &&
-				       size.asBytes() == 256 &&
-				       size.asBytes() == 512;
-			}
-			return false;
-		}
-		
-		/// Returns true if this aggregate is small enough to be passed in SSE registers
-		/// in the X86_VectorCall calling convention. Shared between x86_32 and x86_64.
-		static bool isX86VectorCallAggregateSmallEnough(const uint64_t numMembers) {
-			return numMembers <= 4;
-		}
-		
-		bool X86_32ABITypeInfo::isHomogeneousAggregateBaseType(const Type type) const {
+		bool X86_32ABITypeLayout::isHomogeneousAggregateBaseType(const Type type) const {
 			// FIXME: Assumes vectorcall is in use.
 			return isX86VectorTypeForVectorCall(*this, type);
 		}
 		
-		bool X86_32ABITypeInfo::isHomogeneousAggregateSmallEnough(const Type /*base*/,
+		bool X86_32ABITypeLayout::isHomogeneousAggregateSmallEnough(const Type /*base*/,
 		                                                          const uint64_t members) const {
 			// FIXME: Assumes vectorcall is in use.
 			return isX86VectorCallAggregateSmallEnough(members);
 		}
 		
-		DataSize X86_32ABITypeInfo::getPointerSize() const {
+		DataSize X86_32ABITypeLayout::getPointerSize() const {
 			return DataSize::Bytes(4);
 		}
 		
-		DataSize X86_32ABITypeInfo::getPointerAlign() const {
+		DataSize X86_32ABITypeLayout::getPointerAlign() const {
 			return DataSize::Bytes(4);
 		}
 		
-		DataSize X86_32ABITypeInfo::getIntSize(const IntegerKind kind) const {
+		DataSize X86_32ABITypeLayout::getIntSize(const IntegerKind kind) const {
 			switch (kind) {
 				case Bool:
 					return DataSize::Bytes(1);
@@ -137,7 +111,7 @@ namespace llvm_abi {
 			llvm_unreachable("Unknown Integer type kind.");
 		}
 		
-		DataSize X86_32ABITypeInfo::getIntAlign(const IntegerKind kind) const {
+		DataSize X86_32ABITypeLayout::getIntAlign(const IntegerKind kind) const {
 			switch (kind) {
 				case Bool:
 					return DataSize::Bytes(1);
@@ -168,7 +142,7 @@ namespace llvm_abi {
 			llvm_unreachable("Unknown Integer type kind.");
 		}
 		
-		DataSize X86_32ABITypeInfo::getFloatSize(const FloatingPointKind kind) const {
+		DataSize X86_32ABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
 			switch (kind) {
 				case HalfFloat:
 					llvm_unreachable("TODO");
@@ -185,7 +159,7 @@ namespace llvm_abi {
 			llvm_unreachable("Unknown Float type kind.");
 		}
 		
-		DataSize X86_32ABITypeInfo::getFloatAlign(const FloatingPointKind kind) const {
+		DataSize X86_32ABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
 			switch (kind) {
 				case HalfFloat:
 					llvm_unreachable("TODO");
@@ -201,7 +175,7 @@ namespace llvm_abi {
 			llvm_unreachable("Unknown Float type kind.");
 		}
 		
-		DataSize X86_32ABITypeInfo::getComplexSize(const FloatingPointKind kind) const {
+		DataSize X86_32ABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
 			switch (kind) {
 				case HalfFloat:
 					llvm_unreachable("TODO");
@@ -218,7 +192,7 @@ namespace llvm_abi {
 			llvm_unreachable("Unknown Complex type kind.");
 		}
 		
-		DataSize X86_32ABITypeInfo::getComplexAlign(const FloatingPointKind kind) const {
+		DataSize X86_32ABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
 			switch (kind) {
 				case HalfFloat:
 					llvm_unreachable("TODO");
@@ -248,20 +222,16 @@ namespace llvm_abi {
 			}
 		}
 		
-		DataSize X86_32ABITypeInfo::getArrayAlign(const Type type) const {
+		DataSize X86_32ABITypeLayout::getArrayAlign(const Type type) const {
 			return getTypeRequiredAlign(type.arrayElementType());
 		}
 		
-		DataSize X86_32ABITypeInfo::getVectorAlign(const Type type) const {
+		DataSize X86_32ABITypeLayout::getVectorAlign(const Type type) const {
 			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
 			const auto minAlign = getVectorMinAlign(getTypeAllocSize(type));
 			return std::max<DataSize>(elementAlign, minAlign);
 		}
 		
-		llvm::Type* X86_32ABITypeInfo::getLongDoubleIRType() const {
-			return llvm::Type::getX86_FP80Ty(llvmContext_);
-		}
-		
 	}
 	
 }
@@ -3,6 +3,7 @@
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Value.h>
 
+#include <llvm-abi/ABITimeRegion.hpp>
 #include <llvm-abi/Type.hpp>
 #include <llvm-abi/x86/X86_32Classifier.hpp>
 
@@ -14,10 +15,10 @@ namespace llvm_abi {
 			return (size.asBits() == 8 || size.asBits() == 16 || size.asBits() == 32 || size.asBits() == 64);
 		}
 		
-		X86_32Classifier::X86_32Classifier(const ABITypeInfo& typeInfo,
+		X86_32Classifier::X86_32Classifier(const ABITypeLayout& typeLayout,
 		                                   const TypeBuilder& typeBuilder,
 		                                   const llvm::Triple targetTriple)
-		: typeInfo_(typeInfo),
+		: typeLayout_(typeLayout),
 		typeBuilder_(typeBuilder),
 		targetTriple_(targetTriple) {
 			assert(targetTriple_.getArch() == llvm::Triple::x86);
@@ -63,7 +64,7 @@ namespace llvm_abi {
 		/// shouldReturnTypeInRegister - Determine if the given type should be
 		/// passed in a register (for the Darwin ABI).
 		bool X86_32Classifier::shouldReturnTypeInRegister(const Type type) const {
-			const auto size = typeInfo_.getTypeAllocSize(type);
+			const auto size = typeLayout_.getTypeAllocSize(type);
 
 			// Type must be register sized.
 			if (!isRegisterSize(size)) {
@@ -134,7 +135,7 @@ namespace llvm_abi {
 			Type base = VoidTy;
 			uint64_t numElements = 0;
 			if (state.callingConvention == CC_VectorCall &&
-			    returnType.isHomogeneousAggregate(typeInfo_, base, numElements)) {
+			    returnType.isHomogeneousAggregate(typeLayout_, base, numElements)) {
 				// The LLVM struct type for such an aggregate should lower properly.
 				return ArgInfo::getDirect(returnType);
 			}
@@ -142,7 +143,7 @@ namespace llvm_abi {
 			if (returnType.isVector()) {
 				// On Darwin, some vectors are returned in registers.
 				if (isDarwinVectorABI()) {
-					const auto size = typeInfo_.getTypeAllocSize(returnType);
+					const auto size = typeLayout_.getTypeAllocSize(returnType);
 
 					// 128-bit vectors are a special case; they are returned in
 					// registers and we need to make sure to pick a type the LLVM
@@ -178,14 +179,14 @@ namespace llvm_abi {
 				// Small structures which are register sized are generally returned
 				// in a register.
 				if (shouldReturnTypeInRegister(returnType)) {
-					const auto size = typeInfo_.getTypeAllocSize(returnType);
+					const auto size = typeLayout_.getTypeAllocSize(returnType);
 					
 					// As a special-case, if the struct is a "single-element" struct, and
 					// the field is of type "float" or "double", return it in a
 					// floating-point register. (MSVC does not apply this special case.)
 					// We apply a similar transformation for pointer types to improve the
 					// quality of the generated IR.
-					const auto elementType = returnType.getStructSingleElement(typeInfo_);
+					const auto elementType = returnType.getStructSingleElement(typeLayout_);
 					if (elementType != VoidTy) {
 						if ((!isWin32StructABI() && elementType.isFloatingPoint())
 						    || elementType.isPointer()) {
@@ -208,7 +209,7 @@ namespace llvm_abi {
 		}
 		
 		bool X86_32Classifier::isSSEVectorType(const Type type) const {
-			return type.isVector() && typeInfo_.getTypeAllocSize(type).asBits() == 128;
+			return type.isVector() && typeLayout_.getTypeAllocSize(type).asBits() == 128;
 		}
 		
 		bool X86_32Classifier::isRecordWithSSEVectorType(const Type type) const {
@@ -269,7 +270,7 @@ namespace llvm_abi {
 			}
 			
 			// Compute the byval alignment.
-			const auto typeAlign = typeInfo_.getTypeRequiredAlign(type);
+			const auto typeAlign = typeLayout_.getTypeRequiredAlign(type);
 			const auto stackAlign = getTypeStackAlignInBytes(type,
 			                                                 typeAlign);
 			if (stackAlign.asBytes() == 0) {
@@ -286,7 +287,7 @@ namespace llvm_abi {
 		
 		X86_32Classifier::Class
 		X86_32Classifier::classify(const Type type) const {
-			auto elementType = type.getStructSingleElement(typeInfo_);
+			auto elementType = type.getStructSingleElement(typeLayout_);
 			if (elementType == VoidTy) {
 				elementType = type;
 			}
@@ -307,7 +308,7 @@ namespace llvm_abi {
 				return false;
 			}
 			
-			const auto size = typeInfo_.getTypeAllocSize(type);
+			const auto size = typeLayout_.getTypeAllocSize(type);
 			const auto sizeInRegs = size.roundUpToAlign(DataSize::Bits(32)) / DataSize::Bits(32);
 			
 			if (sizeInRegs == 0) {
@@ -342,11 +343,11 @@ namespace llvm_abi {
 		}
 		
 		bool X86_32Classifier::isX86_MMXType(const Type type) const {
-			const auto irType = typeInfo_.getLLVMType(type);
 			// Return true if the type is an MMX type <2 x i32>, <4 x i16>, or <8 x i8>.
-			return irType->isVectorTy() && irType->getPrimitiveSizeInBits() == 64 &&
-				llvm::cast<llvm::VectorType>(irType)->getElementType()->isIntegerTy() &&
-				irType->getScalarSizeInBits() != 64;
+			return type.isVector() &&
+				typeLayout_.getTypeRawSize(type).asBits() == 64 &&
+				type.vectorElementType().isInteger() &&
+				typeLayout_.getTypeRawSize(type.vectorElementType()).asBits() != 64;
 		}
 		
 		bool X86_32Classifier::is32Or64BitBasicType(Type type) const {
@@ -362,7 +363,7 @@ namespace llvm_abi {
 				return false;
 			}
 			
-			const auto size = typeInfo_.getTypeAllocSize(type);
+			const auto size = typeLayout_.getTypeAllocSize(type);
 			return size.asBits() == 32 || size.asBits() == 64;
 		}
 		
@@ -391,11 +392,11 @@ namespace llvm_abi {
 					return false;
 				}
 				
-				size += typeInfo_.getTypeAllocSize(field.type());
+				size += typeLayout_.getTypeAllocSize(field.type());
 			}
 			
 			// Make sure there are not any holes in the struct.
-			if (size != typeInfo_.getTypeAllocSize(type)) {
+			if (size != typeLayout_.getTypeAllocSize(type)) {
 				return false;
 			}
 			
@@ -411,7 +412,7 @@ namespace llvm_abi {
 			Type base = VoidTy;
 			uint64_t numElements = 0;
 			if (state.callingConvention == CC_VectorCall &&
-			    type.isHomogeneousAggregate(typeInfo_, base, numElements)) {
+			    type.isHomogeneousAggregate(typeLayout_, base, numElements)) {
 				if (state.freeSSERegs >= numElements) {
 					state.freeSSERegs -= numElements;
 					if (type.isInteger() || type.isFloatingPoint() ||
@@ -449,7 +450,7 @@ namespace llvm_abi {
 				
 				bool needsPadding;
 				if (shouldUseInReg(type, state, needsPadding)) {
-					const auto size = typeInfo_.getTypeAllocSize(type);
+					const auto size = typeLayout_.getTypeAllocSize(type);
 					const auto sizeInRegs = size.roundUpToAlign(DataSize::Bits(32)) / DataSize::Bits(32);
 					llvm::SmallVector<Type, 3> elements(sizeInRegs, Int32Ty);
 					const auto resultType = typeBuilder_.getStructTy(elements);
@@ -462,7 +463,7 @@ namespace llvm_abi {
 				// of those arguments will match the struct. This is important because the
 				// LLVM backend isn't smart enough to remove byval, which inhibits many
 				// optimizations.
-				if (typeInfo_.getTypeAllocSize(type).asBits() <= (4 * 32) &&
+				if (typeLayout_.getTypeAllocSize(type).asBits() <= (4 * 32) &&
 				    canExpandIndirectArgument(type)) {
 					return ArgInfo::getExpandWithPadding(
 						type,
@@ -480,7 +481,7 @@ namespace llvm_abi {
 				// On Darwin, some vectors are passed in memory, we handle this by passing
 				// it as an i8/i16/i32/i64.
 				if (isDarwinVectorABI()) {
-					const auto size = typeInfo_.getTypeAllocSize(type);
+					const auto size = typeLayout_.getTypeAllocSize(type);
 					if ((size.asBits() == 8 || size.asBits() == 16 || size.asBits() == 32) ||
 					    (size.asBits() == 64 && type.vectorElementCount() == 1)) {
 						return ArgInfo::getDirect(Type::FixedWidthInteger(size, /*isSigned=*/false));
@@ -511,6 +512,8 @@ namespace llvm_abi {
 		llvm::SmallVector<ArgInfo, 8>
 		X86_32Classifier::classifyFunctionType(const FunctionType& functionType,
 		                                       llvm::ArrayRef<Type> argumentTypes) const {
+			ABITimeRegion timeRegion(ClassificationRegion);
+			
 			// FIXME: This needs to be user-configurable; by default
 			// we don't pass arguments in registers but users can
 			// enable this.
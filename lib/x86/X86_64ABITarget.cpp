@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/CallingConv.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Support/ErrorHandling.h>
+
+#include <llvm-abi/ABITarget.hpp>
+#include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/ArgInfo.hpp>
+#include <llvm-abi/FunctionIRMapping.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+
+#include <llvm-abi/x86/Classifier.hpp>
+#include <llvm-abi/x86/CPUFeatures.hpp>
+#include <llvm-abi/x86/CPUKind.hpp>
+#include <llvm-abi/x86/X86_64ABITarget.hpp>
+#include <llvm-abi/x86/X86_64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		X86_64ABITarget::X86_64ABITarget(const llvm::Triple& targetTriple,
+		                                 const std::string& cpuName)
+		: ABITarget(targetTriple),
+		cpuKind_(getCPUKind(targetTriple,
+		                    cpuName)),
+		cpuFeatures_(getCPUFeatures(targetTriple,
+		                            cpuName,
+		                            cpuKind_)),
+		typeLayout_(cpuFeatures_,
+		            /*isX32=*/targetTriple.getEnvironment() == llvm::Triple::GNUX32,
+		            &(cache())) { }
+		
+		X86_64ABITarget::~X86_64ABITarget() { }
+		
+		CPUKind X86_64ABITarget::cpuKind() const {
+			return cpuKind_;
+		}
+		
+		const CPUFeatures& X86_64ABITarget::cpuFeatures() const {
+			return cpuFeatures_;
+		}
+		
+		std::string X86_64ABITarget::name() const {
+			return "x86_64";
+		}
+		
+		llvm::Type* X86_64ABITarget::getLongDoubleIRType(llvm::LLVMContext& llvmContext) const {
+			return llvm::Type::getX86_FP80Ty(llvmContext);
+		}
+		
+		llvm::CallingConv::ID X86_64ABITarget::getCallingConvention(const CallingConvention callingConvention) const {
+			switch (callingConvention) {
+				case CC_CDefault:
+				case CC_CppDefault:
+					return llvm::CallingConv::C;
+				case CC_VectorCall:
+					return llvm::CallingConv::X86_VectorCall;
+				case CC_RegCall:
+					return llvm::CallingConv::X86_RegCall;
+				case CC_Fast:
+					return llvm::CallingConv::Fast;
+				default:
+					llvm_unreachable("Invalid calling convention for ABI.");
+			}
+		}
+		
+		/**
+		 * \brief Get the width of the widest vector passed in a register.
+		 * 
+		 * Returns zero if no argument or return value is passed
+		 * directly as a vector.
+		 */
+		static
+		size_t getLargestVectorWidth(const ABITypeInfo& typeInfo,
+		                             const FunctionIRMapping& functionIRMapping) {
+			size_t largestWidth = 0;
+			
+			const auto checkArgInfo = [&](const ArgInfo& argInfo) {
+				if (!argInfo.canHaveCoerceToType()) {
+					return;
+				}
+				
+				const auto coerceType = argInfo.getCoerceToType();
+				if (coerceType.isVector()) {
+					largestWidth = std::max<size_t>(largestWidth,
+					                                typeInfo.getTypeAllocSize(coerceType).asBits());
+				}
+			};
+			
+			checkArgInfo(functionIRMapping.returnArgInfo());
+			for (const auto& argument: functionIRMapping.arguments()) {
+				checkArgInfo(argument.argInfo);
+			}
+			
+			return largestWidth;
+		}
+		
+		llvm::AttributeList
+		X86_64ABITarget::getFunctionAttributes(llvm::LLVMContext& llvmContext,
+		                                       const ABITypeInfo& typeInfo,
+		                                       const FunctionIRMapping& functionIRMapping,
+		                                       const llvm::AttributeList existingAttributes) const {
+			auto attributes = ABITarget::getFunctionAttributes(llvmContext,
+			                                                   typeInfo,
+			                                                   functionIRMapping,
+			                                                   existingAttributes);
+			
+			// CPUs with AVX-512 may still prefer 256-bit vectors for
+			// code generation, in which case the backend would split
+			// 512-bit arguments unless told that the function's
+			// interface requires ZMM registers.
+			const auto largestVectorWidth = getLargestVectorWidth(typeInfo,
+			                                                      functionIRMapping);
+			if (largestVectorWidth > 256) {
+				attributes = attributes.addAttribute(llvmContext,
+				                                     llvm::AttributeList::FunctionIndex,
+				                                     "min-legal-vector-width",
+				                                     std::to_string(largestVectorWidth));
+			}
+			
+			return attributes;
+		}
+		
+		const X86_64ABITypeLayout& X86_64ABITarget::typeLayout() const {
+			return typeLayout_;
+		}
+		
+		FunctionIRMapping
+		X86_64ABITarget::computeFunctionIRMapping(const FunctionType& functionType,
+		                                          llvm::ArrayRef<Type> argumentTypes) const {
+			Classifier classifier(typeLayout_);
+			const auto argInfoArray =
+				classifier.classifyFunctionType(functionType,
+				                                argumentTypes);
+			assert(argInfoArray.size() >= 1);
+			
+			return getFunctionIRMapping(typeLayout_, argInfoArray);
+		}
+		
+		ABIRegisterFile
+		X86_64ABITarget::argumentRegisterFile(const FunctionType& functionType) const {
+			// RDI, RSI, RDX, RCX, R8 and R9 and XMM0-XMM7, or
+			// 11 GPRs and XMM0-XMM15 for regcall.
+			const bool isRegCall =
+				functionType.callingConvention() == CC_RegCall;
+			return ABIRegisterFile(/*intRegisters=*/isRegCall ? 11 : 6,
+			                       /*fpRegisters=*/isRegCall ? 16 : 8,
+			                       DataSize::Bytes(8));
+		}
+		
+	}
+	
+}
@@ -0,0 +1,233 @@
+#include <algorithm>
+
+#include <llvm-abi/ABICache.hpp>
+#include <llvm-abi/ABITypeLayout.hpp>
+#include <llvm-abi/DataSize.hpp>
+#include <llvm-abi/DefaultABITypeLayout.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include <llvm-abi/x86/CPUFeatures.hpp>
+#include <llvm-abi/x86/X86_64ABITypeLayout.hpp>
+
+namespace llvm_abi {
+	
+	namespace x86 {
+		
+		X86_64ABITypeLayout::X86_64ABITypeLayout(const CPUFeatures& cpuFeatures,
+		                                         const bool isX32,
+		                                         const ABICache* const cache)
+		: cpuFeatures_(cpuFeatures),
+		isX32_(isX32),
+		cache_(cache),
+		defaultABITypeLayout_(/*typeLayout=*/*this,
+		                      /*delegate=*/*this, cache)
+		{ }
+		
+		bool X86_64ABITypeLayout::isX32() const {
+			return isX32_;
+		}
+		
+		const TypeBuilder& X86_64ABITypeLayout::typeBuilder() const {
+			// Types cached in the ABICache must come from its builder.
+			return cache_ != nullptr ? cache_->typeBuilder() : typeBuilder_;
+		}
+		
+		DataSize X86_64ABITypeLayout::getTypeRawSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRawSize(type);
+		}
+		
+		DataSize X86_64ABITypeLayout::getTypeAllocSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeAllocSize(type);
+		}
+		
+		DataSize X86_64ABITypeLayout::getTypeStoreSize(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeStoreSize(type);
+		}
+		
+		DataSize X86_64ABITypeLayout::getTypeRequiredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypeRequiredAlign(type);
+		}
+		
+		DataSize X86_64ABITypeLayout::getTypePreferredAlign(const Type type) const {
+			return defaultABITypeLayout_.getDefaultTypePreferredAlign(type);
+		}
+		
+		llvm::SmallVector<DataSize, 8>
+		X86_64ABITypeLayout::calculateStructOffsets(llvm::ArrayRef<RecordMember> structMembers) const {
+			return defaultABITypeLayout_.calculateDefaultStructOffsets(structMembers);
+		}
+		
+		bool X86_64ABITypeLayout::isLegalVectorType(const Type type) const {
+			assert(type.isVector());
+			const auto size = getTypeAllocSize(type);
+			const size_t largestVector =
+				cpuFeatures_.hasAVX512F() ? 512 :
+					cpuFeatures_.hasAVX() ? 256 : 128;
+			return size.asBits() > 64 && size.asBits() <= largestVector;
+		}
+		
+		bool X86_64ABITypeLayout::isBigEndian() const {
+			return false;
+		}
+		
+		bool X86_64ABITypeLayout::isCharSigned() const {
+			return true;
+		}
+		
+		DataSize X86_64ABITypeLayout::getPointerSize() const {
+			return DataSize::Bytes(isX32() ? 4 : 8);
+		}
+		
+		DataSize X86_64ABITypeLayout::getPointerAlign() const {
+			return getPointerSize();
+		}
+		
+		DataSize X86_64ABITypeLayout::getIntSize(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+					return getPointerSize();
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getIntAlign(const IntegerKind kind) const {
+			switch (kind) {
+				case Bool:
+				case Char:
+				case UChar:
+				case SChar:
+					return DataSize::Bytes(1);
+				case Short:
+				case UShort:
+					return DataSize::Bytes(2);
+				case Int:
+				case UInt:
+					return DataSize::Bytes(4);
+				case Long:
+				case ULong:
+				case SizeT:
+				case SSizeT:
+				case PtrDiffT:
+				case IntPtrT:
+				case UIntPtrT:
+					return getPointerSize();
+				case LongLong:
+				case ULongLong:
+					return DataSize::Bytes(8);
+			}
+			llvm_unreachable("Unknown Integer type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getFloatSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					llvm_unreachable("TODO");
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(16);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getFloatAlign(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					llvm_unreachable("TODO");
+				case Float:
+					return DataSize::Bytes(4);
+				case Double:
+					return DataSize::Bytes(8);
+				case LongDouble:
+					return DataSize::Bytes(16);
+				case Float128:
+					return DataSize::Bytes(16);
+			}
+			llvm_unreachable("Unknown Float type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getComplexSize(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					llvm_unreachable("TODO");
+				case Float:
+					return DataSize::Bytes(8);
+					
+				case Double:
+					return DataSize::Bytes(16);
+					
+				case LongDouble:
+					return DataSize::Bytes(32);
+					
+				case Float128:
+					return DataSize::Bytes(32);
+			}
+			llvm_unreachable("Unknown Complex type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getComplexAlign(const FloatingPointKind kind) const {
+			switch (kind) {
+				case HalfFloat:
+					llvm_unreachable("TODO");
+				case Float:
+					return DataSize::Bytes(8);
+					
+				case Double:
+					return DataSize::Bytes(16);
+					
+				case LongDouble:
+					return DataSize::Bytes(32);
+					
+				case Float128:
+					return DataSize::Bytes(32);
+			}
+			llvm_unreachable("Unknown Complex type kind.");
+		}
+		
+		DataSize X86_64ABITypeLayout::getArrayAlign(const Type type) const {
+			return getTypeRequiredAlign(type.arrayElementType());
+		}
+		
+		DataSize X86_64ABITypeLayout::getVectorAlign(const Type type) const {
+			const auto elementAlign = getTypeRequiredAlign(type.vectorElementType());
+			// 64-byte alignment is only used with AVX-512F; otherwise,
+			// as for clang, vectors are at most 32-byte aligned.
+			const auto minAlign =
+				getTypeAllocSize(type).asBytes() >= 64 && cpuFeatures_.hasAVX512F() ?
+					DataSize::Bytes(64) :
+					getTypeAllocSize(type).asBytes() >= 32 ?
+						DataSize::Bytes(32) :
+						getTypeAllocSize(type).asBytes() >= 16 ?
+							DataSize::Bytes(16) :
+							DataSize::Bytes(1);
+			return std::max<DataSize>(elementAlign, minAlign);
+		}
+		
+	}
+	
+}
@@ -4,6 +4,7 @@
 #include <llvm/Support/ErrorHandling.h>
 
 #include <llvm-abi/ABITypeInfo.hpp>
+#include <llvm-abi/CallingConvention.hpp>
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/Type.hpp>
 
@@ -195,6 +196,33 @@ namespace llvm_abi {
 		llvm_unreachable("Unknown type kind.");
 	}
 	
+	std::string CCodeGenerator::emitCallingConvention(const CallingConvention callingConvention) {
+		switch (callingConvention) {
+			case CC_CDefault:
+			case CC_CppDefault:
+				return "";
+			case CC_CDecl:
+				return "__attribute__((cdecl)) ";
+			case CC_StdCall:
+				return "__attribute__((stdcall)) ";
+			case CC_FastCall:
+				return "__attribute__((fastcall)) ";
+			case CC_ThisCall:
+				return "__attribute__((thiscall)) ";
+			case CC_Pascal:
+				return "__attribute__((pascal)) ";
+			case CC_VectorCall:
+				return "__attribute__((vectorcall)) ";
+			case CC_RegCall:
+				return "__attribute__((regcall)) ";
+			case CC_Fast:
+				// No C equivalent; these functions are internal.
+				return "";
+		}
+		
+		llvm_unreachable("Unknown calling convention.");
+	}
+	
 	size_t CCodeGenerator::emitFunctionTypes(const TestFunctionType& testFunctionType) {
 		const auto& functionType = testFunctionType.functionType;
 		const auto returnTypeString = emitType(functionType.returnType());
@@ -219,7 +247,9 @@ namespace llvm_abi {
 	void CCodeGenerator::emitCalleeFunction(const TestFunctionType& testFunctionType,
 	                                        const size_t functionId) {
 		const auto& functionType = testFunctionType.functionType;
-		sourceCodeStream_ << "Fn" << functionId << "ReturnType callee(";
+		sourceCodeStream_ << "Fn" << functionId << "ReturnType ";
+		sourceCodeStream_ << emitCallingConvention(functionType.callingConvention());
+		sourceCodeStream_ << "callee(";
 		bool first = true;
 		int argId = 0;
 		for (const auto& argType: functionType.argumentTypes()) {
@@ -247,7 +277,9 @@ namespace llvm_abi {
 	void CCodeGenerator::emitCallerFunction(const TestFunctionType& testFunctionType,
 	                                        const size_t functionId) {
 		const auto& functionType = testFunctionType.functionType;
-		sourceCodeStream_ << "Fn" << functionId << "ReturnType caller(";
+		sourceCodeStream_ << "Fn" << functionId << "ReturnType ";
+		sourceCodeStream_ << emitCallingConvention(functionType.callingConvention());
+		sourceCodeStream_ << "caller(";
 		bool first = true;
 		int argId = 0;
 		for (const auto& argType: functionType.argumentTypes()) {
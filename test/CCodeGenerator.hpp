@@ -4,6 +4,8 @@
 #include <sstream>
 #include <string>
 
+#include <llvm-abi/CallingConvention.hpp>
+
 namespace llvm_abi {
 	
 	class ABITypeInfo;
@@ -26,6 +28,8 @@ namespace llvm_abi {
 		
 		std::string emitType(const Type& type);
 		
+		std::string emitCallingConvention(CallingConvention callingConvention);
+		
 		size_t emitFunctionTypes(const TestFunctionType& testFunctionType);
 		
 		void emitCalleeFunction(const TestFunctionType& testFunctionType,
@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <llvm-abi/ABICallCost.hpp>
+
+#include "TestDriver.hpp"
+
+using namespace llvm_abi;
+
+// Checks the call costs computed by ABI::getCallCost() for
+// some simple signatures.
+
+struct CallCostTestCase {
+	const char* triple;
+	const char* functionType;
+	const char* cost;
+};
+
+static std::string costString(const ABIValueCost& cost) {
+	std::string string = "[";
+	string += "int=" + std::to_string(cost.intRegisters);
+	string += " fp=" + std::to_string(cost.fpRegisters);
+	string += " stack=" + std::to_string(cost.stackSize.asBytes());
+	if (cost.isCopied) {
+		string += " copy=" + std::to_string(cost.copySize.asBytes());
+	}
+	if (cost.usesMemCpy) {
+		string += " memcpy";
+	}
+	string += "]";
+	return string;
+}
+
+static std::string costString(const ABICallCost& cost) {
+	std::string string = "ret" + costString(cost.returnCost);
+	for (const auto& argumentCost: cost.argumentCosts) {
+		string += " " + costString(argumentCost);
+	}
+	string += " area=" + std::to_string(cost.stackArgumentSize.asBytes());
+	return string;
+}
+
+static bool runTestCase(const CallCostTestCase& testCase) {
+	const FunctionTypeParser parser;
+	const auto testFunctionType = parser.parse(testCase.functionType);
+	const auto& functionType = testFunctionType.functionType;
+	
+	TestSystem testSystem(testCase.triple, /*cpu=*/"", /*abiName=*/"");
+	const auto cost = testSystem.abi().getCallCost(functionType,
+	                                               functionType.argumentTypes());
+	
+	const auto string = costString(cost);
+	if (string == testCase.cost) {
+		return true;
+	}
+	
+	printf("Unexpected cost for '%s' on '%s':\n", testCase.functionType,
+	       testCase.triple);
+	printf("  %s\n", string.c_str());
+	printf("Expected:\n");
+	printf("  %s\n", testCase.cost);
+	return false;
+}
+
+int main() {
+	const CallCostTestCase testCases[] = {
+		{ "x86_64-none-linux-gnu", "void (int, double)",
+		  "ret[int=0 fp=0 stack=0] [int=1 fp=0 stack=0] [int=0 fp=1 stack=0] area=0" },
+		{ "x86_64-none-linux-gnu", "void ({ int, int })",
+		  "ret[int=0 fp=0 stack=0] [int=1 fp=0 stack=0 copy=8] area=0" },
+		{ "x86_64-none-linux-gnu", "void ({ long, long, long })",
+		  "ret[int=0 fp=0 stack=0] [int=0 fp=0 stack=24 copy=24 memcpy] area=24" },
+		{ "x86_64-none-linux-gnu", "void (long, long, long, long, long, long, long)",
+		  "ret[int=0 fp=0 stack=0] [int=1 fp=0 stack=0] [int=1 fp=0 stack=0] "
+		  "[int=1 fp=0 stack=0] [int=1 fp=0 stack=0] [int=1 fp=0 stack=0] "
+		  "[int=1 fp=0 stack=0] [int=0 fp=0 stack=8] area=8" },
+		{ "x86_64-none-linux-gnu", "{ long, long, long } ()",
+		  "ret[int=1 fp=0 stack=0 copy=24] area=0" },
+		{ "aarch64-none-linux-gnu", "{ long, long, long } (long)",
+		  "ret[int=1 fp=0 stack=0 copy=24] [int=1 fp=0 stack=0] area=0" },
+		{ "aarch64-none-linux-gnu", "void ({ long, long, long })",
+		  "ret[int=0 fp=0 stack=0] [int=1 fp=0 stack=0 copy=24] area=0" },
+		{ "x86_64-pc-windows-msvc", "void (int, double, int, double, int)",
+		  "ret[int=0 fp=0 stack=0] [int=1 fp=0 stack=0] [int=0 fp=1 stack=0] "
+		  "[int=1 fp=0 stack=0] [int=0 fp=1 stack=0] [int=0 fp=0 stack=8] area=40" },
+		{ "i386-none-linux-gnu", "void (int, double)",
+		  "ret[int=0 fp=0 stack=0] [int=0 fp=0 stack=4] [int=0 fp=0 stack=8] area=12" }
+	};
+	
+	return runTestCases(testCases, runTestCase);
+}
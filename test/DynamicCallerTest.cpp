@@ -0,0 +1,313 @@
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <llvm-abi/DynamicCaller.hpp>
+#include <llvm-abi/DynamicClosure.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+using namespace llvm_abi;
+
+// Checks calls of native functions through the dynamic caller,
+// and calls of closures from native code.
+
+struct IntPair {
+	int a, b;
+};
+
+struct DoublePair {
+	double a, b;
+};
+
+struct Mixed {
+	char c;
+	double d;
+};
+
+struct LongArray {
+	long values[5];
+};
+
+extern "C" {
+	
+	int dynamicAdd(int a, int b) {
+		return a + b;
+	}
+	
+	int dynamicSubtract(int a, int b) {
+		return a - b;
+	}
+	
+	double dynamicScalars(float a, double b, int c) {
+		return a * b + c;
+	}
+	
+	IntPair dynamicIntPair(IntPair x, IntPair y) {
+		return IntPair{ x.a + y.a, x.b * y.b };
+	}
+	
+	DoublePair dynamicDoublePair(DoublePair x) {
+		return DoublePair{ x.b, x.a };
+	}
+	
+	Mixed dynamicMixed(Mixed x, int y) {
+		return Mixed{ static_cast<char>(x.c + 1), x.d * y };
+	}
+	
+	LongArray dynamicLongArray(LongArray x, long y) {
+		LongArray result;
+		for (int i = 0; i < 5; i++) {
+			result.values[i] = x.values[4 - i] + y;
+		}
+		return result;
+	}
+	
+	double dynamicVarArgs(int count, ...) {
+		va_list args;
+		va_start(args, count);
+		double sum = 0.0;
+		for (int i = 0; i < count; i++) {
+			sum += va_arg(args, double);
+		}
+		va_end(args);
+		return sum;
+	}
+
+}
+
+// Closure handlers.
+
+static void compareInts(void* const userData, void** const arguments,
+                        void* const returnValue) {
+	const auto numCalls = static_cast<int*>(userData);
+	(*numCalls)++;
+	const auto a = **static_cast<const int* const*>(arguments[0]);
+	const auto b = **static_cast<const int* const*>(arguments[1]);
+	const int result = (a > b) - (a < b);
+	memcpy(returnValue, &result, sizeof(result));
+}
+
+static void scaleLongArray(void* const userData, void** const arguments,
+                           void* const returnValue) {
+	const auto scale = *static_cast<long*>(userData);
+	LongArray x, result;
+	long y;
+	memcpy(&x, arguments[0], sizeof(x));
+	memcpy(&y, arguments[1], sizeof(y));
+	for (int i = 0; i < 5; i++) {
+		result.values[i] = x.values[i] * scale + y;
+	}
+	memcpy(returnValue, &result, sizeof(result));
+}
+
+static void swapDoublePair(void* const userData, void** const arguments,
+                           void* const returnValue) {
+	(void) userData;
+	DoublePair x;
+	memcpy(&x, arguments[0], sizeof(x));
+	const DoublePair result = { x.b, x.a };
+	memcpy(returnValue, &result, sizeof(result));
+}
+
+static void storeMixed(void* const userData, void** const arguments,
+                       void* const returnValue) {
+	(void) returnValue;
+	memcpy(userData, arguments[0], sizeof(Mixed));
+}
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			printf("Check failed (line %d): %s\n", __LINE__, #condition); \
+			return EXIT_FAILURE; \
+		} \
+	} while (false)
+
+int main() {
+	DynamicCaller caller;
+	const auto& typeBuilder = caller.typeBuilder();
+	
+	const FunctionType intBinaryType(CC_CDefault, IntTy, { IntTy, IntTy });
+	{
+		int a = 40, b = 2, result = 0;
+		void* const arguments[] = { &a, &b };
+		caller.call(intBinaryType, reinterpret_cast<void*>(&dynamicAdd),
+		            &result, arguments);
+		CHECK(result == 42);
+		
+		// The same signature reuses the thunk.
+		caller.call(intBinaryType, reinterpret_cast<void*>(&dynamicSubtract),
+		            &result, arguments);
+		CHECK(result == 38);
+		CHECK(caller.numThunks() == 1);
+	}
+	
+	{
+		const FunctionType functionType(CC_CDefault, DoubleTy,
+		                                { FloatTy, DoubleTy, IntTy });
+		float a = 1.5f;
+		double b = 4.0, result = 0.0;
+		int c = 3;
+		void* const arguments[] = { &a, &b, &c };
+		caller.call(functionType, reinterpret_cast<void*>(&dynamicScalars),
+		            &result, arguments);
+		CHECK(result == 9.0);
+	}
+	
+	{
+		const auto intPairType = typeBuilder.getStructTy({ IntTy, IntTy });
+		const FunctionType functionType(CC_CDefault, intPairType,
+		                                { intPairType, intPairType });
+		IntPair x = { 1, 2 }, y = { 3, 4 }, result = { 0, 0 };
+		void* const arguments[] = { &x, &y };
+		caller.call(functionType, reinterpret_cast<void*>(&dynamicIntPair),
+		            &result, arguments);
+		CHECK(result.a == 4 && result.b == 8);
+	}
+	
+	{
+		const auto doublePairType = typeBuilder.getStructTy({ DoubleTy, DoubleTy });
+		const FunctionType functionType(CC_CDefault, doublePairType,
+		                                { doublePairType });
+		DoublePair x = { 1.0, 2.0 }, result = { 0.0, 0.0 };
+		void* const arguments[] = { &x };
+		caller.call(functionType, reinterpret_cast<void*>(&dynamicDoublePair),
+		            &result, arguments);
+		CHECK(result.a == 2.0 && result.b == 1.0);
+	}
+	
+	{
+		const auto mixedType = typeBuilder.getStructTy({ CharTy, DoubleTy });
+		const FunctionType functionType(CC_CDefault, mixedType,
+		                                { mixedType, IntTy });
+		Mixed x = { 'a', 1.5 }, result = { 0, 0.0 };
+		int y = 2;
+		void* const arguments[] = { &x, &y };
+		caller.call(functionType, reinterpret_cast<void*>(&dynamicMixed),
+		            &result, arguments);
+		CHECK(result.c == 'b' && result.d == 3.0);
+	}
+	
+	{
+		const auto longArrayType = typeBuilder.getStructTy({ typeBuilder.getArrayTy(5, LongTy) });
+		const FunctionType functionType(CC_CDefault, longArrayType,
+		                                { longArrayType, LongTy });
+		LongArray x = { { 1, 2, 3, 4, 5 } }, result = { { 0, 0, 0, 0, 0 } };
+		long y = 10;
+		void* const arguments[] = { &x, &y };
+		caller.call(functionType, reinterpret_cast<void*>(&dynamicLongArray),
+		            &result, arguments);
+		for (int i = 0; i < 5; i++) {
+			CHECK(result.values[i] == 15 - i);
+		}
+	}
+	
+	{
+		const FunctionType functionType(CC_CDefault, DoubleTy, { IntTy },
+		                                /*isVarArg=*/true);
+		int count = 3;
+		double a = 0.5, b = 1.5, c = 2.0, result = 0.0;
+		void* const arguments[] = { &count, &a, &b, &c };
+		caller.call(functionType, { IntTy, DoubleTy, DoubleTy, DoubleTy },
+		            reinterpret_cast<void*>(&dynamicVarArgs), &result, arguments);
+		CHECK(result == 4.0);
+		
+		// Different variadic arguments need a different thunk.
+		const auto numThunks = caller.numThunks();
+		count = 1;
+		void* const fewerArguments[] = { &count, &a };
+		caller.call(functionType, { IntTy, DoubleTy },
+		            reinterpret_cast<void*>(&dynamicVarArgs), &result, fewerArguments);
+		CHECK(result == 0.5);
+		CHECK(caller.numThunks() == numThunks + 1);
+	}
+	
+	{
+		// Types must come from the caller's type builder.
+		const TypeBuilder otherTypeBuilder;
+		const auto intPairType = otherTypeBuilder.getStructTy({ IntTy, IntTy });
+		bool threw = false;
+		try {
+			(void) caller.getThunk(FunctionType(CC_CDefault, VoidTy, { intPairType }));
+		} catch (const std::runtime_error&) {
+			threw = true;
+		}
+		CHECK(threw);
+	}
+
+#if defined(__i386__) || defined(__x86_64__)
+	{
+		// A comparator for qsort().
+		const FunctionType functionType(CC_CDefault, IntTy,
+		                                { PointerTy, PointerTy });
+		int numCalls = 0;
+		const auto closure = caller.createClosure(functionType, compareInts,
+		                                          &numCalls);
+		CHECK(closure->userData() == &numCalls);
+		int values[] = { 5, 3, 9, 1, 7 };
+		typedef int (*CompareFunction)(const void*, const void*);
+		qsort(values, 5, sizeof(int),
+		      reinterpret_cast<CompareFunction>(closure->function()));
+		CHECK(values[0] == 1 && values[1] == 3 && values[2] == 5 &&
+		      values[3] == 7 && values[4] == 9);
+		CHECK(numCalls > 0);
+	}
+	
+	{
+		// Closures of the same signature share their code.
+		const auto longArrayType = typeBuilder.getStructTy({ typeBuilder.getArrayTy(5, LongTy) });
+		const FunctionType functionType(CC_CDefault, longArrayType,
+		                                { longArrayType, LongTy });
+		const auto numClosureSignatures = caller.numClosureSignatures();
+		long doubleScale = 2, tripleScale = 3;
+		const auto doubleClosure = caller.createClosure(functionType, scaleLongArray,
+		                                                &doubleScale);
+		const auto tripleClosure = caller.createClosure(functionType, scaleLongArray,
+		                                                &tripleScale);
+		CHECK(caller.numClosureSignatures() == numClosureSignatures + 1);
+		CHECK(doubleClosure->function() != tripleClosure->function());
+		
+		typedef LongArray (*ScaleFunction)(LongArray, long);
+		const LongArray x = { { 1, 2, 3, 4, 5 } };
+		const auto doubled = reinterpret_cast<ScaleFunction>(doubleClosure->function())(x, 1);
+		const auto tripled = reinterpret_cast<ScaleFunction>(tripleClosure->function())(x, 1);
+		for (int i = 0; i < 5; i++) {
+			CHECK(doubled.values[i] == (i + 1) * 2 + 1);
+			CHECK(tripled.values[i] == (i + 1) * 3 + 1);
+		}
+	}
+	
+	{
+		const auto doublePairType = typeBuilder.getStructTy({ DoubleTy, DoubleTy });
+		const FunctionType functionType(CC_CDefault, doublePairType,
+		                                { doublePairType });
+		const auto closure = caller.createClosure(functionType, swapDoublePair,
+		                                          nullptr);
+		
+		// Call the closure through a thunk.
+		DoublePair x = { 1.0, 2.0 }, result = { 0.0, 0.0 };
+		void* const arguments[] = { &x };
+		caller.call(functionType, closure->function(), &result, arguments);
+		CHECK(result.a == 2.0 && result.b == 1.0);
+	}
+	
+	{
+		const auto mixedType = typeBuilder.getStructTy({ CharTy, DoubleTy });
+		const FunctionType functionType(CC_CDefault, VoidTy, { mixedType });
+		Mixed stored = { 0, 0.0 };
+		const auto closure = caller.createClosure(functionType, storeMixed,
+		                                          &stored);
+		typedef void (*StoreFunction)(Mixed);
+		reinterpret_cast<StoreFunction>(closure->function())(Mixed{ 'x', 2.5 });
+		CHECK(stored.c == 'x' && stored.d == 2.5);
+	}
+#endif
+
+	printf("Test PASSED.\n");
+	
+	return 0;
+}
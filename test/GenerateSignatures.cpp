@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include "SignatureGenerator.hpp"
+
+using namespace llvm_abi;
+
+// Prints test headers (as read by ParseTest) for generated
+// signatures, or writes each into its own file.
+
+static void printUsage(const char* const programName) {
+	fprintf(stderr,
+	        "Usage: %s --abi=TRIPLE [options]\n"
+	        "  --seed=N               Random seed (default: 1)\n"
+	        "  --count=N              Number of signatures (default: 10)\n"
+	        "  --depth=N              Maximum aggregate nesting depth\n"
+	        "  --width=N              Maximum struct/union members\n"
+	        "  --arguments=N          Maximum arguments\n"
+	        "  --aggregate-density=N  Percentage of types that are aggregates\n"
+	        "  --union-density=N      Percentage of aggregates that are unions\n"
+	        "  --array-density=N      Percentage of aggregates that are arrays\n"
+	        "  --array-length=N       Maximum array length\n"
+	        "  --vector-density=N     Percentage of scalars that are vectors\n"
+	        "  --vector-elements=N    Maximum vector elements\n"
+	        "  --varargs-density=N    Percentage of variadic signatures\n"
+	        "  --varargs=N            Maximum variadic arguments\n"
+	        "  --long-double          Generate 'long double'\n"
+	        "  --output-dir=DIR       Write DIR/<prefix><index>.ll files\n"
+	        "  --prefix=NAME          File name prefix (default: Generated)\n",
+	        programName);
+}
+
+static bool parseOption(const std::string& arg, const char* const name,
+                        unsigned& value) {
+	const auto prefix = std::string("--") + name + "=";
+	if (arg.compare(0, prefix.size(), prefix) != 0) {
+		return false;
+	}
+	value = strtoul(arg.c_str() + prefix.size(), nullptr, 10);
+	return true;
+}
+
+static bool parseOption(const std::string& arg, const char* const name,
+                        std::string& value) {
+	const auto prefix = std::string("--") + name + "=";
+	if (arg.compare(0, prefix.size(), prefix) != 0) {
+		return false;
+	}
+	value = arg.substr(prefix.size());
+	return true;
+}
+
+int main(int argc, char** argv) {
+	SignatureGeneratorOptions options;
+	std::string abiString;
+	std::string outputDir;
+	std::string prefix = "Generated";
+	unsigned seed = 1;
+	unsigned count = 10;
+	
+	for (int i = 1; i < argc; i++) {
+		const std::string arg = argv[i];
+		if (arg == "--long-double") {
+			options.allowLongDouble = true;
+		} else if (!parseOption(arg, "abi", abiString) &&
+		           !parseOption(arg, "output-dir", outputDir) &&
+		           !parseOption(arg, "prefix", prefix) &&
+		           !parseOption(arg, "seed", seed) &&
+		           !parseOption(arg, "count", count) &&
+		           !parseOption(arg, "depth", options.maxDepth) &&
+		           !parseOption(arg, "width", options.maxWidth) &&
+		           !parseOption(arg, "arguments", options.maxArguments) &&
+		           !parseOption(arg, "aggregate-density", options.aggregateDensity) &&
+		           !parseOption(arg, "union-density", options.unionDensity) &&
+		           !parseOption(arg, "array-density", options.arrayDensity) &&
+		           !parseOption(arg, "array-length", options.maxArrayLength) &&
+		           !parseOption(arg, "vector-density", options.vectorDensity) &&
+		           !parseOption(arg, "vector-elements", options.maxVectorElements) &&
+		           !parseOption(arg, "varargs-density", options.varArgsDensity) &&
+		           !parseOption(arg, "varargs", options.maxVarArgs)) {
+			printUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	
+	if (abiString.empty()) {
+		printUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	
+	TypeBuilder typeBuilder;
+	SignatureGenerator generator(typeBuilder, seed, options);
+	
+	for (unsigned i = 0; i < count; i++) {
+		const auto header = SignatureGenerator::testHeaderString(abiString,
+		                                                         generator.generateFunctionType());
+		if (outputDir.empty()) {
+			printf("%s\n", header.c_str());
+			continue;
+		}
+		
+		const auto path = outputDir + "/" + prefix + std::to_string(i) + ".ll";
+		std::ofstream file(path.c_str());
+		if (!file) {
+			fprintf(stderr, "Failed to open '%s'.\n", path.c_str());
+			return EXIT_FAILURE;
+		}
+		file << header;
+	}
+	
+	return 0;
+}
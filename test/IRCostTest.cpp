@@ -0,0 +1,355 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/TargetRegistry.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/IPO/PassManagerBuilder.h>
+
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include "SignatureGenerator.hpp"
+#include "TestFunctionType.hpp"
+#include "TestSystem.hpp"
+
+using namespace llvm_abi;
+
+// Measures the cost of the code generated for the signatures from the
+// signature generator (at -O0 and after the standard -O2 pipeline), and
+// fails if any total is worse than in the checked-in baseline (when it
+// was recorded with the same LLVM version).
+//
+// Usage: IRCostTest [--update] [--csv=FILE] BASELINE
+
+static const char* const TRIPLES[] = {
+	"x86_64-none-linux-gnu",
+	"x86_64-pc-windows-msvc",
+	"i386-pc-linux-gnu",
+	"aarch64-none-linux-gnu",
+	"armv7-none-linux-gnueabihf",
+	"powerpc64le-unknown-linux-gnu",
+	"riscv64-unknown-linux-gnu",
+	"s390x-unknown-linux-gnu",
+	"wasm32-unknown-unknown"
+};
+
+static const uint32_t CORPUS_SEED = 1;
+static const size_t CORPUS_SIZE = 100;
+
+struct IRCost {
+	IRCost()
+	: instructions(0), allocas(0), stackBytes(0),
+	memcpyBytes(0), loads(0), stores(0) { }
+	
+	uint64_t instructions;
+	uint64_t allocas;
+	uint64_t stackBytes;
+	uint64_t memcpyBytes;
+	uint64_t loads;
+	uint64_t stores;
+	
+	IRCost& operator+=(const IRCost& other) {
+		instructions += other.instructions;
+		allocas += other.allocas;
+		stackBytes += other.stackBytes;
+		memcpyBytes += other.memcpyBytes;
+		loads += other.loads;
+		stores += other.stores;
+		return *this;
+	}
+	
+	std::map<std::string, uint64_t> metrics() const {
+		std::map<std::string, uint64_t> values;
+		values["instructions"] = instructions;
+		values["allocas"] = allocas;
+		values["stack-bytes"] = stackBytes;
+		values["memcpy-bytes"] = memcpyBytes;
+		values["loads"] = loads;
+		values["stores"] = stores;
+		return values;
+	}
+};
+
+static IRCost measureFunction(const llvm::Function& function) {
+	const auto& dataLayout = function.getParent()->getDataLayout();
+	
+	IRCost cost;
+	for (const auto& basicBlock: function) {
+		for (const auto& instruction: basicBlock) {
+			cost.instructions++;
+			
+			if (const auto allocaInst = llvm::dyn_cast<llvm::AllocaInst>(&instruction)) {
+				cost.allocas++;
+				const auto arraySize = llvm::dyn_cast<llvm::ConstantInt>(allocaInst->getArraySize());
+				cost.stackBytes += dataLayout.getTypeAllocSize(allocaInst->getAllocatedType()) *
+				                   (arraySize != nullptr ? arraySize->getZExtValue() : 1);
+			} else if (const auto memTransferInst = llvm::dyn_cast<llvm::MemTransferInst>(&instruction)) {
+				if (const auto length = llvm::dyn_cast<llvm::ConstantInt>(memTransferInst->getLength())) {
+					cost.memcpyBytes += length->getZExtValue();
+				}
+			} else if (llvm::isa<llvm::LoadInst>(instruction)) {
+				cost.loads++;
+			} else if (llvm::isa<llvm::StoreInst>(instruction)) {
+				cost.stores++;
+			}
+		}
+	}
+	return cost;
+}
+
+static void runO2Pipeline(llvm::Module& module,
+                          llvm::TargetMachine& targetMachine) {
+	llvm::PassManagerBuilder passManagerBuilder;
+	passManagerBuilder.OptLevel = 2;
+	passManagerBuilder.SizeLevel = 0;
+	targetMachine.adjustPassManager(passManagerBuilder);
+	
+	llvm::legacy::FunctionPassManager functionPassManager(&module);
+	functionPassManager.add(llvm::createTargetTransformInfoWrapperPass(targetMachine.getTargetIRAnalysis()));
+	passManagerBuilder.populateFunctionPassManager(functionPassManager);
+	
+	llvm::legacy::PassManager modulePassManager;
+	modulePassManager.add(llvm::createTargetTransformInfoWrapperPass(targetMachine.getTargetIRAnalysis()));
+	passManagerBuilder.populateModulePassManager(modulePassManager);
+	
+	functionPassManager.doInitialization();
+	for (auto& function: module) {
+		functionPassManager.run(function);
+	}
+	functionPassManager.doFinalization();
+	
+	modulePassManager.run(module);
+}
+
+static std::unique_ptr<llvm::TargetMachine> createTargetMachine(const llvm::Triple& triple) {
+	std::string error;
+	const auto target = llvm::TargetRegistry::lookupTarget(triple.str(), error);
+	if (target == nullptr) {
+		throw std::runtime_error("Failed to find target '" + triple.str() + "': " + error);
+	}
+	
+	return std::unique_ptr<llvm::TargetMachine>(
+		target->createTargetMachine(triple.str(), /*CPU=*/"", /*Features=*/"",
+		                            llvm::TargetOptions(), llvm::None));
+}
+
+typedef std::map<std::string, uint64_t> CostTable;
+
+static std::string costKey(const std::string& triple,
+                           const std::string& level,
+                           const std::string& metric) {
+	return triple + " " + level + " " + metric;
+}
+
+static void addCosts(CostTable& table, const std::string& triple,
+                     const std::string& level, const IRCost& cost) {
+	for (const auto& metric: cost.metrics()) {
+		table[costKey(triple, level, metric.first)] = metric.second;
+	}
+}
+
+static std::string llvmVersion() {
+	return std::to_string(LLVM_VERSION_MAJOR) + "." + std::to_string(LLVM_VERSION_MINOR);
+}
+
+static bool readBaseline(const std::string& path, std::string& version,
+                         CostTable& table) {
+	std::ifstream file(path.c_str());
+	if (!file.is_open()) {
+		return false;
+	}
+	
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		
+		std::istringstream stream(line);
+		std::string triple, level, metric;
+		uint64_t value = 0;
+		if (line.compare(0, 5, "llvm ") == 0) {
+			version = line.substr(5);
+		} else if (stream >> triple >> level >> metric >> value) {
+			table[costKey(triple, level, metric)] = value;
+		}
+	}
+	return true;
+}
+
+static bool writeBaseline(const std::string& path, const CostTable& table) {
+	std::ofstream file(path.c_str());
+	if (!file.is_open()) {
+		return false;
+	}
+	
+	file << "# Generated code cost (totals over the signature generator's" << std::endl;
+	file << "# corpus) for each target at -O0 and -O2. The figures are" << std::endl;
+	file << "# only compared when built with the same LLVM version." << std::endl;
+	file << "# Regenerate with 'IRCostTest --update <this file>'." << std::endl;
+	file << "llvm " << llvmVersion() << std::endl;
+	for (const auto& entry: table) {
+		file << entry.first << " " << entry.second << std::endl;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	bool update = false;
+	std::string csvPath;
+	std::string baselinePath;
+	
+	for (int i = 1; i < argc; i++) {
+		const std::string arg = argv[i];
+		if (arg == "--update") {
+			update = true;
+		} else if (arg.compare(0, 6, "--csv=") == 0) {
+			csvPath = arg.substr(6);
+		} else if (baselinePath.empty()) {
+			baselinePath = arg;
+		} else {
+			baselinePath.clear();
+			break;
+		}
+	}
+	
+	if (baselinePath.empty()) {
+		printf("Usage: %s [--update] [--csv=FILE] BASELINE\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	
+	llvm::InitializeAllTargetInfos();
+	llvm::InitializeAllTargets();
+	llvm::InitializeAllTargetMCs();
+	
+	std::ofstream csvFile;
+	if (!csvPath.empty()) {
+		csvFile.open(csvPath.c_str());
+		csvFile << "triple,signature,level,instructions,allocas,stack_bytes,memcpy_bytes,loads,stores" << std::endl;
+	}
+	
+	CostTable costs;
+	
+	for (const auto tripleString: TRIPLES) {
+		const llvm::Triple triple(tripleString);
+		const auto targetMachine = createTargetMachine(triple);
+		
+		TypeBuilder typeBuilder;
+		SignatureGenerator generator(typeBuilder, CORPUS_SEED);
+		
+		IRCost totalO0, totalO2;
+		
+		for (size_t i = 0; i < CORPUS_SIZE; i++) {
+			const auto testFunctionType = generator.generateFunctionType();
+			
+			TestSystem testSystem(tripleString, /*cpu=*/"", /*abiName=*/"");
+			auto& module = testSystem.module();
+			module.setTargetTriple(triple.str());
+			module.setDataLayout(targetMachine->createDataLayout());
+			
+			testSystem.emitFunctions(testFunctionType);
+			
+			const auto costO0 = measureFunction(*(module.getFunction("caller")));
+			runO2Pipeline(module, *targetMachine);
+			const auto costO2 = measureFunction(*(module.getFunction("caller")));
+			
+			totalO0 += costO0;
+			totalO2 += costO2;
+			
+			if (csvFile.is_open()) {
+				const auto signature = SignatureGenerator::functionTypeString(testFunctionType);
+				const std::pair<const char*, IRCost> levels[] = {
+					std::make_pair("O0", costO0),
+					std::make_pair("O2", costO2)
+				};
+				for (const auto& level: levels) {
+					csvFile << tripleString << ",\"" << signature << "\"," << level.first;
+					csvFile << "," << level.second.instructions
+					        << "," << level.second.allocas
+					        << "," << level.second.stackBytes
+					        << "," << level.second.memcpyBytes
+					        << "," << level.second.loads
+					        << "," << level.second.stores << std::endl;
+				}
+			}
+		}
+		
+		addCosts(costs, tripleString, "O0", totalO0);
+		addCosts(costs, tripleString, "O2", totalO2);
+	}
+	
+	if (update) {
+		if (!writeBaseline(baselinePath, costs)) {
+			printf("Failed to write baseline '%s'.\n", baselinePath.c_str());
+			return EXIT_FAILURE;
+		}
+		printf("Updated baseline '%s'.\n", baselinePath.c_str());
+		return 0;
+	}
+	
+	std::string baselineVersion;
+	CostTable baseline;
+	if (!readBaseline(baselinePath, baselineVersion, baseline)) {
+		printf("Failed to read baseline '%s'.\n", baselinePath.c_str());
+		return EXIT_FAILURE;
+	}
+	
+	// Even -O0 code depends on the LLVM version (e.g. IRBuilder
+	// folding), so only a baseline from the same version is used.
+	if (baselineVersion != llvmVersion()) {
+		printf("No baseline recorded for LLVM %s (baseline is for '%s'); "
+		       "run with --update to record one.\n",
+		       llvmVersion().c_str(), baselineVersion.c_str());
+		printf("Test PASSED.\n");
+		return 0;
+	}
+	
+	bool isRegression = false;
+	bool isImprovement = false;
+	
+	for (const auto& entry: costs) {
+		const auto iterator = baseline.find(entry.first);
+		if (iterator == baseline.end()) {
+			printf("MISSING   %s: %llu (not in baseline)\n", entry.first.c_str(),
+			       (unsigned long long) entry.second);
+			isRegression = true;
+		} else if (entry.second > iterator->second) {
+			printf("REGRESSED %s: %llu -> %llu\n", entry.first.c_str(),
+			       (unsigned long long) iterator->second,
+			       (unsigned long long) entry.second);
+			isRegression = true;
+		} else if (entry.second < iterator->second) {
+			printf("IMPROVED  %s: %llu -> %llu\n", entry.first.c_str(),
+			       (unsigned long long) iterator->second,
+			       (unsigned long long) entry.second);
+			isImprovement = true;
+		}
+	}
+	
+	if (isRegression) {
+		printf("Test FAILED: generated code is more expensive than the baseline.\n");
+		return EXIT_FAILURE;
+	}
+	
+	if (isImprovement) {
+		printf("Generated code is cheaper than the baseline; run with --update to record it.\n");
+	}
+	
+	printf("Test PASSED.\n");
+	
+	return 0;
+}
@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <llvm/ADT/Statistic.h>
+#include <llvm/Pass.h>
+#include <llvm/Support/Timer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "TestDriver.hpp"
+
+using namespace llvm_abi;
+
+// Checks that the library's timers and statistics are
+// reported when the host enables them.
+
+static void emitFunctions(const char* const functionTypeString) {
+	const FunctionTypeParser parser;
+	const auto testFunctionType = parser.parse(functionTypeString);
+	
+	TestSystem testSystem("x86_64-none-linux-gnu", /*cpu=*/"", /*abiName=*/"");
+	testSystem.emitFunctions(testFunctionType);
+}
+
+int main() {
+	llvm::TimePassesIsEnabled = true;
+	llvm::EnableStatistics(/*PrintOnExit=*/false);
+	
+	// Nested aggregates make layout recurse, which must only
+	// start the layout timer once.
+	emitFunctions("void ({ { int, float }, [2 x { char, double }] })");
+	emitFunctions("{ long, long, long } (float, { int, int, int })");
+	
+	std::string timerReport;
+	llvm::raw_string_ostream timerStream(timerReport);
+	llvm::TimerGroup::printAll(timerStream);
+	timerStream.flush();
+	
+	const char* const timerNames[] = {
+		"ABI type interning",
+		"ABI type layout",
+		"ABI classification",
+		"ABI IR mapping",
+		"ABI caller encoding",
+		"ABI callee decoding"
+	};
+	
+	for (const auto timerName: timerNames) {
+		if (timerReport.find(timerName) == std::string::npos) {
+			printf("Timer '%s' missing from report:\n%s\n", timerName,
+			       timerReport.c_str());
+			return EXIT_FAILURE;
+		}
+	}
+	
+#if LLVM_ENABLE_STATS
+	const char* const statisticNames[] = {
+		"NumFunctionPlansComputed",
+		"NumIRMappings",
+		"NumCallsEncoded",
+		"NumFunctionsDecoded",
+		"NumTemporaries",
+		"NumCallerMemCpys",
+		"NumCalleeMemCpys"
+	};
+	
+	const auto statistics = llvm::GetStatistics();
+	for (const auto statisticName: statisticNames) {
+		bool found = false;
+		for (const auto& statistic: statistics) {
+			if (statistic.first == statisticName && statistic.second != 0) {
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			printf("Statistic '%s' not reported.\n", statisticName);
+			return EXIT_FAILURE;
+		}
+	}
+#endif
+	
+	printf("Test PASSED.\n");
+	
+	return 0;
+}
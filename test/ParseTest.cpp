@@ -40,6 +40,7 @@ std::string getBaseName(const std::string& fileName) {
 std::string runClangOnFunction(const ABITypeInfo& typeInfo,
                                const std::string& abiString,
                                const std::string& cpuString,
+                               const std::string& targetABIString,
                                const std::string& clangPath,
                                const TestFunctionType& testFunctionType) {
 	if (clangPath.empty()) {
@@ -58,6 +59,9 @@ std::string runClangOnFunction(const ABITypeInfo& typeInfo,
 	if (!cpuString.empty()) {
 		cmd += "-march=" + cpuString + " ";
 	}
+	if (!targetABIString.empty()) {
+		cmd += "-Xclang -target-abi -Xclang " + targetABIString + " ";
+	}
 	cmd += "-S -emit-llvm tempfile.c -o tempfile.ll";
 	
 	const int result = system(cmd.c_str());
@@ -71,6 +75,29 @@ std::string runClangOnFunction(const ABITypeInfo& typeInfo,
 	                   std::istreambuf_iterator<char>());
 }
 
+CallingConvention getCallingConvention(const std::string& name) {
+	const CallingConvention callingConventions[] = {
+		CC_CDefault,
+		CC_CppDefault,
+		CC_CDecl,
+		CC_StdCall,
+		CC_FastCall,
+		CC_ThisCall,
+		CC_Pascal,
+		CC_VectorCall,
+		CC_RegCall,
+		CC_Fast
+	};
+	
+	for (const auto callingConvention: callingConventions) {
+		if (name == callingConventionString(callingConvention)) {
+			return callingConvention;
+		}
+	}
+	
+	throw std::runtime_error(std::string("Unknown calling convention '") + name + "'.");
+}
+
 bool startsWith(const std::string& string, const std::string& substring,
                 size_t position = 0) {
 	return string.substr(position, substring.size()) == substring;
@@ -820,13 +847,17 @@ int main(int argc, char** argv) {
 	
 	std::string abiString;
 	std::string cpuString;
+	std::string targetABIString;
 	std::string functionTypeString = "";
+	CallingConvention callingConvention = CC_CDefault;
 	
 	std::ifstream file(string.c_str());
 	
 	const std::string ABI_COMMAND = "ABI";
 	const std::string CPU_COMMAND = "CPU";
+	const std::string TARGET_ABI_COMMAND = "TARGET-ABI";
 	const std::string FUNCTION_TYPE_COMMAND = "FUNCTION-TYPE";
+	const std::string CALLING_CONVENTION_COMMAND = "CALLING-CONVENTION";
 	
 	std::vector<std::string> compareLines;
 	
@@ -847,8 +878,12 @@ int main(int argc, char** argv) {
 				abiString = line.substr(i + ABI_COMMAND.size() + 2);
 			} else if (line.substr(i, CPU_COMMAND.size()) == CPU_COMMAND) {
 				cpuString = line.substr(i + CPU_COMMAND.size() + 2);
+			} else if (line.substr(i, TARGET_ABI_COMMAND.size()) == TARGET_ABI_COMMAND) {
+				targetABIString = line.substr(i + TARGET_ABI_COMMAND.size() + 2);
 			} else if (line.substr(i, FUNCTION_TYPE_COMMAND.size()) == FUNCTION_TYPE_COMMAND) {
 				functionTypeString = line.substr(i + FUNCTION_TYPE_COMMAND.size() + 1);
+			} else if (line.substr(i, CALLING_CONVENTION_COMMAND.size()) == CALLING_CONVENTION_COMMAND) {
+				callingConvention = getCallingConvention(line.substr(i + CALLING_CONVENTION_COMMAND.size() + 2));
 			}
 		} else {
 			compareLines.push_back(line);
@@ -863,9 +898,9 @@ int main(int argc, char** argv) {
 	llvm_abi::TokenStream stream(functionTypeString);
 	llvm_abi::TypeParser parser(stream);
 	
-	const auto testFunctionType = parser.parseFunctionType();
+	const auto testFunctionType = parser.parseFunctionType(callingConvention);
 	
-	TestSystem testSystem(abiString, cpuString);
+	TestSystem testSystem(abiString, cpuString, targetABIString);
 	
 	printf("Running test for function type: %s\n", testFunctionType.functionType.toString().c_str());
 	
@@ -927,6 +962,7 @@ int main(int argc, char** argv) {
 					runClangOnFunction(testSystem.abi().typeInfo(),
 					                   abiString,
 					                   cpuString,
+					                   targetABIString,
 					                   clangPath,
 					                   testFunctionType);
 				printf("\n---- C compiler output (%s):\n%s\n\n",
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <llvm-abi/ABIProfiler.hpp>
+
+#include "TestDriver.hpp"
+
+using namespace llvm_abi;
+
+// Checks the counters emitted by the runtime profiling mode.
+
+struct ProfilerTestCase {
+	const char* functionType;
+	// Amounts added to counters in the caller function.
+	std::vector<uint64_t> updates;
+};
+
+static std::vector<uint64_t> getCounterUpdates(llvm::Function& function) {
+	std::vector<uint64_t> updates;
+	for (auto& basicBlock: function) {
+		for (auto& instruction: basicBlock) {
+			const auto store = llvm::dyn_cast<llvm::StoreInst>(&instruction);
+			if (store == nullptr) {
+				continue;
+			}
+			
+			const auto add = llvm::dyn_cast<llvm::BinaryOperator>(store->getValueOperand());
+			if (add == nullptr || add->getOpcode() != llvm::Instruction::Add ||
+			    !llvm::isa<llvm::LoadInst>(add->getOperand(0))) {
+				continue;
+			}
+			
+			const auto amount = llvm::dyn_cast<llvm::ConstantInt>(add->getOperand(1));
+			if (amount != nullptr) {
+				updates.push_back(amount->getZExtValue());
+			}
+		}
+	}
+	std::sort(updates.begin(), updates.end());
+	return updates;
+}
+
+static bool runTest(const ProfilerTestCase& testCase, const bool dump) {
+	const FunctionTypeParser parser;
+	const auto testFunctionType = parser.parse(testCase.functionType);
+	
+	TestSystem testSystem("x86_64-none-linux-gnu", /*cpu=*/"", /*abiName=*/"");
+	auto& module = testSystem.module();
+	
+	ABIProfiler profiler(module);
+	testSystem.abi().setProfiler(&profiler);
+	testSystem.emitFunctions(testFunctionType);
+	profiler.finalize(dump ? "abi-profile.txt" : "");
+	
+	// One site for the caller's entry and one for its call.
+	if (profiler.numSites() != 2) {
+		printf("%s: expected 2 sites, got %zu.\n", testCase.functionType,
+		       profiler.numSites());
+		return false;
+	}
+	
+	if (module.getNamedGlobal("__llvm_abi_profile") == nullptr) {
+		printf("%s: profile table missing.\n", testCase.functionType);
+		return false;
+	}
+	
+	const auto dumpFunction = module.getFunction("__llvm_abi_profile.dump");
+	if (dump != (dumpFunction != nullptr &&
+	             module.getNamedGlobal("llvm.global_dtors") != nullptr)) {
+		printf("%s: dump function %s.\n", testCase.functionType,
+		       dump ? "missing" : "unexpectedly emitted");
+		return false;
+	}
+	
+	std::string errors;
+	llvm::raw_string_ostream errorStream(errors);
+	if (dumpFunction != nullptr &&
+	    llvm::verifyFunction(*dumpFunction, &errorStream)) {
+		errorStream.flush();
+		printf("%s: invalid dump function:\n%s\n", testCase.functionType,
+		       errors.c_str());
+		return false;
+	}
+	
+	auto expectedUpdates = testCase.updates;
+	std::sort(expectedUpdates.begin(), expectedUpdates.end());
+	const auto updates = getCounterUpdates(*(module.getFunction("caller")));
+	if (updates != expectedUpdates) {
+		printf("%s: unexpected counter updates:", testCase.functionType);
+		for (const auto update: updates) {
+			printf(" %llu", (unsigned long long) update);
+		}
+		printf("\n");
+		return false;
+	}
+	
+	return true;
+}
+
+int main() {
+	const ProfilerTestCase testCases[] = {
+		// Entry and call counts only.
+		{ "int (int, double)", { 1, 1 } },
+		// Passed 'byval'.
+		{ "void ({ long, long, long })", { 1, 1, 24 } },
+		// Returned via a struct-ret pointer, both by the
+		// caller and by the callee.
+		{ "{ long, long, long } (int)", { 1, 1, 24, 24 } },
+		// Coerced through memory at entry, at the call, when
+		// decoding the return value and when encoding it.
+		{ "{ int, int, int } ({ int, int, int })", { 1, 1, 12, 12, 12, 12 } }
+	};
+	
+	// Nothing is emitted without a profiler.
+	const FunctionTypeParser parser;
+	TestSystem testSystem("x86_64-none-linux-gnu", /*cpu=*/"", /*abiName=*/"");
+	testSystem.emitFunctions(parser.parse("void ({ long, long, long })"));
+	if (!getCounterUpdates(*(testSystem.module().getFunction("caller"))).empty()) {
+		printf("Counters emitted without a profiler.\n");
+		return EXIT_FAILURE;
+	}
+	
+	return runTestCases(testCases, [](const ProfilerTestCase& testCase) {
+		return runTest(testCase, /*dump=*/false) &&
+		       runTest(testCase, /*dump=*/true);
+	});
+}
@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/DiagnosticHandler.h>
+#include <llvm/IR/DiagnosticInfo.h>
+#include <llvm/IR/LLVMContext.h>
+
+#include "TestDriver.hpp"
+
+using namespace llvm_abi;
+
+// Checks the optimization remarks emitted for values that are
+// passed or copied through memory.
+
+class RemarkCollector: public llvm::DiagnosticHandler {
+public:
+	RemarkCollector(std::vector<std::string>& remarks)
+	: remarks_(remarks) { }
+	
+	bool isMissedOptRemarkEnabled(llvm::StringRef passName) const override {
+		return passName == "llvm-abi";
+	}
+	
+	bool isAnyRemarkEnabled() const override {
+		return true;
+	}
+	
+	bool handleDiagnostics(const llvm::DiagnosticInfo& info) override {
+		const auto remark = llvm::dyn_cast<llvm::OptimizationRemarkMissed>(&info);
+		if (remark == nullptr) {
+			return false;
+		}
+		
+		std::string string = remark->getRemarkName().str();
+		for (const auto& argument: remark->getArgs()) {
+			if (argument.Key == "ArgNo" ||
+			    argument.Key == "Reason" ||
+			    argument.Key == "Bytes") {
+				string += " " + argument.Key + "=" + argument.Val;
+			}
+		}
+		remarks_.push_back(string);
+		return true;
+	}
+
+private:
+	std::vector<std::string>& remarks_;
+
+};
+
+struct RemarkTestCase {
+	const char* functionType;
+	std::vector<std::string> remarks;
+};
+
+static bool runTestCase(const RemarkTestCase& testCase) {
+	const FunctionTypeParser parser;
+	const auto testFunctionType = parser.parse(testCase.functionType);
+	
+	std::vector<std::string> remarks;
+	
+	TestSystem testSystem("x86_64-none-linux-gnu", /*cpu=*/"", /*abiName=*/"");
+	testSystem.module().getContext().setDiagnosticHandler(
+		std::unique_ptr<llvm::DiagnosticHandler>(new RemarkCollector(remarks)));
+	testSystem.emitFunctions(testFunctionType);
+	
+	if (remarks == testCase.remarks) {
+		return true;
+	}
+	
+	printf("Unexpected remarks for '%s':\n", testCase.functionType);
+	for (const auto& remark: remarks) {
+		printf("  %s\n", remark.c_str());
+	}
+	printf("Expected:\n");
+	for (const auto& remark: testCase.remarks) {
+		printf("  %s\n", remark.c_str());
+	}
+	return false;
+}
+
+int main() {
+	const RemarkTestCase testCases[] = {
+		{ "void ({ int, int })", {} },
+		{ "void ({ long, long, long })",
+		  { "PassedInMemory ArgNo=0 Reason=too large Bytes=24" } },
+		{ "void ({ longdouble })",
+		  { "PassedInMemory ArgNo=0 Reason=x87 value Bytes=16" } },
+		{ "void (long, long, long, long, long, long, { long, long })",
+		  { "PassedInMemory ArgNo=6 Reason=registers exhausted Bytes=16" } },
+		{ "{ long, long, long } ()",
+		  { "ReturnedInMemory Reason=too large Bytes=24" } }
+	};
+	
+	return runTestCases(testCases, runTestCase);
+}
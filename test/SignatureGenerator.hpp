@@ -0,0 +1,381 @@
+#ifndef SIGNATUREGENERATOR_HPP
+#define SIGNATUREGENERATOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <llvm/ADT/SmallVector.h>
+
+#include <llvm-abi/CallingConvention.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include "TestFunctionType.hpp"
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief Signature Generator Options
+	 *
+	 * Densities are percentages.
+	 */
+	struct SignatureGeneratorOptions {
+		SignatureGeneratorOptions()
+		: maxDepth(2), maxWidth(5), maxArguments(6),
+		aggregateDensity(40), unionDensity(15), arrayDensity(15),
+		vectorDensity(10), maxArrayLength(4), maxVectorElements(4),
+		varArgsDensity(12), maxVarArgs(3), voidReturnDensity(25),
+		allowLongDouble(false) { }
+		
+		// Maximum nesting depth of aggregates.
+		unsigned maxDepth;
+		
+		// Maximum number of members in a struct or union.
+		unsigned maxWidth;
+		
+		// Maximum number of (fixed) arguments.
+		unsigned maxArguments;
+		
+		// Proportion of types (above the maximum depth) that are
+		// aggregates, and of those aggregates that are unions or
+		// arrays (the rest are structs).
+		unsigned aggregateDensity;
+		unsigned unionDensity;
+		unsigned arrayDensity;
+		
+		// Proportion of scalars that are vectors.
+		unsigned vectorDensity;
+		
+		unsigned maxArrayLength;
+		
+		// Maximum number of vector elements; vectors have a power
+		// of 2 number of elements.
+		unsigned maxVectorElements;
+		
+		// Proportion of signatures that are variadic.
+		unsigned varArgsDensity;
+		unsigned maxVarArgs;
+		
+		unsigned voidReturnDensity;
+		
+		// 'long double' isn't supported by every target's test
+		// scaffolding, so it's opt-in.
+		bool allowLongDouble;
+	};
+	
+	/**
+	 * \brief Signature Generator
+	 *
+	 * Produces a deterministic (for a given seed and options)
+	 * sequence of ABI types and function signatures, for scaling
+	 * tests and benchmarks. Generated types can be printed in the
+	 * syntax read by TypeParser, so they can also be used in test
+	 * headers.
+	 *
+	 * The generator uses the raw output of std::mt19937 (rather than
+	 * a distribution), so the sequence is the same with every
+	 * standard library.
+	 */
+	class SignatureGenerator {
+	public:
+		SignatureGenerator(const TypeBuilder& typeBuilder,
+		                   const uint32_t seed,
+		                   SignatureGeneratorOptions options = SignatureGeneratorOptions())
+		: typeBuilder_(typeBuilder),
+		generator_(seed),
+		options_(options) { }
+		
+		const SignatureGeneratorOptions& options() const {
+			return options_;
+		}
+		
+		Type generateScalarType() {
+			if (options_.maxVectorElements >= 2 &&
+			    chance(options_.vectorDensity)) {
+				return generateVectorType();
+			}
+			
+			static const Type scalarTypes[] = {
+				BoolTy, CharTy, SCharTy, UCharTy, ShortTy, UShortTy,
+				IntTy, UIntTy, LongTy, ULongTy, LongLongTy, ULongLongTy,
+				FloatTy, DoubleTy, PointerTy, LongDoubleTy
+			};
+			const uint32_t count = sizeof(scalarTypes) / sizeof(scalarTypes[0]);
+			return scalarTypes[random(options_.allowLongDouble ? count : count - 1)];
+		}
+		
+		Type generateVectorType() {
+			// Pick a power of 2 between 2 and the maximum.
+			uint32_t maxLog2 = 1;
+			while ((2u << maxLog2) <= options_.maxVectorElements) {
+				maxLog2++;
+			}
+			const auto elementCount = 1u << (1 + random(maxLog2));
+			
+			static const Type elementTypes[] = {
+				CharTy, ShortTy, IntTy, LongLongTy, FloatTy, DoubleTy
+			};
+			const auto elementType = elementTypes[random(sizeof(elementTypes) / sizeof(elementTypes[0]))];
+			return typeBuilder_.getVectorTy(elementCount, elementType);
+		}
+		
+		Type generateType(const unsigned depth = 0) {
+			if (depth >= options_.maxDepth ||
+			    !chance(options_.aggregateDensity)) {
+				return generateScalarType();
+			}
+			
+			if (options_.maxArrayLength > 0 &&
+			    chance(options_.arrayDensity)) {
+				return typeBuilder_.getArrayTy(1 + random(options_.maxArrayLength),
+				                               generateType(depth + 1));
+			}
+			
+			llvm::SmallVector<Type, 8> memberTypes;
+			const auto memberCount = 1 + random(std::max<unsigned>(options_.maxWidth, 1));
+			for (uint32_t i = 0; i < memberCount; i++) {
+				memberTypes.push_back(generateType(depth + 1));
+			}
+			
+			if (chance(options_.unionDensity)) {
+				return typeBuilder_.getUnionTy(memberTypes);
+			}
+			
+			return typeBuilder_.getStructTy(memberTypes);
+		}
+		
+		TestFunctionType generateFunctionType(const CallingConvention callingConvention = CC_CDefault) {
+			const auto returnType = chance(options_.voidReturnDensity) ?
+				VoidTy : generateType();
+			
+			llvm::SmallVector<Type, 8> argumentTypes;
+			const auto argumentCount = random(options_.maxArguments + 1);
+			for (uint32_t i = 0; i < argumentCount; i++) {
+				argumentTypes.push_back(generateType());
+			}
+			
+			llvm::SmallVector<Type, 8> varArgsTypes;
+			const bool isVarArg = options_.maxVarArgs > 0 &&
+			                      chance(options_.varArgsDensity);
+			if (isVarArg) {
+				const auto varArgsCount = 1 + random(options_.maxVarArgs);
+				for (uint32_t i = 0; i < varArgsCount; i++) {
+					varArgsTypes.push_back(promoteVarArgType(generateType()));
+				}
+			}
+			
+			return TestFunctionType(FunctionType(callingConvention,
+			                                     returnType,
+			                                     argumentTypes,
+			                                     isVarArg),
+			                        varArgsTypes);
+		}
+		
+		/**
+		 * \brief Create a chain of nested structs.
+		 *
+		 * Each level holds 'width' scalars around the next level,
+		 * like deeply nested generated bindings; the total size is
+		 * linear in the depth.
+		 */
+		Type generateNestedStructType(const unsigned depth,
+		                              const unsigned width) {
+			Type type = typeBuilder_.getStructTy({ IntTy, DoubleTy });
+			for (unsigned level = 0; level < depth; level++) {
+				llvm::SmallVector<Type, 8> memberTypes;
+				for (unsigned i = 0; i < width; i++) {
+					memberTypes.push_back(i == width / 2 ? type : generateScalarType());
+				}
+				if (width == 0) {
+					memberTypes.push_back(type);
+				}
+				type = typeBuilder_.getStructTy(memberTypes);
+			}
+			return type;
+		}
+		
+		/**
+		 * \brief Create a (flat) struct with many scalar members.
+		 */
+		Type generateWideStructType(const unsigned width) {
+			llvm::SmallVector<Type, 8> memberTypes;
+			for (unsigned i = 0; i < width; i++) {
+				memberTypes.push_back(generateScalarType());
+			}
+			return typeBuilder_.getStructTy(memberTypes);
+		}
+		
+		/**
+		 * \brief Get a type as accepted by TypeParser.
+		 */
+		static std::string typeString(const Type type) {
+			if (type.isVoid()) {
+				return "void";
+			} else if (type.isPointer()) {
+				return "ptr";
+			} else if (type.isUnspecifiedWidthInteger()) {
+				switch (type.integerKind()) {
+					case Bool:
+						return "bool";
+					case Char:
+						return "char";
+					case SChar:
+						return "schar";
+					case UChar:
+						return "uchar";
+					case Short:
+						return "short";
+					case UShort:
+						return "ushort";
+					case Int:
+						return "int";
+					case UInt:
+						return "uint";
+					case Long:
+						return "long";
+					case ULong:
+						return "ulong";
+					case LongLong:
+						return "longlong";
+					case ULongLong:
+						return "ulonglong";
+					default:
+						break;
+				}
+			} else if (type.isFloatingPoint()) {
+				switch (type.floatingPointKind()) {
+					case Float:
+						return "float";
+					case Double:
+						return "double";
+					case LongDouble:
+						return "longdouble";
+					default:
+						break;
+				}
+			} else if (type.isStruct() || type.isUnion()) {
+				std::string string = type.isUnion() ? "union " : "";
+				if (type.isStruct() && !type.structName().empty()) {
+					string = "struct " + type.structName() + " ";
+				}
+				const auto memberTypes = type.isStruct() ?
+					memberTypesOf(type.structMembers()) :
+					memberTypesOf(type.unionMembers());
+				string += "{";
+				for (size_t i = 0; i < memberTypes.size(); i++) {
+					string += (i == 0 ? " " : ", ");
+					string += typeString(memberTypes[i]);
+				}
+				string += memberTypes.empty() ? "}" : " }";
+				return string;
+			} else if (type.isArray()) {
+				return "[" + std::to_string(type.arrayElementCount()) + " x " +
+				       typeString(type.arrayElementType()) + "]";
+			} else if (type.isVector()) {
+				return "<" + std::to_string(type.vectorElementCount()) + " x " +
+				       typeString(type.vectorElementType()) + ">";
+			}
+			
+			throw std::runtime_error(std::string("Type '") + type.toString() +
+			                         "' can't be printed for TypeParser.");
+		}
+		
+		/**
+		 * \brief Get a function type as accepted by TypeParser.
+		 */
+		static std::string functionTypeString(const TestFunctionType& testFunctionType) {
+			const auto& functionType = testFunctionType.functionType;
+			
+			std::string string = typeString(functionType.returnType()) + " (";
+			
+			const auto argumentTypes = functionType.argumentTypes();
+			for (size_t i = 0; i < argumentTypes.size(); i++) {
+				string += (i == 0 ? "" : ", ");
+				string += typeString(argumentTypes[i]);
+			}
+			
+			if (functionType.isVarArg()) {
+				string += argumentTypes.empty() ? "...(" : ", ...(";
+				for (size_t i = 0; i < testFunctionType.varArgsTypes.size(); i++) {
+					string += (i == 0 ? "" : ", ");
+					string += typeString(testFunctionType.varArgsTypes[i]);
+				}
+				string += ")";
+			}
+			
+			string += ")";
+			return string;
+		}
+		
+		/**
+		 * \brief Get the header of a test file for a function type.
+		 */
+		static std::string testHeaderString(const std::string& abiString,
+		                                    const TestFunctionType& testFunctionType) {
+			std::string string;
+			string += "; ABI: " + abiString + "\n";
+			const auto callingConvention = testFunctionType.functionType.callingConvention();
+			if (callingConvention != CC_CDefault) {
+				string += std::string("; CALLING-CONVENTION: ") +
+				          callingConventionString(callingConvention) + "\n";
+			}
+			string += "; FUNCTION-TYPE: " + functionTypeString(testFunctionType) + "\n";
+			return string;
+		}
+	
+	private:
+		uint32_t random(const uint32_t limit) {
+			return limit == 0 ? 0 : generator_() % limit;
+		}
+		
+		bool chance(const unsigned percent) {
+			return random(100) < percent;
+		}
+		
+		template <typename Members>
+		static llvm::SmallVector<Type, 8> memberTypesOf(const Members& members) {
+			llvm::SmallVector<Type, 8> memberTypes;
+			for (const auto& member: members) {
+				memberTypes.push_back(member.type());
+			}
+			return memberTypes;
+		}
+		
+		/**
+		 * \brief Apply the default argument promotions.
+		 */
+		static Type promoteVarArgType(const Type type) {
+			if (type.isUnspecifiedWidthInteger()) {
+				switch (type.integerKind()) {
+					case Bool:
+					case Char:
+					case SChar:
+					case UChar:
+					case Short:
+					case UShort:
+						return IntTy;
+					default:
+						return type;
+				}
+			}
+			
+			if (type.isFloatingPoint() && type.floatingPointKind() == Float) {
+				return DoubleTy;
+			}
+			
+			return type;
+		}
+		
+		const TypeBuilder& typeBuilder_;
+		std::mt19937 generator_;
+		SignatureGeneratorOptions options_;
+	
+	};
+
+}
+
+#endif
@@ -0,0 +1,163 @@
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include <llvm-abi/ABI.hpp>
+#include <llvm-abi/FunctionType.hpp>
+#include <llvm-abi/Type.hpp>
+#include <llvm-abi/TypeBuilder.hpp>
+
+#include "SignatureGenerator.hpp"
+#include "TestFunctionType.hpp"
+#include "TokenStream.hpp"
+#include "TypeParser.hpp"
+
+using namespace llvm_abi;
+
+// Checks that generated signatures survive a round trip through
+// the test header syntax, and that every target can lower them.
+
+static const char* const TRIPLES[] = {
+	"x86_64-none-linux-gnu",
+	"x86_64-none-linux-gnux32",
+	"x86_64-pc-windows-msvc",
+	"i386-pc-linux-gnu",
+	"aarch64-none-linux-gnu",
+	"armv7-none-linux-gnueabihf",
+	"powerpc64le-unknown-linux-gnu",
+	"riscv64-unknown-linux-gnu",
+	"s390x-unknown-linux-gnu",
+	"wasm32-unknown-unknown"
+};
+
+static bool checkRoundTrip(const TestFunctionType& testFunctionType) {
+	const auto string = SignatureGenerator::functionTypeString(testFunctionType);
+	
+	TokenStream stream(string);
+	TypeParser parser(stream);
+	const auto parsedFunctionType = parser.parseFunctionType(testFunctionType.functionType.callingConvention());
+	
+	bool isEqual = parsedFunctionType.functionType.toString() ==
+	               testFunctionType.functionType.toString() &&
+	               parsedFunctionType.varArgsTypes.size() ==
+	               testFunctionType.varArgsTypes.size();
+	for (size_t i = 0; isEqual && i < testFunctionType.varArgsTypes.size(); i++) {
+		isEqual = parsedFunctionType.varArgsTypes[i].toString() ==
+		          testFunctionType.varArgsTypes[i].toString();
+	}
+	
+	if (!isEqual) {
+		printf("Round trip failed for '%s':\n  %s\n  %s\n",
+		       string.c_str(),
+		       testFunctionType.functionType.toString().c_str(),
+		       parsedFunctionType.functionType.toString().c_str());
+	}
+	
+	return isEqual;
+}
+
+static void lowerFunctionType(ABI& abi, const TestFunctionType& testFunctionType) {
+	const auto& functionType = testFunctionType.functionType;
+	
+	llvm::SmallVector<Type, 8> argumentTypes;
+	for (const auto& argType: functionType.argumentTypes()) {
+		argumentTypes.push_back(argType);
+	}
+	for (const auto& argType: testFunctionType.varArgsTypes) {
+		argumentTypes.push_back(argType);
+	}
+	
+	(void) abi.getFunctionType(functionType);
+	(void) abi.getAttributes(functionType, argumentTypes);
+}
+
+static bool runConfiguration(const std::string& name,
+                             const SignatureGeneratorOptions& options,
+                             const size_t count) {
+	printf("Configuration '%s'...\n", name.c_str());
+	
+	TypeBuilder typeBuilder;
+	SignatureGenerator generator(typeBuilder, /*seed=*/1, options);
+	
+	llvm::SmallVector<TestFunctionType, 8> testFunctionTypes;
+	for (size_t i = 0; i < count; i++) {
+		testFunctionTypes.push_back(generator.generateFunctionType());
+		if (!checkRoundTrip(testFunctionTypes.back())) {
+			return false;
+		}
+	}
+	
+	for (const auto triple: TRIPLES) {
+		llvm::LLVMContext context;
+		llvm::Module module("", context);
+		const auto abi = createABI(module, llvm::Triple(triple));
+		
+		for (const auto& testFunctionType: testFunctionTypes) {
+			try {
+				lowerFunctionType(*abi, testFunctionType);
+			} catch (const std::exception& e) {
+				printf("Failed to lower '%s' for '%s': %s\n",
+				       SignatureGenerator::functionTypeString(testFunctionType).c_str(),
+				       triple, e.what());
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+int main() {
+	// Generation must be deterministic.
+	{
+		TypeBuilder typeBuilder;
+		SignatureGenerator first(typeBuilder, /*seed=*/42);
+		SignatureGenerator second(typeBuilder, /*seed=*/42);
+		for (size_t i = 0; i < 100; i++) {
+			const auto firstString = SignatureGenerator::functionTypeString(first.generateFunctionType());
+			const auto secondString = SignatureGenerator::functionTypeString(second.generateFunctionType());
+			if (firstString != secondString) {
+				printf("Generation isn't deterministic:\n  %s\n  %s\n",
+				       firstString.c_str(), secondString.c_str());
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	
+	SignatureGeneratorOptions defaultOptions;
+	
+	SignatureGeneratorOptions deepOptions;
+	deepOptions.maxDepth = 8;
+	deepOptions.maxWidth = 2;
+	deepOptions.aggregateDensity = 70;
+	
+	SignatureGeneratorOptions wideOptions;
+	wideOptions.maxDepth = 1;
+	wideOptions.maxWidth = 64;
+	wideOptions.aggregateDensity = 80;
+	
+	SignatureGeneratorOptions unionOptions;
+	unionOptions.unionDensity = 80;
+	unionOptions.aggregateDensity = 70;
+	
+	SignatureGeneratorOptions varArgsOptions;
+	varArgsOptions.varArgsDensity = 100;
+	varArgsOptions.maxVarArgs = 6;
+	
+	if (!runConfiguration("default", defaultOptions, 500) ||
+	    !runConfiguration("deep", deepOptions, 100) ||
+	    !runConfiguration("wide", wideOptions, 100) ||
+	    !runConfiguration("unions", unionOptions, 200) ||
+	    !runConfiguration("varargs", varArgsOptions, 200)) {
+		return EXIT_FAILURE;
+	}
+	
+	printf("Test PASSED.\n");
+	
+	return 0;
+}
@@ -0,0 +1,61 @@
+#ifndef TESTDRIVER_HPP
+#define TESTDRIVER_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "TestFunctionType.hpp"
+#include "TestSystem.hpp"
+#include "TokenStream.hpp"
+#include "TypeParser.hpp"
+
+namespace llvm_abi {
+	
+	/**
+	 * \brief Function Type Parser
+	 *
+	 * Parses function types in the test header syntax (e.g.
+	 * 'void ({ int, int })', as in 'FUNCTION-TYPE:'). Aggregate
+	 * types are built by the parser's type builder, so they
+	 * are only valid while the parser exists.
+	 */
+	class FunctionTypeParser {
+	public:
+		TestFunctionType parse(const std::string& string) const {
+			TokenStream stream(string);
+			TypeParser parser(stream, typeBuilder_);
+			return parser.parseFunctionType();
+		}
+	
+	private:
+		TypeBuilder typeBuilder_;
+	
+	};
+	
+	/**
+	 * \brief Run a table of test cases.
+	 *
+	 * Stops at the first failing case; the run function
+	 * reports why it failed.
+	 *
+	 * \return The test program's exit code.
+	 */
+	template <typename TestCase, size_t N, typename RunFunction>
+	int runTestCases(const TestCase (&testCases)[N],
+	                 RunFunction runTestCase) {
+		for (const auto& testCase: testCases) {
+			if (!runTestCase(testCase)) {
+				return EXIT_FAILURE;
+			}
+		}
+		
+		printf("Test PASSED.\n");
+		
+		return EXIT_SUCCESS;
+	}
+
+}
+
+#endif
@@ -46,10 +46,11 @@ private:
 class TestSystem {
 public:
 	TestSystem(const std::string& triple,
-	           const std::string& cpu)
+	           const std::string& cpu,
+	           const std::string& abiName)
 	: context_(),
 	module_("", context_),
-	abi_(createABI(module_, llvm::Triple(triple), cpu)) { }
+	abi_(createABI(module_, llvm::Triple(triple), cpu, abiName)) { }
 	
 	ABI& abi() {
 		return *abi_;
@@ -74,24 +75,37 @@ public:
 			argumentTypes.push_back(argType);
 		}
 		
-		return FunctionType(CC_CDefault,
+		return FunctionType(functionType.callingConvention(),
 		                    functionType.returnType(),
 		                    argumentTypes,
 		                    /*isVarArg=*/false);
 	}
 	
-	void doTest(const std::string& testName, const TestFunctionType& testFunctionType) {
+	llvm::Module& module() {
+		return module_;
+	}
+	
+	/**
+	 * \brief Emit the callee declaration and the caller function.
+	 * 
+	 * The caller receives ABI-encoded arguments, decodes them,
+	 * re-encodes them to call the callee and then does the same
+	 * for the return value.
+	 */
+	void emitFunctions(const TestFunctionType& testFunctionType) {
 		const auto& calleeFunctionType = testFunctionType.functionType;
 		const auto calleeFunction = llvm::cast<llvm::Function>(module_.getOrInsertFunction("callee", abi_->getFunctionType(calleeFunctionType)).getCallee());
 		const auto calleeAttributes = abi_->getAttributes(calleeFunctionType,
 		                                                  calleeFunctionType.argumentTypes());
 		calleeFunction->setAttributes(calleeAttributes);
+		calleeFunction->setCallingConv(abi_->getCallingConvention(calleeFunctionType.callingConvention()));
 		
 		const auto callerFunctionType = makeCallerFunctionType(testFunctionType);
 		const auto callerFunction = llvm::cast<llvm::Function>(module_.getOrInsertFunction("caller", abi_->getFunctionType(callerFunctionType)).getCallee());
 		const auto callerAttributes = abi_->getAttributes(callerFunctionType,
 		                                                  callerFunctionType.argumentTypes());
 		callerFunction->setAttributes(callerAttributes);
+		callerFunction->setCallingConv(abi_->getCallingConvention(callerFunctionType.callingConvention()));
 		
 		const auto entryBasicBlock = llvm::BasicBlock::Create(context_, "", callerFunction);
 		(void) entryBasicBlock;
@@ -124,12 +138,20 @@ public:
 				const auto callAttributes = abi_->getAttributes(calleeFunctionType,
 				                                                callerFunctionType.argumentTypes());
 				callInst->setAttributes(callAttributes);
+				callInst->setCallingConv(calleeFunction->getCallingConv());
 				return callInst;
 			},
 			arguments
 		);
 		
 		functionEncoder->returnValue(returnValue);
+	}
+	
+	void doTest(const std::string& testName, const TestFunctionType& testFunctionType) {
+		emitFunctions(testFunctionType);
+		
+		const auto& calleeFunctionType = testFunctionType.functionType;
+		const auto callerFunctionType = makeCallerFunctionType(testFunctionType);
 		
 		std::string filename;
 		filename += "test-";
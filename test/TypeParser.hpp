@@ -5,6 +5,7 @@
 
 #include <llvm/ADT/SmallVector.h>
 
+#include <llvm-abi/CallingConvention.hpp>
 #include <llvm-abi/FunctionType.hpp>
 #include <llvm-abi/Type.hpp>
 #include <llvm-abi/TypeBuilder.hpp>
@@ -17,7 +18,10 @@ namespace llvm_abi {
 	class TypeParser {
 	public:
 		TypeParser(TokenStream& stream)
-		: stream_(stream) { }
+		: stream_(stream), typeBuilder_(ownTypeBuilder_) { }
+		
+		TypeParser(TokenStream& stream, const TypeBuilder& typeBuilder)
+		: stream_(stream), typeBuilder_(typeBuilder) { }
 		
 		std::string parseString() {
 			std::string text;
@@ -82,6 +86,12 @@ namespace llvm_abi {
 				return DoubleTy;
 			} else if (text == "longdouble") {
 				return LongDoubleTy;
+			} else if (text == "complexfloat") {
+				return Type::Complex(Float);
+			} else if (text == "complexdouble") {
+				return Type::Complex(Double);
+			} else if (text == "complexlongdouble") {
+				return Type::Complex(LongDouble);
 			} else {
 				throw std::runtime_error(std::string("Unknown type '") + text + "'.");
 			}
@@ -247,7 +257,7 @@ namespace llvm_abi {
 			return varArgsTypes;
 		}
 		
-		TestFunctionType parseFunctionType() {
+		TestFunctionType parseFunctionType(const CallingConvention callingConvention = CC_CDefault) {
 			const auto returnType = parseType();
 			
 			stream_.expect('(');
@@ -272,7 +282,7 @@ namespace llvm_abi {
 			stream_.expect(')');
 			stream_.consume();
 			
-			return TestFunctionType(FunctionType(CC_CDefault,
+			return TestFunctionType(FunctionType(callingConvention,
 			                                     returnType,
 			                                     argumentTypes,
 			                                     isVarArg),
@@ -281,7 +291,8 @@ namespace llvm_abi {
 		
 	private:
 		TokenStream& stream_;
-		TypeBuilder typeBuilder_;
+		TypeBuilder ownTypeBuilder_;
+		const TypeBuilder& typeBuilder_;
 		
 	};
 	
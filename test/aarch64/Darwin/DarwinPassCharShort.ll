@@ -0,0 +1,9 @@
+; ABI: arm64-apple-ios
+; FUNCTION-TYPE: void (char, short)
+
+declare void @callee(i8 signext, i16 signext)
+
+define void @caller(i8 signext, i16 signext) {
+  call void @callee(i8 signext %0, i16 signext %1)
+  ret void
+}
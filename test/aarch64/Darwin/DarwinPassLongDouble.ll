@@ -0,0 +1,9 @@
+; ABI: arm64-apple-ios
+; FUNCTION-TYPE: void (longdouble)
+
+declare void @callee(double)
+
+define void @caller(double) {
+  call void @callee(double %0)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: arm64-apple-ios
+; FUNCTION-TYPE: uchar ()
+
+declare zeroext i8 @callee()
+
+define zeroext i8 @caller() {
+  %1 = call zeroext i8 @callee()
+  ret i8 %1
+}
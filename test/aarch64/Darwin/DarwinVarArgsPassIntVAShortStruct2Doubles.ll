@@ -0,0 +1,18 @@
+; ABI: arm64-apple-ios
+; FUNCTION-TYPE: void (int, ...(short, { double, double }))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, i16 signext, [2 x double] %coerce) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %3 = bitcast { double, double }* %coerce.mem to [2 x double]*
+  store [2 x double] %coerce, [2 x double]* %3, align 1
+  %4 = load { double, double }* %coerce.mem
+  %5 = sext i16 %1 to i32
+  store { double, double } %4, { double, double }* %coerce.arg.source
+  %6 = bitcast { double, double }* %coerce.arg.source to [2 x double]*
+  %7 = load [2 x double]* %6, align 1
+  call void (i32, ...)* @callee(i32 %0, i32 %5, [2 x double] %7)
+  ret void
+}
@@ -0,0 +1,24 @@
+; ABI: aarch64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: { double, double, double, double } ()
+
+declare fastcc { double, double, double, double } @callee()
+
+define fastcc { double, double, double, double } @caller() {
+  %agg.tmp = alloca { double, double, double, double }, align 8
+  %1 = call fastcc { double, double, double, double } @callee()
+  %2 = getelementptr { double, double, double, double }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { double, double, double, double } %1, 0
+  store double %3, double* %2
+  %4 = getelementptr { double, double, double, double }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { double, double, double, double } %1, 1
+  store double %5, double* %4
+  %6 = getelementptr { double, double, double, double }* %agg.tmp, i32 0, i32 2
+  %7 = extractvalue { double, double, double, double } %1, 2
+  store double %7, double* %6
+  %8 = getelementptr { double, double, double, double }* %agg.tmp, i32 0, i32 3
+  %9 = extractvalue { double, double, double, double } %1, 3
+  store double %9, double* %8
+  %10 = load { double, double, double, double }* %agg.tmp
+  ret { double, double, double, double } %10
+}
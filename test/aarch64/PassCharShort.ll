@@ -0,0 +1,9 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void (char, short)
+
+declare void @callee(i8, i16)
+
+define void @caller(i8, i16) {
+  call void @callee(i8 %0, i16 %1)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ <4 x float>, <4 x float> })
+
+declare void @callee([2 x <4 x float>])
+
+define void @caller([2 x <4 x float>] %coerce) {
+  %coerce.arg.source = alloca { <4 x float>, <4 x float> }, align 16
+  %coerce.mem = alloca { <4 x float>, <4 x float> }, align 16
+  %1 = bitcast { <4 x float>, <4 x float> }* %coerce.mem to [2 x <4 x float>]*
+  store [2 x <4 x float>] %coerce, [2 x <4 x float>]* %1, align 1
+  %2 = load { <4 x float>, <4 x float> }* %coerce.mem
+  store { <4 x float>, <4 x float> } %2, { <4 x float>, <4 x float> }* %coerce.arg.source
+  %3 = bitcast { <4 x float>, <4 x float> }* %coerce.arg.source to [2 x <4 x float>]*
+  %4 = load [2 x <4 x float>]* %3, align 1
+  call void @callee([2 x <4 x float>] %4)
+  ret void
+}
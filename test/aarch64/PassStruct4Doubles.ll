@@ -0,0 +1,17 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ double, double, double, double })
+
+declare void @callee([4 x double])
+
+define void @caller([4 x double] %coerce) {
+  %coerce.arg.source = alloca { double, double, double, double }, align 8
+  %coerce.mem = alloca { double, double, double, double }, align 8
+  %1 = bitcast { double, double, double, double }* %coerce.mem to [4 x double]*
+  store [4 x double] %coerce, [4 x double]* %1, align 1
+  %2 = load { double, double, double, double }* %coerce.mem
+  store { double, double, double, double } %2, { double, double, double, double }* %coerce.arg.source
+  %3 = bitcast { double, double, double, double }* %coerce.arg.source to [4 x double]*
+  %4 = load [4 x double]* %3, align 1
+  call void @callee([4 x double] %4)
+  ret void
+}
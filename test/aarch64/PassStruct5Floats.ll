@@ -0,0 +1,12 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ float, float, float, float, float })
+
+declare void @callee({ float, float, float, float, float }*)
+
+define void @caller({ float, float, float, float, float }*) {
+  %indirect.arg.mem = alloca { float, float, float, float, float }, align 4
+  %2 = load { float, float, float, float, float }* %0
+  store { float, float, float, float, float } %2, { float, float, float, float, float }* %indirect.arg.mem
+  call void @callee({ float, float, float, float, float }* %indirect.arg.mem)
+  ret void
+}
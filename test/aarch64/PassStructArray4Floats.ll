@@ -0,0 +1,17 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ [4 x float] })
+
+declare void @callee([4 x float])
+
+define void @caller([4 x float] %coerce) {
+  %coerce.arg.source = alloca { [4 x float] }, align 4
+  %coerce.mem = alloca { [4 x float] }, align 4
+  %coerce.dive = getelementptr { [4 x float] }* %coerce.mem, i32 0, i32 0
+  store [4 x float] %coerce, [4 x float]* %coerce.dive, align 1
+  %1 = load { [4 x float] }* %coerce.mem
+  store { [4 x float] } %1, { [4 x float] }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { [4 x float] }* %coerce.arg.source, i32 0, i32 0
+  %2 = load [4 x float]* %coerce.dive1, align 1
+  call void @callee([4 x float] %2)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ float, double })
+
+declare void @callee([2 x i64])
+
+define void @caller([2 x i64] %coerce) {
+  %coerce.arg.source = alloca { float, double }, align 8
+  %coerce.mem = alloca { float, double }, align 8
+  %1 = bitcast { float, double }* %coerce.mem to [2 x i64]*
+  store [2 x i64] %coerce, [2 x i64]* %1, align 1
+  %2 = load { float, double }* %coerce.mem
+  store { float, double } %2, { float, double }* %coerce.arg.source
+  %3 = bitcast { float, double }* %coerce.arg.source to [2 x i64]*
+  %4 = load [2 x i64]* %3, align 1
+  call void @callee([2 x i64] %4)
+  ret void
+}
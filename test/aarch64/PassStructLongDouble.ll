@@ -0,0 +1,19 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void ({ longdouble })
+
+declare void @callee([1 x fp128])
+
+define void @caller([1 x fp128] %coerce) {
+  %coerce.arg.source = alloca { fp128 }, align 16
+  %coerce.mem = alloca { fp128 }, align 16
+  %coerce.dive = getelementptr { fp128 }* %coerce.mem, i32 0, i32 0
+  %1 = bitcast fp128* %coerce.dive to [1 x fp128]*
+  store [1 x fp128] %coerce, [1 x fp128]* %1, align 1
+  %2 = load { fp128 }* %coerce.mem
+  store { fp128 } %2, { fp128 }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { fp128 }* %coerce.arg.source, i32 0, i32 0
+  %3 = bitcast fp128* %coerce.dive1 to [1 x fp128]*
+  %4 = load [1 x fp128]* %3, align 1
+  call void @callee([1 x fp128] %4)
+  ret void
+}
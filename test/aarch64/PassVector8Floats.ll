@@ -0,0 +1,12 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void (<8 x float>)
+
+declare void @callee(<8 x float>*)
+
+define void @caller(<8 x float>*) {
+  %indirect.arg.mem = alloca <8 x float>, align 16
+  %2 = load <8 x float>* %0
+  store <8 x float> %2, <8 x float>* %indirect.arg.mem
+  call void @callee(<8 x float>* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: char ()
+
+declare i8 @callee()
+
+define i8 @caller() {
+  %1 = call i8 @callee()
+  ret i8 %1
+}
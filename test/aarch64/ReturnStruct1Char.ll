@@ -0,0 +1,19 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: { char } ()
+
+declare i64 @callee()
+
+define i64 @caller() {
+  %coerce1 = alloca { i8 }, align 1
+  %coerce = alloca { i8 }, align 1
+  %1 = call i64 @callee()
+  %coerce.dive = getelementptr { i8 }* %coerce, i32 0, i32 0
+  %coerce.val.ii = trunc i64 %1 to i8
+  store i8 %coerce.val.ii, i8* %coerce.dive, align 1
+  %2 = load { i8 }* %coerce, align 1
+  store { i8 } %2, { i8 }* %coerce1, align 1
+  %coerce.dive2 = getelementptr { i8 }* %coerce1, i32 0, i32 0
+  %3 = load i8* %coerce.dive2, align 1
+  %coerce.val.ii3 = zext i8 %3 to i64
+  ret i64 %coerce.val.ii3
+}
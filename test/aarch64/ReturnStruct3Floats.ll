@@ -0,0 +1,20 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: { float, float, float } ()
+
+declare { float, float, float } @callee()
+
+define { float, float, float } @caller() {
+  %agg.tmp = alloca { float, float, float }, align 4
+  %1 = call { float, float, float } @callee()
+  %2 = getelementptr { float, float, float }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { float, float, float } %1, 0
+  store float %3, float* %2
+  %4 = getelementptr { float, float, float }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { float, float, float } %1, 1
+  store float %5, float* %4
+  %6 = getelementptr { float, float, float }* %agg.tmp, i32 0, i32 2
+  %7 = extractvalue { float, float, float } %1, 2
+  store float %7, float* %6
+  %8 = load { float, float, float }* %agg.tmp
+  ret { float, float, float } %8
+}
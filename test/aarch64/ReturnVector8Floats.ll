@@ -0,0 +1,12 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: <8 x float> ()
+
+declare void @callee(<8 x float>* noalias sret)
+
+define void @caller(<8 x float>* noalias sret %agg.result) {
+  %1 = alloca <8 x float>, align 16
+  call void @callee(<8 x float>* noalias sret %1)
+  %2 = load <8 x float>* %1, align 1
+  store <8 x float> %2, <8 x float>* %agg.result
+  ret void
+}
@@ -0,0 +1,18 @@
+; ABI: aarch64-none-linux-gnu
+; FUNCTION-TYPE: void (int, ...(char, double, { float, float }))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, i8, double, [2 x float] %coerce) {
+  %coerce.arg.source = alloca { float, float }, align 4
+  %coerce.mem = alloca { float, float }, align 4
+  %4 = bitcast { float, float }* %coerce.mem to [2 x float]*
+  store [2 x float] %coerce, [2 x float]* %4, align 1
+  %5 = load { float, float }* %coerce.mem
+  %6 = zext i8 %1 to i32
+  store { float, float } %5, { float, float }* %coerce.arg.source
+  %7 = bitcast { float, float }* %coerce.arg.source to [2 x float]*
+  %8 = load [2 x float]* %7, align 1
+  call void (i32, ...)* @callee(i32 %0, i32 %6, double %2, [2 x float] %8)
+  ret void
+}
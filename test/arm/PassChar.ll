@@ -0,0 +1,9 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (char)
+
+declare void @callee(i8 zeroext)
+
+define void @caller(i8 zeroext) {
+  call void @callee(i8 zeroext %0)
+  ret void
+}
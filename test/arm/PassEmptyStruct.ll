@@ -0,0 +1,9 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void ({}, int)
+
+declare void @callee(i32)
+
+define void @caller(i32) {
+  call void @callee(i32 %0)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (float, double, float)
+
+declare void @callee(float, double, float)
+
+define void @caller(float, double, float) {
+  call void @callee(float %0, double %1, float %2)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (int, longlong)
+
+declare void @callee(i32, i64)
+
+define void @caller(i32, i64) {
+  call void @callee(i32 %0, i64 %1)
+  ret void
+}
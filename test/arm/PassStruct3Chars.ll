@@ -0,0 +1,28 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void ({ char, char, char })
+
+declare void @callee([1 x i32])
+
+define void @caller([1 x i32] %coerce) {
+  %coerce.mem.load = alloca [1 x i32], align 4
+  %coerce.arg.source = alloca { i8, i8, i8 }, align 1
+  %coerce.mem.store = alloca [1 x i32], align 4
+  %coerce.mem = alloca { i8, i8, i8 }, align 4
+  store [1 x i32] %coerce, [1 x i32]* %coerce.mem.store
+  %1 = bitcast [1 x i32]* %coerce.mem.store to i8*
+  %2 = bitcast { i8, i8, i8 }* %coerce.mem to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %2, i8* align 1 %1, i32 3, i1 false)
+  %3 = load { i8, i8, i8 }* %coerce.mem, align 1
+  store { i8, i8, i8 } %3, { i8, i8, i8 }* %coerce.arg.source, align 1
+  %4 = bitcast [1 x i32]* %coerce.mem.load to i8*
+  %5 = bitcast { i8, i8, i8 }* %coerce.arg.source to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %4, i8* align 1 %5, i32 3, i1 false)
+  %6 = load [1 x i32]* %coerce.mem.load
+  call void @callee([1 x i32] %6)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i32(i8* nocapture, i8* nocapture readonly, i32, i32, i1) #0
+
+attributes #0 = { argmemonly nounwind }
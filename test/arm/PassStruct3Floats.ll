@@ -0,0 +1,15 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void ({ float, float, float })
+
+declare void @callee({ float, float, float })
+
+define void @caller({ float, float, float } %coerce) {
+  %coerce.arg.source = alloca { float, float, float }, align 4
+  %coerce.mem = alloca { float, float, float }, align 4
+  store { float, float, float } %coerce, { float, float, float }* %coerce.mem
+  %1 = load { float, float, float }* %coerce.mem
+  store { float, float, float } %1, { float, float, float }* %coerce.arg.source
+  %2 = load { float, float, float }* %coerce.arg.source
+  call void @callee({ float, float, float } %2)
+  ret void
+}
@@ -0,0 +1,15 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void ({ double, double, double, double })
+
+declare void @callee({ double, double, double, double })
+
+define void @caller({ double, double, double, double } %coerce) {
+  %coerce.arg.source = alloca { double, double, double, double }, align 8
+  %coerce.mem = alloca { double, double, double, double }, align 8
+  store { double, double, double, double } %coerce, { double, double, double, double }* %coerce.mem
+  %1 = load { double, double, double, double }* %coerce.mem
+  store { double, double, double, double } %1, { double, double, double, double }* %coerce.arg.source
+  %2 = load { double, double, double, double }* %coerce.arg.source
+  call void @callee({ double, double, double, double } %2)
+  ret void
+}
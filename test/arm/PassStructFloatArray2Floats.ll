@@ -0,0 +1,15 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (float, { float, [2 x float] })
+
+declare void @callee(float, { float, [2 x float] })
+
+define void @caller(float, { float, [2 x float] } %coerce) {
+  %coerce.arg.source = alloca { float, [2 x float] }, align 4
+  %coerce.mem = alloca { float, [2 x float] }, align 4
+  store { float, [2 x float] } %coerce, { float, [2 x float] }* %coerce.mem
+  %2 = load { float, [2 x float] }* %coerce.mem
+  store { float, [2 x float] } %2, { float, [2 x float] }* %coerce.arg.source
+  %3 = load { float, [2 x float] }* %coerce.arg.source
+  call void @callee(float %0, { float, [2 x float] } %3)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (int, { int, double })
+
+declare void @callee(i32, [2 x i64])
+
+define void @caller(i32, [2 x i64] %coerce) {
+  %coerce.arg.source = alloca { i32, double }, align 8
+  %coerce.mem = alloca { i32, double }, align 8
+  %2 = bitcast { i32, double }* %coerce.mem to [2 x i64]*
+  store [2 x i64] %coerce, [2 x i64]* %2, align 1
+  %3 = load { i32, double }* %coerce.mem
+  store { i32, double } %3, { i32, double }* %coerce.arg.source
+  %4 = bitcast { i32, double }* %coerce.arg.source to [2 x i64]*
+  %5 = load [2 x i64]* %4, align 1
+  call void @callee(i32 %0, [2 x i64] %5)
+  ret void
+}
@@ -0,0 +1,28 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (<2 x char>)
+
+declare void @callee(i32)
+
+define void @caller(i32 %coerce) {
+  %coerce.mem.load = alloca i32, align 4
+  %coerce.arg.source = alloca <2 x i8>, align 2
+  %coerce.mem.store = alloca i32, align 4
+  %coerce.mem = alloca <2 x i8>, align 4
+  store i32 %coerce, i32* %coerce.mem.store
+  %1 = bitcast i32* %coerce.mem.store to i8*
+  %2 = bitcast <2 x i8>* %coerce.mem to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %2, i8* align 1 %1, i32 2, i1 false)
+  %3 = load <2 x i8>* %coerce.mem
+  store <2 x i8> %3, <2 x i8>* %coerce.arg.source
+  %4 = bitcast i32* %coerce.mem.load to i8*
+  %5 = bitcast <2 x i8>* %coerce.arg.source to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %4, i8* align 1 %5, i32 2, i1 false)
+  %6 = load i32* %coerce.mem.load
+  call void @callee(i32 %6)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i32(i8* nocapture, i8* nocapture readonly, i32, i32, i1) #0
+
+attributes #0 = { argmemonly nounwind }
@@ -0,0 +1,17 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: { char, char } ()
+
+declare i16 @callee()
+
+define i16 @caller() {
+  %coerce1 = alloca { i8, i8 }, align 1
+  %coerce = alloca { i8, i8 }, align 1
+  %1 = call i16 @callee()
+  %2 = bitcast { i8, i8 }* %coerce to i16*
+  store i16 %1, i16* %2, align 1
+  %3 = load { i8, i8 }* %coerce, align 1
+  store { i8, i8 } %3, { i8, i8 }* %coerce1, align 1
+  %4 = bitcast { i8, i8 }* %coerce1 to i16*
+  %5 = load i16* %4, align 1
+  ret i16 %5
+}
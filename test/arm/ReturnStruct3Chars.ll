@@ -0,0 +1,28 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: { char, char, char } ()
+
+declare i32 @callee()
+
+define i32 @caller() {
+  %coerce.mem.load = alloca i32, align 4
+  %coerce1 = alloca { i8, i8, i8 }, align 1
+  %coerce.mem.store = alloca i32, align 4
+  %coerce = alloca { i8, i8, i8 }, align 1
+  %1 = call i32 @callee()
+  store i32 %1, i32* %coerce.mem.store
+  %2 = bitcast i32* %coerce.mem.store to i8*
+  %3 = bitcast { i8, i8, i8 }* %coerce to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %3, i8* align 1 %2, i32 3, i1 false)
+  %4 = load { i8, i8, i8 }* %coerce, align 1
+  store { i8, i8, i8 } %4, { i8, i8, i8 }* %coerce1, align 1
+  %5 = bitcast i32* %coerce.mem.load to i8*
+  %6 = bitcast { i8, i8, i8 }* %coerce1 to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i32(i8* align 1 %5, i8* align 1 %6, i32 3, i1 false)
+  %7 = load i32* %coerce.mem.load
+  ret i32 %7
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i32(i8* nocapture, i8* nocapture readonly, i32, i32, i1) #0
+
+attributes #0 = { argmemonly nounwind }
@@ -0,0 +1,17 @@
+; ABI: armv7-unknown-linux-gnueabi
+; FUNCTION-TYPE: void ({ float, float, float })
+
+declare void @callee([3 x i32])
+
+define void @caller([3 x i32] %coerce) {
+  %coerce.arg.source = alloca { float, float, float }, align 4
+  %coerce.mem = alloca { float, float, float }, align 4
+  %1 = bitcast { float, float, float }* %coerce.mem to [3 x i32]*
+  store [3 x i32] %coerce, [3 x i32]* %1, align 1
+  %2 = load { float, float, float }* %coerce.mem
+  store { float, float, float } %2, { float, float, float }* %coerce.arg.source
+  %3 = bitcast { float, float, float }* %coerce.arg.source to [3 x i32]*
+  %4 = load [3 x i32]* %3, align 1
+  call void @callee([3 x i32] %4)
+  ret void
+}
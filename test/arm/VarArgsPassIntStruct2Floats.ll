@@ -0,0 +1,16 @@
+; ABI: armv7-unknown-linux-gnueabihf
+; FUNCTION-TYPE: void (int, ...({ float, float }))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, { float, float } %coerce) {
+  %coerce.arg.source = alloca { float, float }, align 4
+  %coerce.mem = alloca { float, float }, align 4
+  store { float, float } %coerce, { float, float }* %coerce.mem
+  %2 = load { float, float }* %coerce.mem
+  store { float, float } %2, { float, float }* %coerce.arg.source
+  %3 = bitcast { float, float }* %coerce.arg.source to [2 x i32]*
+  %4 = load [2 x i32]* %3, align 1
+  call void (i32, ...)* @callee(i32 %0, [2 x i32] %4)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: powerpc64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ double, double })
+
+declare void @callee([2 x i64])
+
+define void @caller([2 x i64] %coerce) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %1 = bitcast { double, double }* %coerce.mem to [2 x i64]*
+  store [2 x i64] %coerce, [2 x i64]* %1, align 1
+  %2 = load { double, double }* %coerce.mem
+  store { double, double } %2, { double, double }* %coerce.arg.source
+  %3 = bitcast { double, double }* %coerce.arg.source to [2 x i64]*
+  %4 = load [2 x i64]* %3, align 1
+  call void @callee([2 x i64] %4)
+  ret void
+}
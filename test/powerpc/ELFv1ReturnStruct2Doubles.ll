@@ -0,0 +1,12 @@
+; ABI: powerpc64-unknown-linux-gnu
+; FUNCTION-TYPE: { double, double } ()
+
+declare void @callee({ double, double }* noalias sret)
+
+define void @caller({ double, double }* noalias sret %agg.result) {
+  %1 = alloca { double, double }, align 8
+  call void @callee({ double, double }* noalias sret %1)
+  %2 = load { double, double }* %1, align 1
+  store { double, double } %2, { double, double }* %agg.result
+  ret void
+}
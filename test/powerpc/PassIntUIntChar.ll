@@ -0,0 +1,9 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, uint, char, long)
+
+declare void @callee(i32 signext, i32 zeroext, i8 zeroext, i64)
+
+define void @caller(i32 signext, i32 zeroext, i8 zeroext, i64) {
+  call void @callee(i32 signext %0, i32 zeroext %1, i8 zeroext %2, i64 %3)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void (longdouble)
+
+declare void @callee(ppc_fp128)
+
+define void @caller(ppc_fp128) {
+  call void @callee(ppc_fp128 %0)
+  ret void
+}
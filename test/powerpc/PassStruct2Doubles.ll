@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ double, double })
+
+declare void @callee([2 x double])
+
+define void @caller([2 x double] %coerce) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %1 = bitcast { double, double }* %coerce.mem to [2 x double]*
+  store [2 x double] %coerce, [2 x double]* %1, align 1
+  %2 = load { double, double }* %coerce.mem
+  store { double, double } %2, { double, double }* %coerce.arg.source
+  %3 = bitcast { double, double }* %coerce.arg.source to [2 x double]*
+  %4 = load [2 x double]* %3, align 1
+  call void @callee([2 x double] %4)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ char, char, char })
+
+declare void @callee(i24)
+
+define void @caller(i24 %coerce) {
+  %coerce.arg.source = alloca { i8, i8, i8 }, align 1
+  %coerce.mem = alloca { i8, i8, i8 }, align 4
+  %1 = bitcast { i8, i8, i8 }* %coerce.mem to i24*
+  store i24 %coerce, i24* %1, align 1
+  %2 = load { i8, i8, i8 }* %coerce.mem, align 1
+  store { i8, i8, i8 } %2, { i8, i8, i8 }* %coerce.arg.source, align 1
+  %3 = bitcast { i8, i8, i8 }* %coerce.arg.source to i24*
+  %4 = load i24* %3, align 1
+  call void @callee(i24 %4)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ longdouble, longdouble, longdouble, longdouble })
+
+declare void @callee([4 x ppc_fp128])
+
+define void @caller([4 x ppc_fp128] %coerce) {
+  %coerce.arg.source = alloca { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }, align 16
+  %coerce.mem = alloca { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }, align 16
+  %1 = bitcast { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }* %coerce.mem to [4 x ppc_fp128]*
+  store [4 x ppc_fp128] %coerce, [4 x ppc_fp128]* %1, align 1
+  %2 = load { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }* %coerce.mem
+  store { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 } %2, { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }* %coerce.arg.source
+  %3 = bitcast { ppc_fp128, ppc_fp128, ppc_fp128, ppc_fp128 }* %coerce.arg.source to [4 x ppc_fp128]*
+  %4 = load [4 x ppc_fp128]* %3, align 1
+  call void @callee([4 x ppc_fp128] %4)
+  ret void
+}
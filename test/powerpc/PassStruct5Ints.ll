@@ -0,0 +1,28 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ int, int, int, int, int })
+
+declare void @callee([3 x i64])
+
+define void @caller([3 x i64] %coerce) {
+  %coerce.mem.load = alloca [3 x i64], align 8
+  %coerce.arg.source = alloca { i32, i32, i32, i32, i32 }, align 4
+  %coerce.mem.store = alloca [3 x i64], align 8
+  %coerce.mem = alloca { i32, i32, i32, i32, i32 }, align 8
+  store [3 x i64] %coerce, [3 x i64]* %coerce.mem.store
+  %1 = bitcast [3 x i64]* %coerce.mem.store to i8*
+  %2 = bitcast { i32, i32, i32, i32, i32 }* %coerce.mem to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i64(i8* align 1 %2, i8* align 1 %1, i64 20, i1 false)
+  %3 = load { i32, i32, i32, i32, i32 }* %coerce.mem
+  store { i32, i32, i32, i32, i32 } %3, { i32, i32, i32, i32, i32 }* %coerce.arg.source
+  %4 = bitcast [3 x i64]* %coerce.mem.load to i8*
+  %5 = bitcast { i32, i32, i32, i32, i32 }* %coerce.arg.source to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i64(i8* align 1 %4, i8* align 1 %5, i64 20, i1 false)
+  %6 = load [3 x i64]* %coerce.mem.load
+  call void @callee([3 x i64] %6)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i64(i8* nocapture, i8* nocapture readonly, i64, i32, i1) #0
+
+attributes #0 = { argmemonly nounwind }
@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ float, float, float, float, float, float, float, float })
+
+declare void @callee([8 x float])
+
+define void @caller([8 x float] %coerce) {
+  %coerce.arg.source = alloca { float, float, float, float, float, float, float, float }, align 4
+  %coerce.mem = alloca { float, float, float, float, float, float, float, float }, align 4
+  %1 = bitcast { float, float, float, float, float, float, float, float }* %coerce.mem to [8 x float]*
+  store [8 x float] %coerce, [8 x float]* %1, align 1
+  %2 = load { float, float, float, float, float, float, float, float }* %coerce.mem
+  store { float, float, float, float, float, float, float, float } %2, { float, float, float, float, float, float, float, float }* %coerce.arg.source
+  %3 = bitcast { float, float, float, float, float, float, float, float }* %coerce.arg.source to [8 x float]*
+  %4 = load [8 x float]* %3, align 1
+  call void @callee([8 x float] %4)
+  ret void
+}
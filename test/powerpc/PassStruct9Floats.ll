@@ -0,0 +1,28 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ float, float, float, float, float, float, float, float, float })
+
+declare void @callee([5 x i64])
+
+define void @caller([5 x i64] %coerce) {
+  %coerce.mem.load = alloca [5 x i64], align 8
+  %coerce.arg.source = alloca { float, float, float, float, float, float, float, float, float }, align 4
+  %coerce.mem.store = alloca [5 x i64], align 8
+  %coerce.mem = alloca { float, float, float, float, float, float, float, float, float }, align 8
+  store [5 x i64] %coerce, [5 x i64]* %coerce.mem.store
+  %1 = bitcast [5 x i64]* %coerce.mem.store to i8*
+  %2 = bitcast { float, float, float, float, float, float, float, float, float }* %coerce.mem to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i64(i8* align 1 %2, i8* align 1 %1, i64 36, i1 false)
+  %3 = load { float, float, float, float, float, float, float, float, float }* %coerce.mem
+  store { float, float, float, float, float, float, float, float, float } %3, { float, float, float, float, float, float, float, float, float }* %coerce.arg.source
+  %4 = bitcast [5 x i64]* %coerce.mem.load to i8*
+  %5 = bitcast { float, float, float, float, float, float, float, float, float }* %coerce.arg.source to i8*
+  call void @llvm.memcpy.p0i8.p0i8.i64(i8* align 1 %4, i8* align 1 %5, i64 36, i1 false)
+  %6 = load [5 x i64]* %coerce.mem.load
+  call void @callee([5 x i64] %6)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i64(i8* nocapture, i8* nocapture readonly, i64, i32, i1) #0
+
+attributes #0 = { argmemonly nounwind }
@@ -0,0 +1,12 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ [17 x int] })
+
+declare void @callee({ [17 x i32] }* byval align 8)
+
+define void @caller({ [17 x i32] }* byval align 8) {
+  %indirect.arg.mem = alloca { [17 x i32] }, align 8
+  %2 = load { [17 x i32] }* %0
+  store { [17 x i32] } %2, { [17 x i32] }* %indirect.arg.mem
+  call void @callee({ [17 x i32] }* byval align 8 %indirect.arg.mem)
+  ret void
+}
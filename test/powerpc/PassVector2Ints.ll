@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void (<2 x int>)
+
+declare void @callee(i64)
+
+define void @caller(i64 %coerce) {
+  %coerce.arg.source = alloca <2 x i32>, align 8
+  %coerce.mem = alloca <2 x i32>, align 8
+  %1 = bitcast <2 x i32>* %coerce.mem to i64*
+  store i64 %coerce, i64* %1, align 1
+  %2 = load <2 x i32>* %coerce.mem
+  store <2 x i32> %2, <2 x i32>* %coerce.arg.source
+  %3 = bitcast <2 x i32>* %coerce.arg.source to i64*
+  %4 = load i64* %3, align 1
+  call void @callee(i64 %4)
+  ret void
+}
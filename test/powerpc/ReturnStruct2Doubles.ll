@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: { double, double } ()
+
+declare [2 x double] @callee()
+
+define [2 x double] @caller() {
+  %coerce1 = alloca { double, double }, align 8
+  %coerce = alloca { double, double }, align 8
+  %1 = call [2 x double] @callee()
+  %2 = bitcast { double, double }* %coerce to [2 x double]*
+  store [2 x double] %1, [2 x double]* %2, align 1
+  %3 = load { double, double }* %coerce
+  store { double, double } %3, { double, double }* %coerce1
+  %4 = bitcast { double, double }* %coerce1 to [2 x double]*
+  %5 = load [2 x double]* %4, align 1
+  ret [2 x double] %5
+}
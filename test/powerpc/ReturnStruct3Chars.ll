@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: { char, char, char } ()
+
+declare i24 @callee()
+
+define i24 @caller() {
+  %coerce1 = alloca { i8, i8, i8 }, align 1
+  %coerce = alloca { i8, i8, i8 }, align 1
+  %1 = call i24 @callee()
+  %2 = bitcast { i8, i8, i8 }* %coerce to i24*
+  store i24 %1, i24* %2, align 1
+  %3 = load { i8, i8, i8 }* %coerce, align 1
+  store { i8, i8, i8 } %3, { i8, i8, i8 }* %coerce1, align 1
+  %4 = bitcast { i8, i8, i8 }* %coerce1 to i24*
+  %5 = load i24* %4, align 1
+  ret i24 %5
+}
@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: { float, float, float, float, float, float, float, float } ()
+
+declare [8 x float] @callee()
+
+define [8 x float] @caller() {
+  %coerce1 = alloca { float, float, float, float, float, float, float, float }, align 4
+  %coerce = alloca { float, float, float, float, float, float, float, float }, align 4
+  %1 = call [8 x float] @callee()
+  %2 = bitcast { float, float, float, float, float, float, float, float }* %coerce to [8 x float]*
+  store [8 x float] %1, [8 x float]* %2, align 1
+  %3 = load { float, float, float, float, float, float, float, float }* %coerce
+  store { float, float, float, float, float, float, float, float } %3, { float, float, float, float, float, float, float, float }* %coerce1
+  %4 = bitcast { float, float, float, float, float, float, float, float }* %coerce1 to [8 x float]*
+  %5 = load [8 x float]* %4, align 1
+  ret [8 x float] %5
+}
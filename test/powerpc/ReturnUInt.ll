@@ -0,0 +1,9 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: uint ()
+
+declare zeroext i32 @callee()
+
+define zeroext i32 @caller() {
+  %1 = call zeroext i32 @callee()
+  ret i32 %1
+}
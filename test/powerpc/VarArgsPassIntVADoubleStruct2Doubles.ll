@@ -0,0 +1,17 @@
+; ABI: powerpc64le-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, ...(double, { double, double }))
+
+declare void @callee(i32 signext, ...)
+
+define void @caller(i32 signext, double, [2 x double] %coerce) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %3 = bitcast { double, double }* %coerce.mem to [2 x double]*
+  store [2 x double] %coerce, [2 x double]* %3, align 1
+  %4 = load { double, double }* %coerce.mem
+  store { double, double } %4, { double, double }* %coerce.arg.source
+  %5 = bitcast { double, double }* %coerce.arg.source to [2 x double]*
+  %6 = load [2 x double]* %5, align 1
+  call void (i32, ...)* @callee(i32 signext %0, double %1, [2 x double] %6)
+  ret void
+}
@@ -0,0 +1,21 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ double, double })
+
+declare void @callee(double, double)
+
+define void @caller(double %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %1 = getelementptr { double, double }* %coerce.mem, i32 0, i32 0
+  store double %coerce0, double* %1
+  %2 = getelementptr { double, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %2
+  %3 = load { double, double }* %coerce.mem
+  store { double, double } %3, { double, double }* %coerce.arg.source
+  %4 = getelementptr { double, double }* %coerce.arg.source, i32 0, i32 0
+  %5 = load double* %4, align 1
+  %6 = getelementptr { double, double }* %coerce.arg.source, i32 0, i32 1
+  %7 = load double* %6, align 1
+  call void @callee(double %5, double %7)
+  ret void
+}
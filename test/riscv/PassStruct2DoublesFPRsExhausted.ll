@@ -0,0 +1,17 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void (double, double, double, double, double, double, double, { double, double })
+
+declare void @callee(double, double, double, double, double, double, double, [2 x i64])
+
+define void @caller(double, double, double, double, double, double, double, [2 x i64] %coerce) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %8 = bitcast { double, double }* %coerce.mem to [2 x i64]*
+  store [2 x i64] %coerce, [2 x i64]* %8, align 1
+  %9 = load { double, double }* %coerce.mem
+  store { double, double } %9, { double, double }* %coerce.arg.source
+  %10 = bitcast { double, double }* %coerce.arg.source to [2 x i64]*
+  %11 = load [2 x i64]* %10, align 1
+  call void @callee(double %0, double %1, double %2, double %3, double %4, double %5, double %6, [2 x i64] %11)
+  ret void
+}
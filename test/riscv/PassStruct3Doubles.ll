@@ -0,0 +1,12 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ double, double, double })
+
+declare void @callee({ double, double, double }*)
+
+define void @caller({ double, double, double }*) {
+  %indirect.arg.mem = alloca { double, double, double }, align 8
+  %2 = load { double, double, double }* %0
+  store { double, double, double } %2, { double, double, double }* %indirect.arg.mem
+  call void @callee({ double, double, double }* %indirect.arg.mem)
+  ret void
+}
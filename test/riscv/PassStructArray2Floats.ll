@@ -0,0 +1,23 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ [2 x float] })
+
+declare void @callee(float, float)
+
+define void @caller(float %coerce0, float %coerce1) {
+  %coerce.arg.source = alloca { [2 x float] }, align 4
+  %coerce.mem = alloca { [2 x float] }, align 4
+  %1 = bitcast { [2 x float] }* %coerce.mem to { float, float }*
+  %2 = getelementptr { float, float }* %1, i32 0, i32 0
+  store float %coerce0, float* %2
+  %3 = getelementptr { float, float }* %1, i32 0, i32 1
+  store float %coerce1, float* %3
+  %4 = load { [2 x float] }* %coerce.mem
+  store { [2 x float] } %4, { [2 x float] }* %coerce.arg.source
+  %5 = bitcast { [2 x float] }* %coerce.arg.source to { float, float }*
+  %6 = getelementptr { float, float }* %5, i32 0, i32 0
+  %7 = load float* %6, align 1
+  %8 = getelementptr { float, float }* %5, i32 0, i32 1
+  %9 = load float* %8, align 1
+  call void @callee(float %7, float %9)
+  ret void
+}
@@ -0,0 +1,23 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ float, [0 x double], float })
+
+declare void @callee(float, float)
+
+define void @caller(float, float) {
+  %coerce.arg.source = alloca { float, [0 x double], float }, align 8
+  %coerce = alloca { float, [0 x double], float }, align 8
+  %3 = bitcast { float, [0 x double], float }* %coerce to { float, [4 x i8], float }*
+  %4 = getelementptr { float, [4 x i8], float }* %3, i32 0, i32 0
+  store float %0, float* %4
+  %5 = getelementptr { float, [4 x i8], float }* %3, i32 0, i32 2
+  store float %1, float* %5
+  %6 = load { float, [0 x double], float }* %coerce
+  store { float, [0 x double], float } %6, { float, [0 x double], float }* %coerce.arg.source
+  %7 = bitcast { float, [0 x double], float }* %coerce.arg.source to { float, [4 x i8], float }*
+  %8 = getelementptr { float, [4 x i8], float }* %7, i32 0, i32 0
+  %9 = load float* %8
+  %10 = getelementptr { float, [4 x i8], float }* %7, i32 0, i32 2
+  %11 = load float* %10
+  call void @callee(float %9, float %11)
+  ret void
+}
@@ -0,0 +1,21 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ int, double })
+
+declare void @callee(i32, double)
+
+define void @caller(i32 %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { i32, double }, align 8
+  %coerce.mem = alloca { i32, double }, align 8
+  %1 = getelementptr { i32, double }* %coerce.mem, i32 0, i32 0
+  store i32 %coerce0, i32* %1
+  %2 = getelementptr { i32, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %2
+  %3 = load { i32, double }* %coerce.mem
+  store { i32, double } %3, { i32, double }* %coerce.arg.source
+  %4 = getelementptr { i32, double }* %coerce.arg.source, i32 0, i32 0
+  %5 = load i32* %4, align 1
+  %6 = getelementptr { i32, double }* %coerce.arg.source, i32 0, i32 1
+  %7 = load double* %6, align 1
+  call void @callee(i32 %5, double %7)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void (uint, uchar, short)
+
+declare void @callee(i32 signext, i8 zeroext, i16 signext)
+
+define void @caller(i32 signext, i8 zeroext, i16 signext) {
+  call void @callee(i32 signext %0, i8 zeroext %1, i16 signext %2)
+  ret void
+}
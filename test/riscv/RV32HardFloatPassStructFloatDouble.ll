@@ -0,0 +1,22 @@
+; ABI: riscv32-unknown-elf
+; CPU: rv32gc
+; FUNCTION-TYPE: void ({ float, double })
+
+declare void @callee(float, double)
+
+define void @caller(float %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { float, double }, align 8
+  %coerce.mem = alloca { float, double }, align 8
+  %1 = getelementptr { float, double }* %coerce.mem, i32 0, i32 0
+  store float %coerce0, float* %1
+  %2 = getelementptr { float, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %2
+  %3 = load { float, double }* %coerce.mem
+  store { float, double } %3, { float, double }* %coerce.arg.source
+  %4 = getelementptr { float, double }* %coerce.arg.source, i32 0, i32 0
+  %5 = load float* %4, align 1
+  %6 = getelementptr { float, double }* %coerce.arg.source, i32 0, i32 1
+  %7 = load double* %6, align 1
+  call void @callee(float %5, double %7)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: riscv32-unknown-elf
+; FUNCTION-TYPE: void (longlong, char)
+
+declare void @callee(i64, i8 zeroext)
+
+define void @caller(i64, i8 zeroext) {
+  call void @callee(i64 %0, i8 zeroext %1)
+  ret void
+}
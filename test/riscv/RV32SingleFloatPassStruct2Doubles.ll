@@ -0,0 +1,13 @@
+; ABI: riscv32-unknown-elf
+; CPU: rv32imafc
+; FUNCTION-TYPE: void ({ double, double })
+
+declare void @callee({ double, double }*)
+
+define void @caller({ double, double }*) {
+  %indirect.arg.mem = alloca { double, double }, align 8
+  %2 = load { double, double }* %0
+  store { double, double } %2, { double, double }* %indirect.arg.mem
+  call void @callee({ double, double }* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: { double, double } ()
+
+declare { double, double } @callee()
+
+define { double, double } @caller() {
+  %agg.tmp = alloca { double, double }, align 8
+  %1 = call { double, double } @callee()
+  %2 = getelementptr { double, double }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { double, double } %1, 0
+  store double %3, double* %2
+  %4 = getelementptr { double, double }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { double, double } %1, 1
+  store double %5, double* %4
+  %6 = load { double, double }* %agg.tmp
+  ret { double, double } %6
+}
@@ -0,0 +1,12 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: { double, double, double } ()
+
+declare void @callee({ double, double, double }* noalias sret)
+
+define void @caller({ double, double, double }* noalias sret %agg.result) {
+  %1 = alloca { double, double, double }, align 8
+  call void @callee({ double, double, double }* noalias sret %1)
+  %2 = load { double, double, double }* %1, align 1
+  store { double, double, double } %2, { double, double, double }* %agg.result
+  ret void
+}
@@ -0,0 +1,27 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: { float, [0 x double], float } ()
+
+declare { float, float } @callee()
+
+define { float, float } @caller() {
+  %coerce1 = alloca { float, [0 x double], float }, align 8
+  %coerce = alloca { float, [0 x double], float }, align 8
+  %1 = call { float, float } @callee()
+  %2 = bitcast { float, [0 x double], float }* %coerce to { float, [4 x i8], float }*
+  %3 = extractvalue { float, float } %1, 0
+  %4 = getelementptr { float, [4 x i8], float }* %2, i32 0, i32 0
+  store float %3, float* %4
+  %5 = extractvalue { float, float } %1, 1
+  %6 = getelementptr { float, [4 x i8], float }* %2, i32 0, i32 2
+  store float %5, float* %6
+  %7 = load { float, [0 x double], float }* %coerce
+  store { float, [0 x double], float } %7, { float, [0 x double], float }* %coerce1
+  %8 = bitcast { float, [0 x double], float }* %coerce1 to { float, [4 x i8], float }*
+  %9 = getelementptr { float, [4 x i8], float }* %8, i32 0, i32 0
+  %10 = load float* %9
+  %11 = getelementptr { float, [4 x i8], float }* %8, i32 0, i32 2
+  %12 = load float* %11
+  %13 = insertvalue { float, float } undef, float %10, 0
+  %14 = insertvalue { float, float } %13, float %12, 1
+  ret { float, float } %14
+}
@@ -0,0 +1,17 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: { float, char } ()
+
+declare { float, i8 } @callee()
+
+define { float, i8 } @caller() {
+  %agg.tmp = alloca { float, i8 }, align 4
+  %1 = call { float, i8 } @callee()
+  %2 = getelementptr { float, i8 }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { float, i8 } %1, 0
+  store float %3, float* %2
+  %4 = getelementptr { float, i8 }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { float, i8 } %1, 1
+  store i8 %5, i8* %4, align 1
+  %6 = load { float, i8 }* %agg.tmp
+  ret { float, i8 } %6
+}
@@ -0,0 +1,9 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: uint ()
+
+declare signext i32 @callee()
+
+define signext i32 @caller() {
+  %1 = call signext i32 @callee()
+  ret i32 %1
+}
@@ -0,0 +1,9 @@
+; ABI: riscv64-unknown-elf
+; FUNCTION-TYPE: void (double)
+
+declare void @callee(double)
+
+define void @caller(double) {
+  call void @callee(double %0)
+  ret void
+}
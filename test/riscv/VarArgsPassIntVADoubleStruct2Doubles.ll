@@ -0,0 +1,19 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, ...(double, { double, double }))
+
+declare void @callee(i32 signext, ...)
+
+define void @caller(i32 signext, double, double %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { double, double }, align 8
+  %coerce.mem = alloca { double, double }, align 8
+  %3 = getelementptr { double, double }* %coerce.mem, i32 0, i32 0
+  store double %coerce0, double* %3
+  %4 = getelementptr { double, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %4
+  %5 = load { double, double }* %coerce.mem
+  store { double, double } %5, { double, double }* %coerce.arg.source
+  %6 = bitcast { double, double }* %coerce.arg.source to [2 x i64]*
+  %7 = load [2 x i64]* %6, align 1
+  call void (i32, ...)* @callee(i32 signext %0, double %1, [2 x i64] %7)
+  ret void
+}
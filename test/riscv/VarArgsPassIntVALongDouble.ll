@@ -0,0 +1,9 @@
+; ABI: riscv64-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, ...(longdouble))
+
+declare void @callee(i32 signext, ...)
+
+define void @caller(i32 signext, fp128) {
+  call void (i32, ...)* @callee(i32 signext %0, fp128 %1)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, uint, char)
+
+declare void @callee(i32 signext, i32 zeroext, i8 zeroext)
+
+define void @caller(i32 signext, i32 zeroext, i8 zeroext) {
+  call void @callee(i32 signext %0, i32 zeroext %1, i8 zeroext %2)
+  ret void
+}
@@ -0,0 +1,12 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void (longdouble)
+
+declare void @callee(fp128*)
+
+define void @caller(fp128*) {
+  %indirect.arg.mem = alloca fp128, align 8
+  %2 = load fp128* %0
+  store fp128 %2, fp128* %indirect.arg.mem
+  call void @callee(fp128* %indirect.arg.mem)
+  ret void
+}
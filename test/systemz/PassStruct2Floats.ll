@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ float, float })
+
+declare void @callee(i64)
+
+define void @caller(i64 %coerce) {
+  %coerce.arg.source = alloca { float, float }, align 4
+  %coerce.mem = alloca { float, float }, align 8
+  %1 = bitcast { float, float }* %coerce.mem to i64*
+  store i64 %coerce, i64* %1, align 1
+  %2 = load { float, float }* %coerce.mem
+  store { float, float } %2, { float, float }* %coerce.arg.source
+  %3 = bitcast { float, float }* %coerce.arg.source to i64*
+  %4 = load i64* %3, align 1
+  call void @callee(i64 %4)
+  ret void
+}
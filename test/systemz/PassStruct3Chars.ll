@@ -0,0 +1,12 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ char, char, char })
+
+declare void @callee({ i8, i8, i8 }*)
+
+define void @caller({ i8, i8, i8 }*) {
+  %indirect.arg.mem = alloca { i8, i8, i8 }, align 1
+  %2 = load { i8, i8, i8 }* %0, align 1
+  store { i8, i8, i8 } %2, { i8, i8, i8 }* %indirect.arg.mem, align 1
+  call void @callee({ i8, i8, i8 }* %indirect.arg.mem)
+  ret void
+}
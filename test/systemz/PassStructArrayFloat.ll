@@ -0,0 +1,19 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ [1 x float] })
+
+declare void @callee(i32)
+
+define void @caller(i32 %coerce) {
+  %coerce.arg.source = alloca { [1 x float] }, align 4
+  %coerce.mem = alloca { [1 x float] }, align 4
+  %coerce.dive = getelementptr { [1 x float] }* %coerce.mem, i32 0, i32 0
+  %1 = bitcast [1 x float]* %coerce.dive to i32*
+  store i32 %coerce, i32* %1, align 1
+  %2 = load { [1 x float] }* %coerce.mem
+  store { [1 x float] } %2, { [1 x float] }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { [1 x float] }* %coerce.arg.source, i32 0, i32 0
+  %3 = bitcast [1 x float]* %coerce.dive1 to i32*
+  %4 = load i32* %3, align 1
+  call void @callee(i32 %4)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ char })
+
+declare void @callee(i8)
+
+define void @caller(i8 %coerce) {
+  %coerce.arg.source = alloca { i8 }, align 1
+  %coerce.mem = alloca { i8 }, align 1
+  %coerce.dive = getelementptr { i8 }* %coerce.mem, i32 0, i32 0
+  store i8 %coerce, i8* %coerce.dive, align 1
+  %1 = load { i8 }* %coerce.mem, align 1
+  store { i8 } %1, { i8 }* %coerce.arg.source, align 1
+  %coerce.dive1 = getelementptr { i8 }* %coerce.arg.source, i32 0, i32 0
+  %2 = load i8* %coerce.dive1, align 1
+  call void @callee(i8 %2)
+  ret void
+}
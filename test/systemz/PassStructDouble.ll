@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ double })
+
+declare void @callee(double)
+
+define void @caller(double %coerce) {
+  %coerce.arg.source = alloca { double }, align 8
+  %coerce.mem = alloca { double }, align 8
+  %coerce.dive = getelementptr { double }* %coerce.mem, i32 0, i32 0
+  store double %coerce, double* %coerce.dive, align 1
+  %1 = load { double }* %coerce.mem
+  store { double } %1, { double }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { double }* %coerce.arg.source, i32 0, i32 0
+  %2 = load double* %coerce.dive1, align 1
+  call void @callee(double %2)
+  ret void
+}
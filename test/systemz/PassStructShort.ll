@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void ({ short })
+
+declare void @callee(i16)
+
+define void @caller(i16 %coerce) {
+  %coerce.arg.source = alloca { i16 }, align 2
+  %coerce.mem = alloca { i16 }, align 2
+  %coerce.dive = getelementptr { i16 }* %coerce.mem, i32 0, i32 0
+  store i16 %coerce, i16* %coerce.dive
+  %1 = load { i16 }* %coerce.mem
+  store { i16 } %1, { i16 }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { i16 }* %coerce.arg.source, i32 0, i32 0
+  %2 = load i16* %coerce.dive1
+  call void @callee(i16 %2)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void (union { float, [4 x char] })
+
+declare void @callee(i32)
+
+define void @caller(i32 %coerce) {
+  %coerce.arg.source = alloca { float }, align 4
+  %coerce.mem = alloca { float }, align 4
+  %1 = bitcast { float }* %coerce.mem to i32*
+  store i32 %coerce, i32* %1, align 1
+  %2 = load { float }* %coerce.mem
+  store { float } %2, { float }* %coerce.arg.source
+  %3 = bitcast { float }* %coerce.arg.source to i32*
+  %4 = load i32* %3, align 1
+  call void @callee(i32 %4)
+  ret void
+}
@@ -0,0 +1,12 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void (<4 x int>)
+
+declare void @callee(<4 x i32>*)
+
+define void @caller(<4 x i32>*) {
+  %indirect.arg.mem = alloca <4 x i32>, align 16
+  %2 = load <4 x i32>* %0
+  store <4 x i32> %2, <4 x i32>* %indirect.arg.mem
+  call void @callee(<4 x i32>* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: int ()
+
+declare signext i32 @callee()
+
+define signext i32 @caller() {
+  %1 = call signext i32 @callee()
+  ret i32 %1
+}
@@ -0,0 +1,12 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: longdouble ()
+
+declare void @callee(fp128* noalias sret)
+
+define void @caller(fp128* noalias sret %agg.result) {
+  %1 = alloca fp128, align 8
+  call void @callee(fp128* noalias sret %1)
+  %2 = load fp128* %1, align 1
+  store fp128 %2, fp128* %agg.result
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: ptr (long)
+
+declare i8* @callee(i64)
+
+define i8* @caller(i64) {
+  %2 = call i8* @callee(i64 %0)
+  ret i8* %2
+}
@@ -0,0 +1,17 @@
+; ABI: s390x-unknown-linux-gnu
+; FUNCTION-TYPE: void (int, ...({ float }, double))
+
+declare void @callee(i32 signext, ...)
+
+define void @caller(i32 signext, float %coerce, double) {
+  %coerce.arg.source = alloca { float }, align 4
+  %coerce.mem = alloca { float }, align 4
+  %coerce.dive = getelementptr { float }* %coerce.mem, i32 0, i32 0
+  store float %coerce, float* %coerce.dive, align 1
+  %3 = load { float }* %coerce.mem
+  store { float } %3, { float }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { float }* %coerce.arg.source, i32 0, i32 0
+  %4 = load float* %coerce.dive1, align 1
+  call void (i32, ...)* @callee(i32 signext %0, float %4, double %1)
+  ret void
+}
@@ -0,0 +1,18 @@
+; ABI: s390x-unknown-linux-gnu
+; CPU: z13
+; FUNCTION-TYPE: void ({ <4 x int> })
+
+declare void @callee(<4 x i32>)
+
+define void @caller(<4 x i32> %coerce) {
+  %coerce.arg.source = alloca { <4 x i32> }, align 8
+  %coerce.mem = alloca { <4 x i32> }, align 8
+  %coerce.dive = getelementptr { <4 x i32> }* %coerce.mem, i32 0, i32 0
+  store <4 x i32> %coerce, <4 x i32>* %coerce.dive, align 1
+  %1 = load { <4 x i32> }* %coerce.mem
+  store { <4 x i32> } %1, { <4 x i32> }* %coerce.arg.source
+  %coerce.dive1 = getelementptr { <4 x i32> }* %coerce.arg.source, i32 0, i32 0
+  %2 = load <4 x i32>* %coerce.dive1, align 1
+  call void @callee(<4 x i32> %2)
+  ret void
+}
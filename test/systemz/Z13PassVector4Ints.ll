@@ -0,0 +1,10 @@
+; ABI: s390x-unknown-linux-gnu
+; CPU: z13
+; FUNCTION-TYPE: void (<4 x int>)
+
+declare void @callee(<4 x i32>)
+
+define void @caller(<4 x i32>) {
+  call void @callee(<4 x i32> %0)
+  ret void
+}
@@ -0,0 +1,10 @@
+; ABI: s390x-unknown-linux-gnu
+; CPU: z13
+; FUNCTION-TYPE: <4 x int> ()
+
+declare <4 x i32> @callee()
+
+define <4 x i32> @caller() {
+  %1 = call <4 x i32> @callee()
+  ret <4 x i32> %1
+}
@@ -0,0 +1,22 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: void ({ int, int })
+
+declare void @callee(i32, i32)
+
+define void @caller(i32, i32) {
+  %expand.source.arg = alloca { i32, i32 }, align 4
+  %expand.dest.arg = alloca { i32, i32 }, align 4
+  %3 = getelementptr { i32, i32 }* %expand.dest.arg, i32 0, i32 0
+  store i32 %0, i32* %3
+  %4 = getelementptr { i32, i32 }* %expand.dest.arg, i32 0, i32 1
+  store i32 %1, i32* %4
+  %5 = load { i32, i32 }* %expand.dest.arg
+  store { i32, i32 } %5, { i32, i32 }* %expand.source.arg
+  %6 = getelementptr { i32, i32 }* %expand.source.arg, i32 0, i32 0
+  %7 = load i32* %6
+  %8 = getelementptr { i32, i32 }* %expand.source.arg, i32 0, i32 1
+  %9 = load i32* %8
+  call void @callee(i32 %7, i32 %9)
+  ret void
+}
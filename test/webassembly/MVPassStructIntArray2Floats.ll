@@ -0,0 +1,28 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: void ({ int, [2 x float] })
+
+declare void @callee(i32, float, float)
+
+define void @caller(i32, float, float) {
+  %expand.source.arg = alloca { i32, [2 x float] }, align 4
+  %expand.dest.arg = alloca { i32, [2 x float] }, align 4
+  %4 = getelementptr { i32, [2 x float] }* %expand.dest.arg, i32 0, i32 0
+  store i32 %0, i32* %4
+  %5 = getelementptr { i32, [2 x float] }* %expand.dest.arg, i32 0, i32 1
+  %6 = getelementptr [2 x float]* %5, i32 0, i32 0
+  store float %1, float* %6
+  %7 = getelementptr [2 x float]* %5, i32 0, i32 1
+  store float %2, float* %7
+  %8 = load { i32, [2 x float] }* %expand.dest.arg
+  store { i32, [2 x float] } %8, { i32, [2 x float] }* %expand.source.arg
+  %9 = getelementptr { i32, [2 x float] }* %expand.source.arg, i32 0, i32 0
+  %10 = load i32* %9
+  %11 = getelementptr { i32, [2 x float] }* %expand.source.arg, i32 0, i32 1
+  %12 = getelementptr [2 x float]* %11, i32 0, i32 0
+  %13 = load float* %12
+  %14 = getelementptr [2 x float]* %11, i32 0, i32 1
+  %15 = load float* %14
+  call void @callee(i32 %10, float %13, float %15)
+  ret void
+}
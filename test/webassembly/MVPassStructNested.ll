@@ -0,0 +1,28 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: void ({ { char, short }, double })
+
+declare void @callee(i8, i16, double)
+
+define void @caller(i8, i16, double) {
+  %expand.source.arg = alloca { { i8, i16 }, double }, align 8
+  %expand.dest.arg = alloca { { i8, i16 }, double }, align 8
+  %4 = getelementptr { { i8, i16 }, double }* %expand.dest.arg, i32 0, i32 0
+  %5 = getelementptr { i8, i16 }* %4, i32 0, i32 0
+  store i8 %0, i8* %5, align 1
+  %6 = getelementptr { i8, i16 }* %4, i32 0, i32 1
+  store i16 %1, i16* %6
+  %7 = getelementptr { { i8, i16 }, double }* %expand.dest.arg, i32 0, i32 1
+  store double %2, double* %7
+  %8 = load { { i8, i16 }, double }* %expand.dest.arg
+  store { { i8, i16 }, double } %8, { { i8, i16 }, double }* %expand.source.arg
+  %9 = getelementptr { { i8, i16 }, double }* %expand.source.arg, i32 0, i32 0
+  %10 = getelementptr { i8, i16 }* %9, i32 0, i32 0
+  %11 = load i8* %10, align 1
+  %12 = getelementptr { i8, i16 }* %9, i32 0, i32 1
+  %13 = load i16* %12
+  %14 = getelementptr { { i8, i16 }, double }* %expand.source.arg, i32 0, i32 1
+  %15 = load double* %14
+  call void @callee(i8 %11, i16 %13, double %15)
+  ret void
+}
@@ -0,0 +1,18 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: void (union { int, double })
+
+declare void @callee(double)
+
+define void @caller(double) {
+  %expand.source.arg = alloca { double }, align 8
+  %expand.dest.arg = alloca { double }, align 8
+  %2 = bitcast { double }* %expand.dest.arg to double*
+  store double %0, double* %2
+  %3 = load { double }* %expand.dest.arg
+  store { double } %3, { double }* %expand.source.arg
+  %4 = bitcast { double }* %expand.source.arg to double*
+  %5 = load double* %4
+  call void @callee(double %5)
+  ret void
+}
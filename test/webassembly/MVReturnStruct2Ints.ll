@@ -0,0 +1,18 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: { int, int } ()
+
+declare { i32, i32 } @callee()
+
+define { i32, i32 } @caller() {
+  %agg.tmp = alloca { i32, i32 }, align 4
+  %1 = call { i32, i32 } @callee()
+  %2 = getelementptr { i32, i32 }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { i32, i32 } %1, 0
+  store i32 %3, i32* %2
+  %4 = getelementptr { i32, i32 }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { i32, i32 } %1, 1
+  store i32 %5, i32* %4
+  %6 = load { i32, i32 }* %agg.tmp
+  ret { i32, i32 } %6
+}
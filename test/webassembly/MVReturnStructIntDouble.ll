@@ -0,0 +1,18 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: { int, double } ()
+
+declare { i32, double } @callee()
+
+define { i32, double } @caller() {
+  %agg.tmp = alloca { i32, double }, align 8
+  %1 = call { i32, double } @callee()
+  %2 = getelementptr { i32, double }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { i32, double } %1, 0
+  store i32 %3, i32* %2
+  %4 = getelementptr { i32, double }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { i32, double } %1, 1
+  store double %5, double* %4
+  %6 = load { i32, double }* %agg.tmp
+  ret { i32, double } %6
+}
@@ -0,0 +1,22 @@
+; ABI: wasm32-unknown-unknown
+; TARGET-ABI: experimental-mv
+; FUNCTION-TYPE: void (int, ...({ double, double }))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, double, double) {
+  %expand.source.arg = alloca { double, double }, align 8
+  %expand.dest.arg = alloca { double, double }, align 8
+  %4 = getelementptr { double, double }* %expand.dest.arg, i32 0, i32 0
+  store double %1, double* %4
+  %5 = getelementptr { double, double }* %expand.dest.arg, i32 0, i32 1
+  store double %2, double* %5
+  %6 = load { double, double }* %expand.dest.arg
+  store { double, double } %6, { double, double }* %expand.source.arg
+  %7 = getelementptr { double, double }* %expand.source.arg, i32 0, i32 0
+  %8 = load double* %7
+  %9 = getelementptr { double, double }* %expand.source.arg, i32 0, i32 1
+  %10 = load double* %9
+  call void (i32, ...)* @callee(i32 %0, double %8, double %10)
+  ret void
+}
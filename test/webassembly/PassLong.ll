@@ -0,0 +1,9 @@
+; ABI: wasm32-unknown-unknown
+; FUNCTION-TYPE: void (long, ptr)
+
+declare void @callee(i32, i8*)
+
+define void @caller(i32, i8*) {
+  call void @callee(i32 %0, i8* %1)
+  ret void
+}
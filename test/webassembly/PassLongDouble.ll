@@ -0,0 +1,9 @@
+; ABI: wasm32-unknown-unknown
+; FUNCTION-TYPE: void (longdouble)
+
+declare void @callee(fp128)
+
+define void @caller(fp128) {
+  call void @callee(fp128 %0)
+  ret void
+}
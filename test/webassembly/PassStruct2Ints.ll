@@ -0,0 +1,12 @@
+; ABI: wasm32-unknown-unknown
+; FUNCTION-TYPE: void ({ int, int })
+
+declare void @callee({ i32, i32 }* byval align 4)
+
+define void @caller({ i32, i32 }* byval align 4) {
+  %indirect.arg.mem = alloca { i32, i32 }, align 4
+  %2 = load { i32, i32 }* %0
+  store { i32, i32 } %2, { i32, i32 }* %indirect.arg.mem
+  call void @callee({ i32, i32 }* byval align 4 %indirect.arg.mem)
+  ret void
+}
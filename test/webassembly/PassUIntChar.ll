@@ -0,0 +1,9 @@
+; ABI: wasm32-unknown-unknown
+; FUNCTION-TYPE: void (uint, char)
+
+declare void @callee(i32, i8 signext)
+
+define void @caller(i32, i8 signext) {
+  call void @callee(i32 %0, i8 signext %1)
+  ret void
+}
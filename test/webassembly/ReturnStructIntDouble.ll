@@ -0,0 +1,12 @@
+; ABI: wasm32-unknown-unknown
+; FUNCTION-TYPE: { int, double } ()
+
+declare void @callee({ i32, double }* noalias sret)
+
+define void @caller({ i32, double }* noalias sret %agg.result) {
+  %1 = alloca { i32, double }, align 8
+  call void @callee({ i32, double }* noalias sret %1)
+  %2 = load { i32, double }* %1, align 1
+  store { i32, double } %2, { i32, double }* %agg.result
+  ret void
+}
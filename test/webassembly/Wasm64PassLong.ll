@@ -0,0 +1,9 @@
+; ABI: wasm64-unknown-unknown
+; FUNCTION-TYPE: void (long, ptr)
+
+declare void @callee(i64, i8*)
+
+define void @caller(i64, i8*) {
+  call void @callee(i64 %0, i8* %1)
+  ret void
+}
@@ -0,0 +1,22 @@
+; ABI: i386-pc-windows-msvc
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: void ({ <4 x float>, <4 x float> })
+
+declare x86_vectorcallcc void @callee(<4 x float>, <4 x float>)
+
+define x86_vectorcallcc void @caller(<4 x float>, <4 x float>) {
+  %expand.source.arg = alloca { <4 x float>, <4 x float> }, align 16
+  %expand.dest.arg = alloca { <4 x float>, <4 x float> }, align 16
+  %3 = getelementptr { <4 x float>, <4 x float> }* %expand.dest.arg, i32 0, i32 0
+  store <4 x float> %0, <4 x float>* %3
+  %4 = getelementptr { <4 x float>, <4 x float> }* %expand.dest.arg, i32 0, i32 1
+  store <4 x float> %1, <4 x float>* %4
+  %5 = load { <4 x float>, <4 x float> }* %expand.dest.arg
+  store { <4 x float>, <4 x float> } %5, { <4 x float>, <4 x float> }* %expand.source.arg
+  %6 = getelementptr { <4 x float>, <4 x float> }* %expand.source.arg, i32 0, i32 0
+  %7 = load <4 x float>* %6
+  %8 = getelementptr { <4 x float>, <4 x float> }* %expand.source.arg, i32 0, i32 1
+  %9 = load <4 x float>* %8
+  call x86_vectorcallcc void @callee(<4 x float> %7, <4 x float> %9)
+  ret void
+}
@@ -0,0 +1,13 @@
+; ABI: x86_64-none-linux-gnu
+; Skylake Server has the AVX-512 support this test needs.
+; CPU: skylake-avx512
+; FUNCTION-TYPE: void (int, ...(<16 x float>))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, <16 x float>) #0 {
+  call void (i32, ...)* @callee(i32 %0, <16 x float> %1) #0
+  ret void
+}
+
+attributes #0 = { "min-legal-vector-width"="512" }
@@ -0,0 +1,13 @@
+; ABI: x86_64-none-linux-gnu
+; Skylake Server has the AVX-512 support this test needs.
+; CPU: skylake-avx512
+; FUNCTION-TYPE: <16 x float> (<16 x float>)
+
+declare <16 x float> @callee(<16 x float>) #0
+
+define <16 x float> @caller(<16 x float>) #0 {
+  %2 = call <16 x float> @callee(<16 x float> %0) #0
+  ret <16 x float> %2
+}
+
+attributes #0 = { "min-legal-vector-width"="512" }
@@ -0,0 +1,34 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: complexdouble (complexdouble, complexfloat)
+
+declare fastcc { double, double } @callee(double, double, float, float)
+
+define fastcc { double, double } @caller(double, double, float, float) {
+  %expand.source.arg2 = alloca { float, float }, align 8
+  %expand.source.arg = alloca { double, double }, align 16
+  %expand.dest.arg1 = alloca { float, float }, align 8
+  %expand.dest.arg = alloca { double, double }, align 16
+  %5 = getelementptr { double, double }* %expand.dest.arg, i32 0, i32 0
+  store double %0, double* %5
+  %6 = getelementptr { double, double }* %expand.dest.arg, i32 0, i32 1
+  store double %1, double* %6
+  %7 = load { double, double }* %expand.dest.arg
+  %8 = getelementptr { float, float }* %expand.dest.arg1, i32 0, i32 0
+  store float %2, float* %8
+  %9 = getelementptr { float, float }* %expand.dest.arg1, i32 0, i32 1
+  store float %3, float* %9
+  %10 = load { float, float }* %expand.dest.arg1
+  store { double, double } %7, { double, double }* %expand.source.arg
+  %11 = getelementptr { double, double }* %expand.source.arg, i32 0, i32 0
+  %12 = load double* %11
+  %13 = getelementptr { double, double }* %expand.source.arg, i32 0, i32 1
+  %14 = load double* %13
+  store { float, float } %10, { float, float }* %expand.source.arg2
+  %15 = getelementptr { float, float }* %expand.source.arg2, i32 0, i32 0
+  %16 = load float* %15
+  %17 = getelementptr { float, float }* %expand.source.arg2, i32 0, i32 1
+  %18 = load float* %17
+  %19 = call fastcc { double, double } @callee(double %12, double %14, float %16, float %18)
+  ret { double, double } %19
+}
@@ -0,0 +1,55 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void (union { <4 x float>, longlong }, union { <4 x float>, longlong }, union { <4 x float>, longlong }, union { <4 x float>, longlong })
+
+declare fastcc void @callee(i64, i64, i64, i64, i64, i64, { <4 x float> }*)
+
+define fastcc void @caller(i64 %coerce0, i64 %coerce1, i64 %coerce02, i64 %coerce13, i64 %coerce05, i64 %coerce16, { <4 x float> }*) {
+  %indirect.arg.mem = alloca { <4 x float> }, align 16
+  %coerce.arg.source8 = alloca { <4 x float> }, align 16
+  %coerce.arg.source7 = alloca { <4 x float> }, align 16
+  %coerce.arg.source = alloca { <4 x float> }, align 16
+  %coerce.mem4 = alloca { <4 x float> }, align 16
+  %coerce.mem1 = alloca { <4 x float> }, align 16
+  %coerce.mem = alloca { <4 x float> }, align 16
+  %2 = bitcast { <4 x float> }* %coerce.mem to { i64, i64 }*
+  %3 = getelementptr { i64, i64 }* %2, i32 0, i32 0
+  store i64 %coerce0, i64* %3
+  %4 = getelementptr { i64, i64 }* %2, i32 0, i32 1
+  store i64 %coerce1, i64* %4
+  %5 = load { <4 x float> }* %coerce.mem
+  %6 = bitcast { <4 x float> }* %coerce.mem1 to { i64, i64 }*
+  %7 = getelementptr { i64, i64 }* %6, i32 0, i32 0
+  store i64 %coerce02, i64* %7
+  %8 = getelementptr { i64, i64 }* %6, i32 0, i32 1
+  store i64 %coerce13, i64* %8
+  %9 = load { <4 x float> }* %coerce.mem1
+  %10 = bitcast { <4 x float> }* %coerce.mem4 to { i64, i64 }*
+  %11 = getelementptr { i64, i64 }* %10, i32 0, i32 0
+  store i64 %coerce05, i64* %11
+  %12 = getelementptr { i64, i64 }* %10, i32 0, i32 1
+  store i64 %coerce16, i64* %12
+  %13 = load { <4 x float> }* %coerce.mem4
+  %14 = load { <4 x float> }* %0
+  store { <4 x float> } %5, { <4 x float> }* %coerce.arg.source
+  %15 = bitcast { <4 x float> }* %coerce.arg.source to { i64, i64 }*
+  %16 = getelementptr { i64, i64 }* %15, i32 0, i32 0
+  %17 = load i64* %16, align 1
+  %18 = getelementptr { i64, i64 }* %15, i32 0, i32 1
+  %19 = load i64* %18, align 1
+  store { <4 x float> } %9, { <4 x float> }* %coerce.arg.source7
+  %20 = bitcast { <4 x float> }* %coerce.arg.source7 to { i64, i64 }*
+  %21 = getelementptr { i64, i64 }* %20, i32 0, i32 0
+  %22 = load i64* %21, align 1
+  %23 = getelementptr { i64, i64 }* %20, i32 0, i32 1
+  %24 = load i64* %23, align 1
+  store { <4 x float> } %13, { <4 x float> }* %coerce.arg.source8
+  %25 = bitcast { <4 x float> }* %coerce.arg.source8 to { i64, i64 }*
+  %26 = getelementptr { i64, i64 }* %25, i32 0, i32 0
+  %27 = load i64* %26, align 1
+  %28 = getelementptr { i64, i64 }* %25, i32 0, i32 1
+  %29 = load i64* %28, align 1
+  store { <4 x float> } %14, { <4 x float> }* %indirect.arg.mem
+  call fastcc void @callee(i64 %17, i64 %19, i64 %22, i64 %24, i64 %27, i64 %29, { <4 x float> }* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,26 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void ({ double, double, double })
+
+declare fastcc void @callee(double, double, double)
+
+define fastcc void @caller(double, double, double) {
+  %expand.source.arg = alloca { double, double, double }, align 8
+  %expand.dest.arg = alloca { double, double, double }, align 8
+  %4 = getelementptr { double, double, double }* %expand.dest.arg, i32 0, i32 0
+  store double %0, double* %4
+  %5 = getelementptr { double, double, double }* %expand.dest.arg, i32 0, i32 1
+  store double %1, double* %5
+  %6 = getelementptr { double, double, double }* %expand.dest.arg, i32 0, i32 2
+  store double %2, double* %6
+  %7 = load { double, double, double }* %expand.dest.arg
+  store { double, double, double } %7, { double, double, double }* %expand.source.arg
+  %8 = getelementptr { double, double, double }* %expand.source.arg, i32 0, i32 0
+  %9 = load double* %8
+  %10 = getelementptr { double, double, double }* %expand.source.arg, i32 0, i32 1
+  %11 = load double* %10
+  %12 = getelementptr { double, double, double }* %expand.source.arg, i32 0, i32 2
+  %13 = load double* %12
+  call fastcc void @callee(double %9, double %11, double %13)
+  ret void
+}
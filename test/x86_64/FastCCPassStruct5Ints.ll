@@ -0,0 +1,34 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void ({ int, int, int, int, int })
+
+declare fastcc void @callee(i32, i32, i32, i32, i32)
+
+define fastcc void @caller(i32, i32, i32, i32, i32) {
+  %expand.source.arg = alloca { i32, i32, i32, i32, i32 }, align 4
+  %expand.dest.arg = alloca { i32, i32, i32, i32, i32 }, align 4
+  %6 = getelementptr { i32, i32, i32, i32, i32 }* %expand.dest.arg, i32 0, i32 0
+  store i32 %0, i32* %6
+  %7 = getelementptr { i32, i32, i32, i32, i32 }* %expand.dest.arg, i32 0, i32 1
+  store i32 %1, i32* %7
+  %8 = getelementptr { i32, i32, i32, i32, i32 }* %expand.dest.arg, i32 0, i32 2
+  store i32 %2, i32* %8
+  %9 = getelementptr { i32, i32, i32, i32, i32 }* %expand.dest.arg, i32 0, i32 3
+  store i32 %3, i32* %9
+  %10 = getelementptr { i32, i32, i32, i32, i32 }* %expand.dest.arg, i32 0, i32 4
+  store i32 %4, i32* %10
+  %11 = load { i32, i32, i32, i32, i32 }* %expand.dest.arg
+  store { i32, i32, i32, i32, i32 } %11, { i32, i32, i32, i32, i32 }* %expand.source.arg
+  %12 = getelementptr { i32, i32, i32, i32, i32 }* %expand.source.arg, i32 0, i32 0
+  %13 = load i32* %12
+  %14 = getelementptr { i32, i32, i32, i32, i32 }* %expand.source.arg, i32 0, i32 1
+  %15 = load i32* %14
+  %16 = getelementptr { i32, i32, i32, i32, i32 }* %expand.source.arg, i32 0, i32 2
+  %17 = load i32* %16
+  %18 = getelementptr { i32, i32, i32, i32, i32 }* %expand.source.arg, i32 0, i32 3
+  %19 = load i32* %18
+  %20 = getelementptr { i32, i32, i32, i32, i32 }* %expand.source.arg, i32 0, i32 4
+  %21 = load i32* %20
+  call fastcc void @callee(i32 %13, i32 %15, i32 %17, i32 %19, i32 %21)
+  ret void
+}
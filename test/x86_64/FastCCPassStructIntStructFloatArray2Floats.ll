@@ -0,0 +1,34 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void ({ int, { float, [2 x float] } })
+
+declare fastcc void @callee(i32, float, float, float)
+
+define fastcc void @caller(i32, float, float, float) {
+  %expand.source.arg = alloca { i32, { float, [2 x float] } }, align 4
+  %expand.dest.arg = alloca { i32, { float, [2 x float] } }, align 4
+  %5 = getelementptr { i32, { float, [2 x float] } }* %expand.dest.arg, i32 0, i32 0
+  store i32 %0, i32* %5
+  %6 = getelementptr { i32, { float, [2 x float] } }* %expand.dest.arg, i32 0, i32 1
+  %7 = getelementptr { float, [2 x float] }* %6, i32 0, i32 0
+  store float %1, float* %7
+  %8 = getelementptr { float, [2 x float] }* %6, i32 0, i32 1
+  %9 = getelementptr [2 x float]* %8, i32 0, i32 0
+  store float %2, float* %9
+  %10 = getelementptr [2 x float]* %8, i32 0, i32 1
+  store float %3, float* %10
+  %11 = load { i32, { float, [2 x float] } }* %expand.dest.arg
+  store { i32, { float, [2 x float] } } %11, { i32, { float, [2 x float] } }* %expand.source.arg
+  %12 = getelementptr { i32, { float, [2 x float] } }* %expand.source.arg, i32 0, i32 0
+  %13 = load i32* %12
+  %14 = getelementptr { i32, { float, [2 x float] } }* %expand.source.arg, i32 0, i32 1
+  %15 = getelementptr { float, [2 x float] }* %14, i32 0, i32 0
+  %16 = load float* %15
+  %17 = getelementptr { float, [2 x float] }* %14, i32 0, i32 1
+  %18 = getelementptr [2 x float]* %17, i32 0, i32 0
+  %19 = load float* %18
+  %20 = getelementptr [2 x float]* %17, i32 0, i32 1
+  %21 = load float* %20
+  call fastcc void @callee(i32 %13, float %16, float %19, float %21)
+  ret void
+}
@@ -0,0 +1,32 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void ({ int, union { float, int } }, union { <4 x float>, longlong })
+
+declare fastcc void @callee(i64, i64, i64)
+
+define fastcc void @caller(i64 %coerce, i64 %coerce0, i64 %coerce1) {
+  %coerce.arg.source2 = alloca { <4 x float> }, align 16
+  %coerce.arg.source = alloca { i32, { float } }, align 4
+  %coerce.mem1 = alloca { <4 x float> }, align 16
+  %coerce.mem = alloca { i32, { float } }, align 8
+  %1 = bitcast { i32, { float } }* %coerce.mem to i64*
+  store i64 %coerce, i64* %1, align 1
+  %2 = load { i32, { float } }* %coerce.mem
+  %3 = bitcast { <4 x float> }* %coerce.mem1 to { i64, i64 }*
+  %4 = getelementptr { i64, i64 }* %3, i32 0, i32 0
+  store i64 %coerce0, i64* %4
+  %5 = getelementptr { i64, i64 }* %3, i32 0, i32 1
+  store i64 %coerce1, i64* %5
+  %6 = load { <4 x float> }* %coerce.mem1
+  store { i32, { float } } %2, { i32, { float } }* %coerce.arg.source
+  %7 = bitcast { i32, { float } }* %coerce.arg.source to i64*
+  %8 = load i64* %7, align 1
+  store { <4 x float> } %6, { <4 x float> }* %coerce.arg.source2
+  %9 = bitcast { <4 x float> }* %coerce.arg.source2 to { i64, i64 }*
+  %10 = getelementptr { i64, i64 }* %9, i32 0, i32 0
+  %11 = load i64* %10, align 1
+  %12 = getelementptr { i64, i64 }* %9, i32 0, i32 1
+  %13 = load i64* %12, align 1
+  call fastcc void @callee(i64 %8, i64 %11, i64 %13)
+  ret void
+}
@@ -0,0 +1,33 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void ({ long, long, long, long }, { long, long, long, long })
+
+declare fastcc void @callee(i64, i64, i64, i64, { i64, i64, i64, i64 }*)
+
+define fastcc void @caller(i64, i64, i64, i64, { i64, i64, i64, i64 }*) {
+  %indirect.arg.mem = alloca { i64, i64, i64, i64 }, align 8
+  %expand.source.arg = alloca { i64, i64, i64, i64 }, align 8
+  %expand.dest.arg = alloca { i64, i64, i64, i64 }, align 8
+  %6 = getelementptr { i64, i64, i64, i64 }* %expand.dest.arg, i32 0, i32 0
+  store i64 %0, i64* %6
+  %7 = getelementptr { i64, i64, i64, i64 }* %expand.dest.arg, i32 0, i32 1
+  store i64 %1, i64* %7
+  %8 = getelementptr { i64, i64, i64, i64 }* %expand.dest.arg, i32 0, i32 2
+  store i64 %2, i64* %8
+  %9 = getelementptr { i64, i64, i64, i64 }* %expand.dest.arg, i32 0, i32 3
+  store i64 %3, i64* %9
+  %10 = load { i64, i64, i64, i64 }* %expand.dest.arg
+  %11 = load { i64, i64, i64, i64 }* %4
+  store { i64, i64, i64, i64 } %10, { i64, i64, i64, i64 }* %expand.source.arg
+  %12 = getelementptr { i64, i64, i64, i64 }* %expand.source.arg, i32 0, i32 0
+  %13 = load i64* %12
+  %14 = getelementptr { i64, i64, i64, i64 }* %expand.source.arg, i32 0, i32 1
+  %15 = load i64* %14
+  %16 = getelementptr { i64, i64, i64, i64 }* %expand.source.arg, i32 0, i32 2
+  %17 = load i64* %16
+  %18 = getelementptr { i64, i64, i64, i64 }* %expand.source.arg, i32 0, i32 3
+  %19 = load i64* %18
+  store { i64, i64, i64, i64 } %11, { i64, i64, i64, i64 }* %indirect.arg.mem
+  call fastcc void @callee(i64 %13, i64 %15, i64 %17, i64 %19, { i64, i64, i64, i64 }* %indirect.arg.mem)
+  ret void
+}
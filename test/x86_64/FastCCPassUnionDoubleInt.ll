@@ -0,0 +1,18 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: void (union { double, int })
+
+declare fastcc void @callee(i64)
+
+define fastcc void @caller(i64 %coerce) {
+  %coerce.arg.source = alloca { double }, align 8
+  %coerce.mem = alloca { double }, align 8
+  %1 = bitcast { double }* %coerce.mem to i64*
+  store i64 %coerce, i64* %1, align 1
+  %2 = load { double }* %coerce.mem
+  store { double } %2, { double }* %coerce.arg.source
+  %3 = bitcast { double }* %coerce.arg.source to i64*
+  %4 = load i64* %3, align 1
+  call fastcc void @callee(i64 %4)
+  ret void
+}
@@ -0,0 +1,13 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: { double, double, double } ()
+
+declare fastcc void @callee({ double, double, double }* noalias sret)
+
+define fastcc void @caller({ double, double, double }* noalias sret %agg.result) {
+  %1 = alloca { double, double, double }, align 8
+  call fastcc void @callee({ double, double, double }* noalias sret %1)
+  %2 = load { double, double, double }* %1, align 1
+  store { double, double, double } %2, { double, double, double }* %agg.result
+  ret void
+}
@@ -0,0 +1,24 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: fastcc
+; FUNCTION-TYPE: { long, long, long, long } ()
+
+declare fastcc { i64, i64, i64, i64 } @callee()
+
+define fastcc { i64, i64, i64, i64 } @caller() {
+  %agg.tmp = alloca { i64, i64, i64, i64 }, align 8
+  %1 = call fastcc { i64, i64, i64, i64 } @callee()
+  %2 = getelementptr { i64, i64, i64, i64 }* %agg.tmp, i32 0, i32 0
+  %3 = extractvalue { i64, i64, i64, i64 } %1, 0
+  store i64 %3, i64* %2
+  %4 = getelementptr { i64, i64, i64, i64 }* %agg.tmp, i32 0, i32 1
+  %5 = extractvalue { i64, i64, i64, i64 } %1, 1
+  store i64 %5, i64* %4
+  %6 = getelementptr { i64, i64, i64, i64 }* %agg.tmp, i32 0, i32 2
+  %7 = extractvalue { i64, i64, i64, i64 } %1, 2
+  store i64 %7, i64* %6
+  %8 = getelementptr { i64, i64, i64, i64 }* %agg.tmp, i32 0, i32 3
+  %9 = extractvalue { i64, i64, i64, i64 } %1, 3
+  store i64 %9, i64* %8
+  %10 = load { i64, i64, i64, i64 }* %agg.tmp
+  ret { i64, i64, i64, i64 } %10
+}
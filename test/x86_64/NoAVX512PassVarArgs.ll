@@ -0,0 +1,14 @@
+; ABI: x86_64-none-linux-gnu
+; Haswell has AVX2 but not AVX-512.
+; CPU: haswell
+; FUNCTION-TYPE: void (int, ...(<16 x float>))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, <16 x float>* byval align 32) {
+  %indirect.arg.mem = alloca <16 x float>, align 32
+  %3 = load <16 x float>* %1, align 32
+  store <16 x float> %3, <16 x float>* %indirect.arg.mem, align 32
+  call void (i32, ...)* @callee(i32 %0, <16 x float>* byval align 32 %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,14 @@
+; ABI: x86_64-none-linux-gnu
+; Without AVX-512F the vector member is only 32-byte aligned.
+; CPU: haswell
+; FUNCTION-TYPE: void ({ float, <16 x float> })
+
+declare void @callee({ float, <16 x float> }* byval align 32)
+
+define void @caller({ float, <16 x float> }* byval align 32) {
+  %indirect.arg.mem = alloca { float, <16 x float> }, align 32
+  %2 = load { float, <16 x float> }* %0
+  store { float, <16 x float> } %2, { float, <16 x float> }* %indirect.arg.mem
+  call void @callee({ float, <16 x float> }* byval align 32 %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,17 @@
+; ABI: x86_64-none-linux-gnu
+; Haswell has AVX2 but not AVX-512.
+; CPU: haswell
+; FUNCTION-TYPE: {<16 x float>} ({<16 x float>})
+
+declare void @callee({ <16 x float> }* noalias sret, { <16 x float> }* byval align 32)
+
+define void @caller({ <16 x float> }* noalias sret %agg.result, { <16 x float> }* byval align 32) {
+  %indirect.arg.mem = alloca { <16 x float> }, align 32
+  %2 = alloca { <16 x float> }, align 32
+  %3 = load { <16 x float> }* %0, align 32
+  store { <16 x float> } %3, { <16 x float> }* %indirect.arg.mem, align 32
+  call void @callee({ <16 x float> }* noalias sret %2, { <16 x float> }* byval align 32 %indirect.arg.mem)
+  %4 = load { <16 x float> }* %2
+  store { <16 x float> } %4, { <16 x float> }* %agg.result
+  ret void
+}
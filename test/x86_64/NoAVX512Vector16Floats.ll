@@ -0,0 +1,14 @@
+; ABI: x86_64-none-linux-gnu
+; Haswell has AVX2 but not AVX-512.
+; CPU: haswell
+; FUNCTION-TYPE: <16 x float> (<16 x float>)
+
+declare <16 x float> @callee(<16 x float>* byval align 32)
+
+define <16 x float> @caller(<16 x float>* byval align 32) {
+  %indirect.arg.mem = alloca <16 x float>, align 32
+  %2 = load <16 x float>* %0, align 32
+  store <16 x float> %2, <16 x float>* %indirect.arg.mem, align 32
+  %3 = call <16 x float> @callee(<16 x float>* byval align 32 %indirect.arg.mem)
+  ret <16 x float> %3
+}
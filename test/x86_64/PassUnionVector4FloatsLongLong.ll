@@ -0,0 +1,23 @@
+; ABI: x86_64-none-linux-gnu
+; FUNCTION-TYPE: void (union { <4 x float>, longlong })
+
+declare void @callee(i64, double)
+
+define void @caller(i64 %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { <4 x float> }, align 16
+  %coerce.mem = alloca { <4 x float> }, align 16
+  %1 = bitcast { <4 x float> }* %coerce.mem to { i64, double }*
+  %2 = getelementptr { i64, double }* %1, i32 0, i32 0
+  store i64 %coerce0, i64* %2
+  %3 = getelementptr { i64, double }* %1, i32 0, i32 1
+  store double %coerce1, double* %3
+  %4 = load { <4 x float> }* %coerce.mem
+  store { <4 x float> } %4, { <4 x float> }* %coerce.arg.source
+  %5 = bitcast { <4 x float> }* %coerce.arg.source to { i64, double }*
+  %6 = getelementptr { i64, double }* %5, i32 0, i32 0
+  %7 = load i64* %6, align 1
+  %8 = getelementptr { i64, double }* %5, i32 0, i32 1
+  %9 = load double* %8, align 1
+  call void @callee(i64 %7, double %9)
+  ret void
+}
@@ -0,0 +1,26 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: regcall
+; FUNCTION-TYPE: void ({ double, double, double })
+
+declare x86_regcallcc void @callee(double, double, double)
+
+define x86_regcallcc void @caller(double %coerce0, double %coerce1, double %coerce2) {
+  %coerce.arg.source = alloca { double, double, double }, align 8
+  %coerce.mem = alloca { double, double, double }, align 8
+  %1 = getelementptr { double, double, double }* %coerce.mem, i32 0, i32 0
+  store double %coerce0, double* %1
+  %2 = getelementptr { double, double, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %2
+  %3 = getelementptr { double, double, double }* %coerce.mem, i32 0, i32 2
+  store double %coerce2, double* %3
+  %4 = load { double, double, double }* %coerce.mem
+  store { double, double, double } %4, { double, double, double }* %coerce.arg.source
+  %5 = getelementptr { double, double, double }* %coerce.arg.source, i32 0, i32 0
+  %6 = load double* %5, align 1
+  %7 = getelementptr { double, double, double }* %coerce.arg.source, i32 0, i32 1
+  %8 = load double* %7, align 1
+  %9 = getelementptr { double, double, double }* %coerce.arg.source, i32 0, i32 2
+  %10 = load double* %9, align 1
+  call x86_regcallcc void @callee(double %6, double %8, double %10)
+  ret void
+}
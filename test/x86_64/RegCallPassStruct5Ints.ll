@@ -0,0 +1,34 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: regcall
+; FUNCTION-TYPE: void ({ int, int, int, int, int })
+
+declare x86_regcallcc void @callee(i32, i32, i32, i32, i32)
+
+define x86_regcallcc void @caller(i32 %coerce0, i32 %coerce1, i32 %coerce2, i32 %coerce3, i32 %coerce4) {
+  %coerce.arg.source = alloca { i32, i32, i32, i32, i32 }, align 4
+  %coerce.mem = alloca { i32, i32, i32, i32, i32 }, align 4
+  %1 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.mem, i32 0, i32 0
+  store i32 %coerce0, i32* %1
+  %2 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.mem, i32 0, i32 1
+  store i32 %coerce1, i32* %2
+  %3 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.mem, i32 0, i32 2
+  store i32 %coerce2, i32* %3
+  %4 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.mem, i32 0, i32 3
+  store i32 %coerce3, i32* %4
+  %5 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.mem, i32 0, i32 4
+  store i32 %coerce4, i32* %5
+  %6 = load { i32, i32, i32, i32, i32 }* %coerce.mem
+  store { i32, i32, i32, i32, i32 } %6, { i32, i32, i32, i32, i32 }* %coerce.arg.source
+  %7 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.arg.source, i32 0, i32 0
+  %8 = load i32* %7, align 1
+  %9 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.arg.source, i32 0, i32 1
+  %10 = load i32* %9, align 1
+  %11 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.arg.source, i32 0, i32 2
+  %12 = load i32* %11, align 1
+  %13 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.arg.source, i32 0, i32 3
+  %14 = load i32* %13, align 1
+  %15 = getelementptr { i32, i32, i32, i32, i32 }* %coerce.arg.source, i32 0, i32 4
+  %16 = load i32* %15, align 1
+  call x86_regcallcc void @callee(i32 %8, i32 %10, i32 %12, i32 %14, i32 %16)
+  ret void
+}
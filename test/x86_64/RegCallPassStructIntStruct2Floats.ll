@@ -0,0 +1,22 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: regcall
+; FUNCTION-TYPE: void ({ int, { float, float } })
+
+declare x86_regcallcc void @callee(i32, { float, float })
+
+define x86_regcallcc void @caller(i32 %coerce0, { float, float } %coerce1) {
+  %coerce.arg.source = alloca { i32, { float, float } }, align 4
+  %coerce.mem = alloca { i32, { float, float } }, align 4
+  %1 = getelementptr { i32, { float, float } }* %coerce.mem, i32 0, i32 0
+  store i32 %coerce0, i32* %1
+  %2 = getelementptr { i32, { float, float } }* %coerce.mem, i32 0, i32 1
+  store { float, float } %coerce1, { float, float }* %2
+  %3 = load { i32, { float, float } }* %coerce.mem
+  store { i32, { float, float } } %3, { i32, { float, float } }* %coerce.arg.source
+  %4 = getelementptr { i32, { float, float } }* %coerce.arg.source, i32 0, i32 0
+  %5 = load i32* %4, align 1
+  %6 = getelementptr { i32, { float, float } }* %coerce.arg.source, i32 0, i32 1
+  %7 = load { float, float }* %6, align 1
+  call x86_regcallcc void @callee(i32 %5, { float, float } %7)
+  ret void
+}
@@ -0,0 +1,41 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: regcall
+; FUNCTION-TYPE: void ({ long, long, long, long, long, long }, { long, long, long, long, long, long })
+
+declare x86_regcallcc void @callee(i64, i64, i64, i64, i64, i64, { i64, i64, i64, i64, i64, i64 }* byval align 8)
+
+define x86_regcallcc void @caller(i64 %coerce0, i64 %coerce1, i64 %coerce2, i64 %coerce3, i64 %coerce4, i64 %coerce5, { i64, i64, i64, i64, i64, i64 }* byval align 8) {
+  %indirect.arg.mem = alloca { i64, i64, i64, i64, i64, i64 }, align 8
+  %coerce.arg.source = alloca { i64, i64, i64, i64, i64, i64 }, align 8
+  %coerce.mem = alloca { i64, i64, i64, i64, i64, i64 }, align 8
+  %2 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 0
+  store i64 %coerce0, i64* %2
+  %3 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 1
+  store i64 %coerce1, i64* %3
+  %4 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 2
+  store i64 %coerce2, i64* %4
+  %5 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 3
+  store i64 %coerce3, i64* %5
+  %6 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 4
+  store i64 %coerce4, i64* %6
+  %7 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.mem, i32 0, i32 5
+  store i64 %coerce5, i64* %7
+  %8 = load { i64, i64, i64, i64, i64, i64 }* %coerce.mem
+  %9 = load { i64, i64, i64, i64, i64, i64 }* %0
+  store { i64, i64, i64, i64, i64, i64 } %8, { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source
+  %10 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 0
+  %11 = load i64* %10, align 1
+  %12 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 1
+  %13 = load i64* %12, align 1
+  %14 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 2
+  %15 = load i64* %14, align 1
+  %16 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 3
+  %17 = load i64* %16, align 1
+  %18 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 4
+  %19 = load i64* %18, align 1
+  %20 = getelementptr { i64, i64, i64, i64, i64, i64 }* %coerce.arg.source, i32 0, i32 5
+  %21 = load i64* %20, align 1
+  store { i64, i64, i64, i64, i64, i64 } %9, { i64, i64, i64, i64, i64, i64 }* %indirect.arg.mem
+  call x86_regcallcc void @callee(i64 %11, i64 %13, i64 %15, i64 %17, i64 %19, i64 %21, { i64, i64, i64, i64, i64, i64 }* byval align 8 %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,13 @@
+; ABI: x86_64-none-linux-gnu
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: void ({ <4 x float>, <4 x float>, <4 x float>, <4 x float> })
+
+declare x86_vectorcallcc void @callee({ <4 x float>, <4 x float>, <4 x float>, <4 x float> }* byval align 16)
+
+define x86_vectorcallcc void @caller({ <4 x float>, <4 x float>, <4 x float>, <4 x float> }* byval align 16) {
+  %indirect.arg.mem = alloca { <4 x float>, <4 x float>, <4 x float>, <4 x float> }, align 16
+  %2 = load { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %0
+  store { <4 x float>, <4 x float>, <4 x float>, <4 x float> } %2, { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %indirect.arg.mem
+  call x86_vectorcallcc void @callee({ <4 x float>, <4 x float>, <4 x float>, <4 x float> }* byval align 16 %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,12 @@
+; ABI: x86_64-pc-windows-gnu
+; FUNCTION-TYPE: void (longdouble)
+
+declare void @callee(x86_fp80*)
+
+define void @caller(x86_fp80*) {
+  %indirect.arg.mem = alloca x86_fp80, align 16
+  %2 = load x86_fp80* %0
+  store x86_fp80 %2, x86_fp80* %indirect.arg.mem
+  call void @callee(x86_fp80* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: x86_64-pc-windows-msvc
+; FUNCTION-TYPE: void (char, short)
+
+declare void @callee(i8, i16)
+
+define void @caller(i8, i16) {
+  call void @callee(i8 %0, i16 %1)
+  ret void
+}
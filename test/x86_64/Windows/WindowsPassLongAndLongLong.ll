@@ -0,0 +1,9 @@
+; ABI: x86_64-pc-windows-msvc
+; FUNCTION-TYPE: long (long, longlong)
+
+declare i32 @callee(i32, i64)
+
+define i32 @caller(i32, i64) {
+  %3 = call i32 @callee(i32 %0, i64 %1)
+  ret i32 %3
+}
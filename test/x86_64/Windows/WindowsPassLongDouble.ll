@@ -0,0 +1,9 @@
+; ABI: x86_64-pc-windows-msvc
+; FUNCTION-TYPE: longdouble (longdouble)
+
+declare double @callee(double)
+
+define double @caller(double) {
+  %2 = call double @callee(double %0)
+  ret double %2
+}
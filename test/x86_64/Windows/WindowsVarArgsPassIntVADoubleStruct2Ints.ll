@@ -0,0 +1,17 @@
+; ABI: x86_64-pc-windows-msvc
+; FUNCTION-TYPE: void (int, ...(double, { int, int }))
+
+declare void @callee(i32, ...)
+
+define void @caller(i32, double, i64 %coerce) {
+  %coerce.arg.source = alloca { i32, i32 }, align 4
+  %coerce.mem = alloca { i32, i32 }, align 8
+  %3 = bitcast { i32, i32 }* %coerce.mem to i64*
+  store i64 %coerce, i64* %3, align 1
+  %4 = load { i32, i32 }* %coerce.mem
+  store { i32, i32 } %4, { i32, i32 }* %coerce.arg.source
+  %5 = bitcast { i32, i32 }* %coerce.arg.source to i64*
+  %6 = load i64* %5, align 1
+  call void (i32, ...)* @callee(i32 %0, double %1, i64 %6)
+  ret void
+}
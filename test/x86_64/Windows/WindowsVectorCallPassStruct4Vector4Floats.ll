@@ -0,0 +1,16 @@
+; ABI: x86_64-pc-windows-msvc
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: void ({ <4 x float>, <4 x float>, <4 x float>, <4 x float> })
+
+declare x86_vectorcallcc void @callee({ <4 x float>, <4 x float>, <4 x float>, <4 x float> } inreg)
+
+define x86_vectorcallcc void @caller({ <4 x float>, <4 x float>, <4 x float>, <4 x float> } inreg %coerce) {
+  %coerce.arg.source = alloca { <4 x float>, <4 x float>, <4 x float>, <4 x float> }, align 16
+  %coerce.mem = alloca { <4 x float>, <4 x float>, <4 x float>, <4 x float> }, align 16
+  store { <4 x float>, <4 x float>, <4 x float>, <4 x float> } %coerce, { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %coerce.mem
+  %1 = load { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %coerce.mem
+  store { <4 x float>, <4 x float>, <4 x float>, <4 x float> } %1, { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %coerce.arg.source
+  %2 = load { <4 x float>, <4 x float>, <4 x float>, <4 x float> }* %coerce.arg.source
+  call x86_vectorcallcc void @callee({ <4 x float>, <4 x float>, <4 x float>, <4 x float> } inreg %2)
+  ret void
+}
@@ -0,0 +1,13 @@
+; ABI: x86_64-pc-windows-msvc
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: void ({ float, float, float, float, float })
+
+declare x86_vectorcallcc void @callee({ float, float, float, float, float }*)
+
+define x86_vectorcallcc void @caller({ float, float, float, float, float }*) {
+  %indirect.arg.mem = alloca { float, float, float, float, float }, align 4
+  %2 = load { float, float, float, float, float }* %0
+  store { float, float, float, float, float } %2, { float, float, float, float, float }* %indirect.arg.mem
+  call x86_vectorcallcc void @callee({ float, float, float, float, float }* %indirect.arg.mem)
+  ret void
+}
@@ -0,0 +1,19 @@
+; ABI: x86_64-pc-windows-msvc
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: void ({ double, double, double, double }, { double, double, double, double })
+
+declare x86_vectorcallcc void @callee({ double, double, double, double } inreg, { double, double, double, double }*)
+
+define x86_vectorcallcc void @caller({ double, double, double, double } inreg %coerce, { double, double, double, double }*) {
+  %indirect.arg.mem = alloca { double, double, double, double }, align 8
+  %coerce.arg.source = alloca { double, double, double, double }, align 8
+  %coerce.mem = alloca { double, double, double, double }, align 8
+  store { double, double, double, double } %coerce, { double, double, double, double }* %coerce.mem
+  %2 = load { double, double, double, double }* %coerce.mem
+  %3 = load { double, double, double, double }* %0
+  store { double, double, double, double } %2, { double, double, double, double }* %coerce.arg.source
+  %4 = load { double, double, double, double }* %coerce.arg.source
+  store { double, double, double, double } %3, { double, double, double, double }* %indirect.arg.mem
+  call x86_vectorcallcc void @callee({ double, double, double, double } inreg %4, { double, double, double, double }* %indirect.arg.mem)
+  ret void
+}
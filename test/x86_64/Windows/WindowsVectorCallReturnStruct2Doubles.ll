@@ -0,0 +1,18 @@
+; ABI: x86_64-pc-windows-msvc
+; CALLING-CONVENTION: vectorcall
+; FUNCTION-TYPE: { double, double } (double, double)
+
+declare x86_vectorcallcc { double, double } @callee(double, double)
+
+define x86_vectorcallcc { double, double } @caller(double, double) {
+  %agg.tmp = alloca { double, double }, align 8
+  %3 = call x86_vectorcallcc { double, double } @callee(double %0, double %1)
+  %4 = getelementptr { double, double }* %agg.tmp, i32 0, i32 0
+  %5 = extractvalue { double, double } %3, 0
+  store double %5, double* %4
+  %6 = getelementptr { double, double }* %agg.tmp, i32 0, i32 1
+  %7 = extractvalue { double, double } %3, 1
+  store double %7, double* %6
+  %8 = load { double, double }* %agg.tmp
+  ret { double, double } %8
+}
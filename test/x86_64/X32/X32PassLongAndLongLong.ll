@@ -0,0 +1,9 @@
+; ABI: x86_64-none-linux-gnux32
+; FUNCTION-TYPE: void (long, longlong)
+
+declare void @callee(i32, i64)
+
+define void @caller(i32, i64) {
+  call void @callee(i32 %0, i64 %1)
+  ret void
+}
@@ -0,0 +1,21 @@
+; ABI: x86_64-none-linux-gnux32
+; FUNCTION-TYPE: void ({ ptr, double })
+
+declare void @callee(i8*, double)
+
+define void @caller(i8* %coerce0, double %coerce1) {
+  %coerce.arg.source = alloca { i8*, double }, align 8
+  %coerce.mem = alloca { i8*, double }, align 8
+  %1 = getelementptr { i8*, double }* %coerce.mem, i32 0, i32 0
+  store i8* %coerce0, i8** %1
+  %2 = getelementptr { i8*, double }* %coerce.mem, i32 0, i32 1
+  store double %coerce1, double* %2
+  %3 = load { i8*, double }* %coerce.mem
+  store { i8*, double } %3, { i8*, double }* %coerce.arg.source
+  %4 = getelementptr { i8*, double }* %coerce.arg.source, i32 0, i32 0
+  %5 = load i8** %4, align 1
+  %6 = getelementptr { i8*, double }* %coerce.arg.source, i32 0, i32 1
+  %7 = load double* %6, align 1
+  call void @callee(i8* %5, double %7)
+  ret void
+}
@@ -0,0 +1,9 @@
+; ABI: x86_64-none-linux-gnux32
+; FUNCTION-TYPE: ptr ()
+
+declare i8* @callee()
+
+define i8* @caller() {
+  %1 = call i8* @callee()
+  ret i8* %1
+}
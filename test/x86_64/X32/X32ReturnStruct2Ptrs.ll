@@ -0,0 +1,17 @@
+; ABI: x86_64-none-linux-gnux32
+; FUNCTION-TYPE: { ptr, ptr } ()
+
+declare i64 @callee()
+
+define i64 @caller() {
+  %coerce1 = alloca { i8*, i8* }, align 4
+  %coerce = alloca { i8*, i8* }, align 4
+  %1 = call i64 @callee()
+  %2 = bitcast { i8*, i8* }* %coerce to i64*
+  store i64 %1, i64* %2, align 1
+  %3 = load { i8*, i8* }* %coerce
+  store { i8*, i8* } %3, { i8*, i8* }* %coerce1
+  %4 = bitcast { i8*, i8* }* %coerce1 to i64*
+  %5 = load i64* %4, align 1
+  ret i64 %5
+}
@@ -0,0 +1,9 @@
+; ABI: x86_64-none-linux-gnux32
+; FUNCTION-TYPE: void (ptr, ...(ptr, long))
+
+declare void @callee(i8*, ...)
+
+define void @caller(i8*, i8*, i32) {
+  call void (i8*, ...)* @callee(i8* %0, i8* %1, i32 %2)
+  ret void
+}